@@ -371,6 +371,8 @@ _TESTS = {
             "ERS_Ln9.ne4pg2_ne4pg2.FRCE-MMF1.eam-cosp_nhtfrq9",
             "SMS_Ln5.ne4_ne4.FSCM-ARM97-MMF1",
             "SMS_Ln3.ne4pg2_ne4pg2.F2010-MMF2",
+            "ERS_Ln9.ne4pg2_ne4pg2.F2010-MMF2.eam-mmf_pam_session",
+            "PAMS_Ln9.ne4pg2_ne4pg2.F2010-MMF2",
             )
         },
 
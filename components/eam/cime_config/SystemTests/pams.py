@@ -0,0 +1,40 @@
+"""
+PAM session test: the MMF with the PAM CRM is run twice, once with the default build,
+which creates and finalizes the PAM coupler state and module objects at every GCM step,
+and once built with -pam_persistent_session, which keeps them across GCM steps. Only
+the vertical grid and the GCM arrays are refreshed at each step of the persistent run,
+so this checks that the setup done once is still valid on later steps: the answers
+must be bit-for-bit identical.
+
+This class inherits from SystemTestsCompareTwo.
+"""
+
+import logging
+
+from CIME.SystemTests.system_tests_compare_two import SystemTestsCompareTwo
+
+logger = logging.getLogger(__name__)
+
+PERSISTENT_OPT = "-pam_persistent_session"
+
+
+class PAMS(SystemTestsCompareTwo):
+    def __init__(self, case, **kwargs):
+        SystemTestsCompareTwo.__init__(
+            self,
+            case,
+            separate_builds=True,
+            run_two_suffix="persistent",
+            run_one_description="PAM session rebuilt at every GCM step",
+            run_two_description="persistent PAM session",
+            **kwargs
+        )
+
+    def _case_one_setup(self):
+        opts = self._case.get_value("CAM_CONFIG_OPTS")
+        self._case.set_value("CAM_CONFIG_OPTS", opts.replace(PERSISTENT_OPT, ""))
+
+    def _case_two_setup(self):
+        opts = self._case.get_value("CAM_CONFIG_OPTS")
+        if PERSISTENT_OPT not in opts:
+            self._case.set_value("CAM_CONFIG_OPTS", opts + " " + PERSISTENT_OPT)
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_register.h"
 
 void pam_accelerate_nstop( pam::PamCoupler &coupler, int &nstop) {
   auto crm_accel_factor = coupler.get_option<real>("crm_accel_factor");
@@ -24,11 +25,11 @@ inline void pam_accelerate_init( pam::PamCoupler &coupler ) {
   auto nx           = coupler.get_option<int>("crm_nx");
   auto crm_accel_uv = coupler.get_option<bool>("crm_accel_uv");
   //------------------------------------------------------------------------------------------------
-  dm_device.register_and_allocate<real>("accel_save_t", "saved temperature for MSA", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("accel_save_r", "saved dry density for MSA", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("accel_save_q", "saved total water for MSA", {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("accel_save_u", "saved uvel for MSA",        {nz,nens}, {"z","nens"} );
-  dm_device.register_and_allocate<real>("accel_save_v", "saved vvel for MSA",        {nz,nens}, {"z","nens"} );
+  pam_register_and_allocate<real>(dm_device, "accel_save_t", "saved temperature for MSA", {nz,nens}, {"z","nens"} );
+  pam_register_and_allocate<real>(dm_device, "accel_save_r", "saved dry density for MSA", {nz,nens}, {"z","nens"} );
+  pam_register_and_allocate<real>(dm_device, "accel_save_q", "saved total water for MSA", {nz,nens}, {"z","nens"} );
+  pam_register_and_allocate<real>(dm_device, "accel_save_u", "saved uvel for MSA",        {nz,nens}, {"z","nens"} );
+  pam_register_and_allocate<real>(dm_device, "accel_save_v", "saved vvel for MSA",        {nz,nens}, {"z","nens"} );
   //------------------------------------------------------------------------------------------------
 }
 
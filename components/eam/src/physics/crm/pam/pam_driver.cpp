@@ -19,6 +19,7 @@
 #include "scream_cxx_interface_finalize.h"
 
 #include "pam_hyperdiffusion.h"
+#include "pam_session.h"
 
 // Needed for p3_init
 #include "p3_functions.hpp"
@@ -62,27 +63,25 @@ extern "C" void pam_driver() {
   coupler.set_option<real>("sponge_time_scale",60);        // minimum damping timescale at top
   coupler.set_option<bool>("crm_acceleration_ceaseflag",false);
   //------------------------------------------------------------------------------------------------
-  // Allocate the coupler state and retrieve host/device data managers
-  coupler.allocate_coupler_state( crm_nz , crm_ny , crm_nx , nens );
-
-  // set up the grid - this needs to happen before initializing coupler objects
-  pam_state_set_grid(coupler);
+  // Allocate the coupler state and create the module objects, unless they persist from a previous call
+  bool verbose = is_first_step || is_restart;
+  auto &session = pam_session_get();
+  if (session.initialized) {
+    pam_session_check(coupler);
+    // the vertical grid follows the GCM interface heights, so it is updated at every call
+    pam_state_set_grid(coupler);
+  } else {
+    pam_session_create(coupler, verbose);
+  }
+  auto &micro  = *session.micro;
+  auto &sgs    = *session.sgs;
+  auto &dycore = *session.dycore;
+  auto &rad    = *session.rad;
   //------------------------------------------------------------------------------------------------
   // get seperate data manager objects for host and device
   auto &dm_device = coupler.get_data_manager_device_readwrite();
   auto &dm_host   = coupler.get_data_manager_host_readwrite();
   //------------------------------------------------------------------------------------------------
-  // Create objects for dycor, microphysics, and turbulence and initialize them
-  bool verbose = is_first_step || is_restart;
-  Microphysics micro;
-  SGS          sgs;
-  Dycore       dycore;
-  Radiation    rad;
-  micro .init(coupler);
-  sgs   .init(coupler);
-  dycore.init(coupler,verbose); // pass is_first_step to control verbosity in PAM-C
-  rad   .init(coupler);
-  //------------------------------------------------------------------------------------------------
   // update coupler GCM state with input GCM state
   pam_state_update_gcm_state(coupler);
 
@@ -252,15 +251,19 @@ extern "C" void pam_driver() {
 
   //------------------------------------------------------------------------------------------------
   // Finalize and clean up
-  micro .finalize(coupler);
-  sgs   .finalize(coupler);
-  dycore.finalize(coupler);
-  rad   .finalize(coupler);
-  pam_interface::finalize();
+  if (enable_persistent_session) {
+    // Keep the coupler state and module objects for the next GCM step, and only
+    // release the GCM arrays mirrored from Fortran, which are registered again next call
+    dm_host.finalize();
+  } else {
+    pam_session_finalize(coupler);
+  }
   //------------------------------------------------------------------------------------------------
 }
 
 extern "C" void pam_finalize() {
+  // release the persistent session (no-op if sessions are not persistent)
+  pam_session_finalize( pam_interface::get_coupler() );
   #if defined(P3_CXX) || defined(SHOC_CXX)
   pam::deallocate_scream_cxx_globals();
   // if using SL tracer advection then COMPOSE will call Kokkos::finalize(), otherwise, call it here
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_register.h"
 
 // These routines are only called once at the end of the CRM call
 // to provide the tendencies and fields to couple the CRM and GCM
@@ -77,12 +78,12 @@ inline void pam_feedback_compute_tendencies( pam::PamCoupler &coupler , real gcm
   });
   //------------------------------------------------------------------------------------------------
   // Create arrays to hold the feedback tendencies
-  dm_device.register_and_allocate<real>("crm_feedback_tend_uvel", "feedback tendency of uvel", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("crm_feedback_tend_vvel", "feedback tendency of vvel", {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("crm_feedback_tend_dse" , "feedback tendency of dse",  {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("crm_feedback_tend_qv"  , "feedback tendency of qv",   {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("crm_feedback_tend_qc"  , "feedback tendency of qc",   {gcm_nlev,nens},{"gcm_lev","nens"});
-  dm_device.register_and_allocate<real>("crm_feedback_tend_qi"  , "feedback tendency of qi",   {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_uvel", "feedback tendency of uvel", {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_vvel", "feedback tendency of vvel", {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_dse" , "feedback tendency of dse",  {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_qv"  , "feedback tendency of qv",   {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_qc"  , "feedback tendency of qc",   {gcm_nlev,nens},{"gcm_lev","nens"});
+  pam_register_and_allocate<real>(dm_device, "crm_feedback_tend_qi"  , "feedback tendency of qi",   {gcm_nlev,nens},{"gcm_lev","nens"});
   auto crm_feedback_tend_uvel = dm_device.get<real,2>("crm_feedback_tend_uvel");
   auto crm_feedback_tend_vvel = dm_device.get<real,2>("crm_feedback_tend_vvel");
   auto crm_feedback_tend_dse  = dm_device.get<real,2>("crm_feedback_tend_dse");
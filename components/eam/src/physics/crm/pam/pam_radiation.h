@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_register.h"
 
 // Copy the CRM radiation tendencies into the PAM coupler
 inline void pam_radiation_copy_input_to_coupler( pam::PamCoupler &coupler ) {
@@ -30,11 +31,9 @@ inline void pam_radiation_copy_input_to_coupler( pam::PamCoupler &coupler ) {
 }
 
 
-// register and initialize various quantities for radiation
-inline void pam_radiation_init( pam::PamCoupler &coupler ) {
-  using yakl::c::parallel_for;
-  using yakl::c::SimpleBounds;
-  using yakl::atomicAdd;
+// register the aggregated quantities for radiation - called when the PAM session is
+// created (see pam_session.h), so only once with a persistent session
+inline void pam_radiation_register( pam::PamCoupler &coupler ) {
   auto &dm = coupler.get_data_manager_device_readwrite();
   auto nens   = coupler.get_option<int>("ncrms");
   auto nz     = coupler.get_option<int>("crm_nz");
@@ -56,14 +55,28 @@ inline void pam_radiation_init( pam::PamCoupler &coupler ) {
   coupler.set_option<real>("rad_ny_fac",rad_ny_fac);
   //------------------------------------------------------------------------------------------------
   // register aggregted quantities
-  dm.register_and_allocate<real>("rad_aggregation_cnt","number of aggregated samples",{nens},{"nens"});
-  dm.register_and_allocate<real>("rad_temperature","rad column mean temperature",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qv"         ,"rad column mean water vapor",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qc"         ,"rad column mean cloud liq amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_qi"         ,"rad column mean cloud ice amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_nc"         ,"rad column mean cloud liq number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_ni"         ,"rad column mean cloud ice number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
-  dm.register_and_allocate<real>("rad_cld"        ,"rad column mean cloud fraction",   {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_aggregation_cnt","number of aggregated samples",{nens},{"nens"});
+  pam_register_and_allocate<real>(dm, "rad_temperature","rad column mean temperature",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_qv"         ,"rad column mean water vapor",      {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_qc"         ,"rad column mean cloud liq amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_qi"         ,"rad column mean cloud ice amount", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_nc"         ,"rad column mean cloud liq number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_ni"         ,"rad column mean cloud ice number", {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  pam_register_and_allocate<real>(dm, "rad_cld"        ,"rad column mean cloud fraction",   {nz,rad_ny,rad_nx,nens},{"z","rad_y","rad_x","nens"});
+  //------------------------------------------------------------------------------------------------
+}
+
+
+// initialize the aggregated quantities for radiation - they are summed over the CRM steps of
+// one GCM step, so they must be reset at every call
+inline void pam_radiation_init( pam::PamCoupler &coupler ) {
+  using yakl::c::parallel_for;
+  using yakl::c::SimpleBounds;
+  auto &dm = coupler.get_data_manager_device_readwrite();
+  auto nens   = coupler.get_option<int>("ncrms");
+  auto nz     = coupler.get_option<int>("crm_nz");
+  auto rad_ny = coupler.get_option<int>("rad_ny");
+  auto rad_nx = coupler.get_option<int>("rad_nx");
   //------------------------------------------------------------------------------------------------
   // initialize aggregted quantities
   auto rad_aggregation_cnt = dm.get<real,1>("rad_aggregation_cnt");
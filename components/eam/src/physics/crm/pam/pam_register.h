@@ -0,0 +1,16 @@
+#pragma once
+
+#include "pam_coupler.h"
+
+// Register and allocate an array in a PAM data manager, unless an entry with the
+// same name already exists. With a persistent session (see pam_session.h) the
+// device data manager is kept across GCM steps, so the per-step setup routines
+// must not register their arrays a second time. Callers are expected to
+// initialize the data themselves, as they already do for fresh arrays.
+template <class T, class DM>
+inline void pam_register_and_allocate( DM &dm, std::string const &name, std::string const &desc,
+                                       std::vector<int> const &dims, std::vector<std::string> const &dim_names ) {
+  if (!dm.entry_exists(name)) {
+    dm.template register_and_allocate<T>( name, desc, dims, dim_names );
+  }
+}
@@ -0,0 +1,114 @@
+#pragma once
+
+#include "pam_coupler.h"
+#include "pam_interface.h"
+#include "Dycore.h"
+#include "Microphysics.h"
+#include "SGS.h"
+#include "radiation.h"
+#include "pam_state.h"
+#include "pam_radiation.h"
+#include "pam_statistics.h"
+#include <memory>
+
+// The PAM "session" holds the module objects (and, in persistent mode, the coupler
+// state) used by pam_driver().
+//
+// By default a new session is created and torn down on every call, as before.
+// When MMF_PAM_PERSISTENT_SESSION is defined (configure -pam_persistent_session,
+// see the eam-mmf_pam_session testmod), the coupler state, the device data
+// manager and the module objects are created and initialized on the first call
+// and reused for all subsequent GCM steps; only the GCM input/output arrays
+// mirrored by the Fortran side (in the host data manager) are refreshed at each
+// step. The session is released in pam_finalize().
+//
+// The session is sized for the number of CRMs of the first call, and that number
+// must not change afterwards. With CRM load balancing (crm_load_balance.F90) the
+// tasks then swap CRMs instead of moving them, so that each task keeps running as
+// many CRMs as it owns. The PAM modules always run over all the ensembles of the
+// coupler state, so a session sized for more CRMs than are run would spend the
+// time of a full CRM on each unused ensemble.
+#ifdef MMF_PAM_PERSISTENT_SESSION
+bool constexpr enable_persistent_session = true;
+#else
+bool constexpr enable_persistent_session = false;
+#endif
+
+struct PamSession {
+  bool initialized = false;
+  int nens   = -1;
+  int crm_nz = -1;
+  int crm_ny = -1;
+  int crm_nx = -1;
+  std::unique_ptr<Microphysics> micro;
+  std::unique_ptr<SGS>          sgs;
+  std::unique_ptr<Dycore>       dycore;
+  std::unique_ptr<Radiation>    rad;
+};
+
+
+inline PamSession &pam_session_get() {
+  static PamSession session;
+  return session;
+}
+
+
+// Allocate the coupler state and create and initialize the module objects
+inline void pam_session_create( pam::PamCoupler &coupler, bool verbose ) {
+  auto &session  = pam_session_get();
+  session.nens   = coupler.get_option<int>("ncrms");
+  session.crm_nz = coupler.get_option<int>("crm_nz");
+  session.crm_ny = coupler.get_option<int>("crm_ny");
+  session.crm_nx = coupler.get_option<int>("crm_nx");
+  //------------------------------------------------------------------------------------------------
+  // Allocate the coupler state
+  coupler.allocate_coupler_state( session.crm_nz , session.crm_ny , session.crm_nx , session.nens );
+  //------------------------------------------------------------------------------------------------
+  // set up the grid - this needs to happen before initializing coupler objects
+  pam_state_set_grid(coupler);
+  //------------------------------------------------------------------------------------------------
+  // Create objects for dycor, microphysics, and turbulence and initialize them
+  session.micro  = std::make_unique<Microphysics>();
+  session.sgs    = std::make_unique<SGS>();
+  session.dycore = std::make_unique<Dycore>();
+  session.rad    = std::make_unique<Radiation>();
+  session.micro ->init(coupler);
+  session.sgs   ->init(coupler);
+  session.dycore->init(coupler,verbose); // pass is_first_step to control verbosity in PAM-C
+  session.rad   ->init(coupler);
+  //------------------------------------------------------------------------------------------------
+  // Register the arrays that aggregate radiation and output statistics over the CRM steps
+  pam_radiation_register(coupler);
+  pam_statistics_register(coupler);
+  session.initialized = true;
+}
+
+
+// Make sure that a persistent session can be reused with the current coupler options
+inline void pam_session_check( pam::PamCoupler &coupler ) {
+  auto &session = pam_session_get();
+  if ( session.nens   != coupler.get_option<int>("ncrms")  ||
+       session.crm_nz != coupler.get_option<int>("crm_nz") ||
+       session.crm_ny != coupler.get_option<int>("crm_ny") ||
+       session.crm_nx != coupler.get_option<int>("crm_nx") ) {
+    std::cout << "ERROR: pam_session_check: CRM dimensions changed across calls with a persistent PAM session\n";
+    exit(-1);
+  }
+}
+
+
+// Finalize the module objects and the coupler
+inline void pam_session_finalize( pam::PamCoupler &coupler ) {
+  auto &session = pam_session_get();
+  if (!session.initialized) { return; }
+  session.micro ->finalize(coupler);
+  session.sgs   ->finalize(coupler);
+  session.dycore->finalize(coupler);
+  session.rad   ->finalize(coupler);
+  session.micro .reset();
+  session.sgs   .reset();
+  session.dycore.reset();
+  session.rad   .reset();
+  session.initialized = false;
+  pam_interface::finalize();
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "pam_coupler.h"
+#include "pam_register.h"
 #include "saturation_adjustment.h"
 
 // These routines are used to encapsulate the aggregation
@@ -10,69 +11,78 @@
 real constexpr cld_threshold = .001; // condensate thresdhold for diagnostic cloud fraction
 
 
-// register and initialize various quantities for statistical calculations
-inline void pam_statistics_init( pam::PamCoupler &coupler ) {
-  using yakl::c::parallel_for;
-  using yakl::c::SimpleBounds;
-  using yakl::atomicAdd;
+// register the aggregated quantities for statistical calculations - called when the PAM
+// session is created (see pam_session.h), so only once with a persistent session
+inline void pam_statistics_register( pam::PamCoupler &coupler ) {
   auto &dm_device = coupler.get_data_manager_device_readwrite();
-  auto &dm_host   = coupler.get_data_manager_host_readwrite();
   auto nens       = coupler.get_option<int>("ncrms");
   auto nz         = coupler.get_option<int>("crm_nz");
   auto ny         = coupler.get_option<int>("crm_ny");
   auto nx         = coupler.get_option<int>("crm_nx");
   //------------------------------------------------------------------------------------------------
   // aggregated quantities
-  dm_device.register_and_allocate<real>("stat_aggregation_cnt",       "number of aggregated samples",  {nens},{"nens"});
-  dm_device.register_and_allocate<real>("precip_liq_aggregated",      "aggregated sfc liq precip rate",{nens},{"nens"});
-  dm_device.register_and_allocate<real>("precip_ice_aggregated",      "aggregated sfc ice precip rate",{nens},{"nens"});
-  dm_device.register_and_allocate<real>("liqwp_aggregated",           "aggregated liquid water path",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("icewp_aggregated",           "aggregated ice water path",     {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("liq_ice_exchange_aggregated","aggregated liq_ice_exchange",   {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("vap_liq_exchange_aggregated","aggregated vap_liq_exchange",   {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("vap_ice_exchange_aggregated","aggregated vap_ice_exchange",   {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("rho_v_forcing_aggregated",   "aggregated rho_v_forcing",      {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("rho_l_forcing_aggregated",   "aggregated rho_l_forcing",      {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("rho_i_forcing_aggregated",   "aggregated rho_i_forcing",      {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("cldfrac_aggregated",         "aggregated cloud fraction",     {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("clear_rh"       ,            "clear air rel humidity",        {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("clear_rh_cnt"   ,            "clear air count",               {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "stat_aggregation_cnt",       "number of aggregated samples",  {nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "precip_liq_aggregated",      "aggregated sfc liq precip rate",{nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "precip_ice_aggregated",      "aggregated sfc ice precip rate",{nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "liqwp_aggregated",           "aggregated liquid water path",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "icewp_aggregated",           "aggregated ice water path",     {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "liq_ice_exchange_aggregated","aggregated liq_ice_exchange",   {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "vap_liq_exchange_aggregated","aggregated vap_liq_exchange",   {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "vap_ice_exchange_aggregated","aggregated vap_ice_exchange",   {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "rho_v_forcing_aggregated",   "aggregated rho_v_forcing",      {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "rho_l_forcing_aggregated",   "aggregated rho_l_forcing",      {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "rho_i_forcing_aggregated",   "aggregated rho_i_forcing",      {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "cldfrac_aggregated",         "aggregated cloud fraction",     {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "clear_rh"       ,            "clear air rel humidity",        {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "clear_rh_cnt"   ,            "clear air count",               {nz,nens},{"z","nens"});
   //------------------------------------------------------------------------------------------------
   // aggregated physics tendencies
   // temporary state variables
-  dm_device.register_and_allocate<real>("phys_tend_save_temp",  "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("phys_tend_save_qv",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("phys_tend_save_qc",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("phys_tend_save_qi",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
-  dm_device.register_and_allocate<real>("phys_tend_save_qr",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  pam_register_and_allocate<real>(dm_device, "phys_tend_save_temp",  "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  pam_register_and_allocate<real>(dm_device, "phys_tend_save_qv",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  pam_register_and_allocate<real>(dm_device, "phys_tend_save_qc",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  pam_register_and_allocate<real>(dm_device, "phys_tend_save_qi",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
+  pam_register_and_allocate<real>(dm_device, "phys_tend_save_qr",    "saved state for tendency", {nz,ny,nx,nens}, {"z","y","x","nens"} );
   // SGS tendencies
-  dm_device.register_and_allocate<real>("phys_tend_sgs_cnt",   "count for aggregated SGS tendency ",  {nens},{"nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sgs_temp",  "aggregated temperature tend from SGS",{nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sgs_qv",    "aggregated qv tend from SGS",         {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sgs_qc",    "aggregated qc tend from SGS",         {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sgs_qi",    "aggregated qi tend from SGS",         {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sgs_qr",    "aggregated qr tend from SGS",         {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_cnt",   "count for aggregated SGS tendency ",  {nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_temp",  "aggregated temperature tend from SGS",{nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_qv",    "aggregated qv tend from SGS",         {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_qc",    "aggregated qc tend from SGS",         {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_qi",    "aggregated qi tend from SGS",         {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sgs_qr",    "aggregated qr tend from SGS",         {nz,nens},{"z","nens"});
   // micro tendencies
-  dm_device.register_and_allocate<real>("phys_tend_micro_cnt", "count for aggregated micro tendency ",  {nens},{"nens"});
-  dm_device.register_and_allocate<real>("phys_tend_micro_temp","aggregated temperature tend from micro",{nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_micro_qv",  "aggregated qv tend from microphysics",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_micro_qc",  "aggregated qc tend from microphysics",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_micro_qi",  "aggregated qi tend from microphysics",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_micro_qr",  "aggregated qr tend from microphysics",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_cnt", "count for aggregated micro tendency ",  {nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_temp","aggregated temperature tend from micro",{nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_qv",  "aggregated qv tend from microphysics",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_qc",  "aggregated qc tend from microphysics",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_qi",  "aggregated qi tend from microphysics",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_micro_qr",  "aggregated qr tend from microphysics",  {nz,nens},{"z","nens"});
   // dycor tendencies
-  dm_device.register_and_allocate<real>("phys_tend_dycor_cnt", "count for aggregated dycor tendency ",  {nens},{"nens"});
-  dm_device.register_and_allocate<real>("phys_tend_dycor_temp","aggregated temperature tend from dycor",{nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_dycor_qv",  "aggregated qv tend from dycor",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_dycor_qc",  "aggregated qc tend from dycor",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_dycor_qi",  "aggregated qi tend from dycor",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_dycor_qr",  "aggregated qi tend from dycor",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_cnt", "count for aggregated dycor tendency ",  {nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_temp","aggregated temperature tend from dycor",{nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_qv",  "aggregated qv tend from dycor",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_qc",  "aggregated qc tend from dycor",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_qi",  "aggregated qi tend from dycor",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_dycor_qr",  "aggregated qi tend from dycor",  {nz,nens},{"z","nens"});
   // sponge layer tendencies
-  dm_device.register_and_allocate<real>("phys_tend_sponge_cnt", "count for aggregated sponge tendency ",  {nens},{"nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sponge_temp","aggregated temperature tend from sponge",{nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sponge_qv",  "aggregated qv tend from sponge",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sponge_qc",  "aggregated qc tend from sponge",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sponge_qi",  "aggregated qi tend from sponge",  {nz,nens},{"z","nens"});
-  dm_device.register_and_allocate<real>("phys_tend_sponge_qr",  "aggregated qi tend from sponge",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_cnt", "count for aggregated sponge tendency ",  {nens},{"nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_temp","aggregated temperature tend from sponge",{nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_qv",  "aggregated qv tend from sponge",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_qc",  "aggregated qc tend from sponge",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_qi",  "aggregated qi tend from sponge",  {nz,nens},{"z","nens"});
+  pam_register_and_allocate<real>(dm_device, "phys_tend_sponge_qr",  "aggregated qi tend from sponge",  {nz,nens},{"z","nens"});
+  //------------------------------------------------------------------------------------------------
+}
+
+
+// initialize the aggregated quantities for statistical calculations - they are summed over
+// the CRM steps of one GCM step, so they must be reset at every call
+inline void pam_statistics_init( pam::PamCoupler &coupler ) {
+  using yakl::c::parallel_for;
+  using yakl::c::SimpleBounds;
+  auto &dm_device = coupler.get_data_manager_device_readwrite();
+  auto nens       = coupler.get_option<int>("ncrms");
+  auto nz         = coupler.get_option<int>("crm_nz");
   //------------------------------------------------------------------------------------------------
   auto stat_aggregation_cnt        = dm_device.get<real,1>("stat_aggregation_cnt");
   auto precip_liq_aggregated       = dm_device.get<real,1>("precip_liq_aggregated");
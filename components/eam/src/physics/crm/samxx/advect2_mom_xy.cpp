@@ -1,6 +1,14 @@
 #include "advect2_mom_xy.h"
+#include "advect_packed.h"
 
 void advect2_mom_xy() {
+#ifdef SAMXX_USE_PACKED_KERNELS
+  if (use_packed_kernels) {
+    advect2_mom_xy_packed();
+    return;
+  }
+#endif
+
   YAKL_SCOPE( dx             , :: dx);
   YAKL_SCOPE( dy             , :: dy);
   YAKL_SCOPE( rhow           , :: rhow); 
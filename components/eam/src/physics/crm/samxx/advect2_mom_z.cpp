@@ -1,4 +1,5 @@
 #include "advect2_mom_z.h"
+#include "samxx_scratch.h"
 
 void advect2_mom_z() {
 
@@ -18,9 +19,10 @@ void advect2_mom_z() {
   YAKL_SCOPE( adzw           , :: adzw);
   YAKL_SCOPE( ncrms          , :: ncrms);
 
-  real4d fuz("fuz",nz ,ny,nx,ncrms);
-  real4d fvz("fvz",nz ,ny,nx,ncrms);
-  real4d fwz("fwz",nzm,ny,nx,ncrms);
+  ScratchScope scratch_scope;
+  real4d fuz = scratch_real4d("fuz",nz ,ny,nx,ncrms);
+  real4d fvz = scratch_real4d("fvz",nz ,ny,nx,ncrms);
+  real4d fwz = scratch_real4d("fwz",nzm,ny,nx,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //       for (int icrm=0; icrm<ncrms; icrm++) {
@@ -1,13 +1,15 @@
 #include "advect_all_scalars.h"
+#include "samxx_scratch.h"
 
 void advect_all_scalars() {
 
-  real2d dummy("dummy",nz,ncrms);
-  real1d esmt_offset("esmt_offset", ncrms);
+  ScratchScope scratch_scope;
+  real2d dummy = scratch_real2d("dummy",nz,ncrms);
+  real1d esmt_offset = scratch_real1d("esmt_offset", ncrms);
   YAKL_SCOPE( u_esmt  , :: u_esmt);
   YAKL_SCOPE( v_esmt  , :: v_esmt);
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real1d esmt_min("esmt_min",ncrms);
+  real1d esmt_min = scratch_real1d("esmt_min",ncrms);
   yakl::memset(esmt_min,1.0e20);
 
   // advection of scalars :
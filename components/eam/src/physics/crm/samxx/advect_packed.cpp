@@ -0,0 +1,448 @@
+
+#include "advect_packed.h"
+
+#ifdef SAMXX_USE_PACKED_KERNELS
+
+#if defined(YAKL_ARCH_CUDA) || defined(YAKL_ARCH_HIP) || defined(YAKL_ARCH_SYCL)
+  #error "SAMXX_USE_PACKED_KERNELS is only available for CPU builds"
+#endif
+
+#include "advect_scalar3D.h"
+#include <algorithm>
+#include <vector>
+
+#if defined(_OPENMP) || defined(SAMXX_OMP_SIMD)
+  #define SAMXX_SIMD _Pragma("omp simd")
+#else
+  #define SAMXX_SIMD
+#endif
+
+bool use_packed_kernels = true;
+
+namespace {
+  // (j,i) tile: tile_j rows of tile_i points of pack_size lanes
+  int constexpr tile_j = 4;
+  int constexpr tile_i = 16;
+
+  // One pack of CRMs of a (k,j,i,icrm) array, indexed as (k,j,i,lane)
+  struct Pack3d {
+    real *data;
+    int n1, n2;
+    real &operator()(int k, int j, int i, int l) const { return data[((size_t)(k*n1+j)*n2+i)*pack_size+l]; }
+    static size_t size(int n0, int n1, int n2) { return (size_t)n0*n1*n2*pack_size; }
+  };
+
+  // One pack of CRMs of a (k,icrm) array, indexed as (k,lane)
+  struct Pack1d {
+    real *data;
+    real &operator()(int k, int l) const { return data[k*pack_size+l]; }
+    static size_t size(int n0) { return (size_t)n0*pack_size; }
+  };
+
+  // Per-thread work space, kept across calls
+  real *pack_workspace(size_t n) {
+    static thread_local std::vector<real> buf;
+    if (buf.size() < n) { buf.resize(n); }
+    return buf.data();
+  }
+
+  // Loop over (k,j,i) in (j,i) tiles, with the lanes innermost
+  template <class F> inline void pack_for(int nk, int nj, int ni, F const &f) {
+    for (int k=0; k<nk; k++) {
+      for (int jj=0; jj<nj; jj+=tile_j) {
+        for (int ii=0; ii<ni; ii+=tile_i) {
+          int const jend = std::min(nj, jj+tile_j);
+          int const iend = std::min(ni, ii+tile_i);
+          for (int j=jj; j<jend; j++) {
+            for (int i=ii; i<iend; i++) {
+              SAMXX_SIMD for (int l=0; l<pack_size; l++) { f(k,j,i,l); }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Copy CRMs icrm0 ... icrm0+pack_size-1 into a pack. Lanes past ncrms repeat the last CRM.
+  void pack_in(real4d const &a, int icrm0, Pack3d const &p, int n0, int n1, int n2) {
+    int const nl = std::min(pack_size, ncrms-icrm0);
+    for (int k=0; k<n0; k++) {
+      for (int j=0; j<n1; j++) {
+        for (int i=0; i<n2; i++) {
+          real const *src = &a(k,j,i,icrm0);
+          for (int l=0; l<pack_size; l++) { p(k,j,i,l) = src[std::min(l,nl-1)]; }
+        }
+      }
+    }
+  }
+
+  void pack_in(real2d const &a, int icrm0, Pack1d const &p, int n0) {
+    int const nl = std::min(pack_size, ncrms-icrm0);
+    for (int k=0; k<n0; k++) {
+      for (int l=0; l<pack_size; l++) { p(k,l) = a(k,icrm0+std::min(l,nl-1)); }
+    }
+  }
+
+  void pack_out(Pack3d const &p, real4d const &a, int icrm0, int n0, int n1, int n2) {
+    int const nl = std::min(pack_size, ncrms-icrm0);
+    for (int k=0; k<n0; k++) {
+      for (int j=0; j<n1; j++) {
+        for (int i=0; i<n2; i++) {
+          real *dst = &a(k,j,i,icrm0);
+          for (int l=0; l<nl; l++) { dst[l] = p(k,j,i,l); }
+        }
+      }
+    }
+  }
+
+  // All the stages of advect_scalar3D for CRMs icrm0 ... icrm0+pack_size-1
+  void advect_scalar3D_pack(real4d &f, real2d &flux, int icrm0) {
+    bool constexpr nonos    = true;
+    real constexpr eps      = 1.0e-10;
+    int  constexpr offx_m   = 1;
+    int  constexpr offy_m   = 1;
+    int  constexpr offx_uuu = 2;
+    int  constexpr offy_uuu = 2;
+    int  constexpr offx_vvv = 2;
+    int  constexpr offy_vvv = 2;
+    int  constexpr offx_www = 2;
+    int  constexpr offy_www = 2;
+
+    size_t const size = Pack3d::size(nzm,dimy_s,dimx_s) + Pack3d::size(nzm,dimy_u,dimx_u) +
+                        Pack3d::size(nzm,dimy_v,dimx_v) + Pack3d::size(nz ,dimy_w,dimx_w) +
+                        2*Pack3d::size(nzm,ny+2,nx+2)   + Pack3d::size(nzm,ny+4,nx+5) +
+                        Pack3d::size(nzm,ny+5,nx+4)     + Pack3d::size(nz ,ny+4,nx+4) +
+                        6*Pack1d::size(nz);
+    real *ws = pack_workspace(size);
+    Pack3d fp   = {ws, dimy_s, dimx_s};  ws += Pack3d::size(nzm,dimy_s,dimx_s);
+    Pack3d up   = {ws, dimy_u, dimx_u};  ws += Pack3d::size(nzm,dimy_u,dimx_u);
+    Pack3d vp   = {ws, dimy_v, dimx_v};  ws += Pack3d::size(nzm,dimy_v,dimx_v);
+    Pack3d wp   = {ws, dimy_w, dimx_w};  ws += Pack3d::size(nz ,dimy_w,dimx_w);
+    Pack3d mx   = {ws, ny+2  , nx+2  };  ws += Pack3d::size(nzm,ny+2  ,nx+2  );
+    Pack3d mn   = {ws, ny+2  , nx+2  };  ws += Pack3d::size(nzm,ny+2  ,nx+2  );
+    Pack3d uuu  = {ws, ny+4  , nx+5  };  ws += Pack3d::size(nzm,ny+4  ,nx+5  );
+    Pack3d vvv  = {ws, ny+5  , nx+4  };  ws += Pack3d::size(nzm,ny+5  ,nx+4  );
+    Pack3d www  = {ws, ny+4  , nx+4  };  ws += Pack3d::size(nz ,ny+4  ,nx+4  );
+    Pack1d rho  = {ws};  ws += Pack1d::size(nz);
+    Pack1d adz  = {ws};  ws += Pack1d::size(nz);
+    Pack1d rhow = {ws};  ws += Pack1d::size(nz);
+    Pack1d irho = {ws};  ws += Pack1d::size(nz);
+    Pack1d iadz = {ws};  ws += Pack1d::size(nz);
+    Pack1d irhow= {ws};  ws += Pack1d::size(nz);
+
+    pack_in(f   , icrm0, fp, nzm, dimy_s, dimx_s);
+    pack_in(::u , icrm0, up, nzm, dimy_u, dimx_u);
+    pack_in(::v , icrm0, vp, nzm, dimy_v, dimx_v);
+    pack_in(::w , icrm0, wp, nz , dimy_w, dimx_w);
+    pack_in(::rho , icrm0, rho , nzm);
+    pack_in(::adz , icrm0, adz , nzm);
+    pack_in(::rhow, icrm0, rhow, nz );
+
+    // Column sums are accumulated in the same (j,i) order as advect_scalar3D
+    real flx[nzm][pack_size];
+    for (int k=0; k<nzm; k++) {
+      for (int l=0; l<pack_size; l++) { flx[k][l] = 0.0; }
+    }
+    auto sum_www = [&] (int off) {
+      for (int k=0; k<nzm; k++) {
+        for (int j=0; j<ny; j++) {
+          for (int i=0; i<nx; i++) {
+            SAMXX_SIMD for (int l=0; l<pack_size; l++) { flx[k][l] += www(k,j+off,i+off,l); }
+          }
+        }
+      }
+    };
+
+    pack_for(1, ny+4, nx+4, [&] (int k, int j, int i, int l) {
+      www(nz-1,j,i,l)=0.0;
+    });
+
+    if (nonos) {
+      pack_for(nzm, ny+2, nx+2, [&] (int k, int j, int i, int l) {
+        int kc=std::min(nzm-1,k+1);
+        int kb=std::max(0,k-1);
+        int jb=j-1;
+        int jc=j+1;
+        int ib=i-1;
+        int ic=i+1;
+        mx(k,j,i,l) =
+             max(fp(k,j+offy_s-1,ib+offx_s-1,l),max(fp(k,j+offy_s-1,ic+offx_s-1,l),
+             max(fp(k,jb+offy_s-1,i+offx_s-1,l),max(fp(k,jc+offy_s-1,i+offx_s-1,l),
+             max(fp(kb,j+offy_s-1,i+offx_s-1,l),max(fp(kc,j+offy_s-1,i+offx_s-1,l),fp(k,j+offy_s-1,i+offx_s-1,l)))))));
+        mn(k,j,i,l) =
+             min(fp(k,j+offy_s-1,ib+offx_s-1,l),min(fp(k,j+offy_s-1,ic+offx_s-1,l),
+             min(fp(k,jb+offy_s-1,i+offx_s-1,l),min(fp(k,jc+offy_s-1,i+offx_s-1,l),
+             min(fp(kb,j+offy_s-1,i+offx_s-1,l),min(fp(kc,j+offy_s-1,i+offx_s-1,l),fp(k,j+offy_s-1,i+offx_s-1,l)))))));
+      });
+    }
+
+    pack_for(nzm, ny+5, nx+5, [&] (int k, int j, int i, int l) {
+      int kb=std::max(0,k-1);
+      if (j <= ny+3){
+        uuu(k,j,i,l)=max(0.0,up(k,j,i,l))*fp(k,j+offy_s-2,i-1+offx_s-2,l)+
+                     min(0.0,up(k,j,i,l))*fp(k,j+offy_s-2,i+offx_s-2,l);
+      }
+      if (i <= nx+3) {
+        vvv(k,j,i,l)=max(0.0,vp(k,j,i,l))*fp(k,j-1+offy_s-2,i+offx_s-2,l)+
+                     min(0.0,vp(k,j,i,l))*fp(k,j+offx_s-2,i+offy_s-2,l);
+      }
+      if (i <= nx+3 && j <= ny+3) {
+        www(k,j,i,l)=max(0.0,wp(k,j,i,l))*fp(kb,j+offy_s-2,i+offx_s-2,l)+
+                     min(0.0,wp(k,j,i,l))*fp(k,j+offy_s-2,i+offx_s-2,l);
+      }
+    });
+
+    for (int k=0; k<nzm; k++) {
+      for (int l=0; l<pack_size; l++) {
+        irho(k,l) = 1.0/rho(k,l);
+        iadz(k,l) = 1.0/adz(k,l);
+        irhow(k,l) = 1.0/(rhow(k,l)*adz(k,l));
+      }
+    }
+
+    sum_www(2);
+
+    pack_for(nzm, ny+4, nx+4, [&] (int k, int j, int i, int l) {
+      fp(k,j+offy_s-2,i+offy_s-2,l)=fp(k,j+offy_s-2,i+offx_s-2,l)-( uuu(k,j,i+1,l)-uuu(k,j,i,l) +
+                                    vvv(k,j+1,i,l)-vvv(k,j,i,l)
+                                    +(www(k+1,j,i,l)-www(k,j,i,l) )*iadz(k,l))*irho(k,l);
+    });
+
+    pack_for(nzm, ny+3, nx+3, [&] (int k, int j, int i, int l) {
+      if (j <= ny+1) {
+        int kc=std::min(nzm-1,k+1);
+        int kb=std::max(0,k-1);
+        real dd=2.0/(kc-kb)/adz(k,l);
+        int jb=j-1;
+        int jc=j+1;
+        int ib=i-1;
+        uuu(k,j+offy_uuu-1,i+offx_uuu-1,l) =
+             andiff(fp(k,j+offy_s-1,ib+offx_s-1,l),fp(k,j+offy_s-1,i+offx_s-1,l),up(k,j+offy_u-1,i+offx_u-1,l),irho(k,l))-
+            (across(fp(k,jc+offy_s-1,ib+offx_s-1,l)+fp(k,jc+offy_s-1,i+offx_s-1,l)-fp(k,jb+offy_s-1,ib+offx_s-1,l)-
+                    fp(k,jb+offy_s-1,i+offx_s-1,l),up(k,j+offy_u-1,i+offx_u-1,l), vp(k,j+offy_v-1,ib+offx_v-1,l)+
+                    vp(k,jc+offy_v-1,ib+offx_v-1,l)+vp(k,jc+offy_v-1,i+offx_v-1,l)+vp(k,j+offy_v-1,i+offx_v-1,l))+
+             across(dd*(fp(kc,j+offy_s-1,ib+offx_s-1,l)+fp(kc,j+offy_s-1,i+offx_s-1,l)-fp(kb,j+offy_s-1,ib+offx_s-1,l)-
+                    fp(kb,j+offy_s-1,i+offx_s-1,l)),up(k,j+offy_u-1,i+offx_u-1,l), wp(k,j+offy_w-1,ib+offx_w-1,l)+
+                    wp(kc,j+offy_w-1,ib+offx_w-1,l)+wp(k,j+offy_w-1,i+offx_w-1,l)+wp(kc,j+offy_w-1,i+offx_w-1,l))) *irho(k,l);
+      }
+      if (i <= nx+1) {
+        int kc=std::min(nzm-1,k+1);
+        int kb=std::max(0,k-1);
+        real dd=2.0/(kc-kb)/adz(k,l);
+        int jb=j-1;
+        int ib=i-1;
+        int ic=i+1;
+        vvv(k,j+offy_vvv-1,i+offx_vvv-1,l) =
+             andiff(fp(k,jb+offy_s-1,i+offx_s-1,l),fp(k,j+offy_s-1,i+offx_s-1,l),vp(k,j+offy_v-1,i+offx_v-1,l),irho(k,l))-
+             (across(fp(k,jb+offy_s-1,ic+offx_s-1,l)+fp(k,j+offy_s-1,ic+offx_s-1,l)-fp(k,jb+offy_s-1,ib+offx_s-1,l)-
+                     fp(k,j+offy_s-1,ib+offx_s-1,l),vp(k,j+offy_v-1,i+offx_v-1,l), up(k,jb+offy_u-1,i+offx_u-1,l)+
+                     up(k,j+offy_u-1,i+offx_u-1,l)+up(k,j+offy_u-1,ic+offx_u-1,l)+up(k,jb+offy_u-1,ic+offx_u-1,l))+
+              across(dd*(fp(kc,jb+offy_s-1,i+offx_s-1,l)+fp(kc,j+offy_s-1,i+offx_s-1,l)-fp(kb,jb+offy_s-1,i+offx_s-1,l)-
+                     fp(kb,j+offy_s-1,i+offx_s-1,l)),vp(k,j+offy_v-1,i+offx_v-1,l), wp(k,jb+offy_w-1,i+offx_w-1,l)+
+                     wp(k,j+offy_w-1,i+offx_w-1,l)+wp(kc,j+offy_w-1,i+offx_w-1,l)+wp(kc,jb+offy_w-1,i+offx_w-1,l))) *irho(k,l);
+      }
+      if (i <= nx+1 && j <= ny+1) {
+        int kb=std::max(0,k-1);
+        int jb=j-1;
+        int jc=j+1;
+        int ib=i-1;
+        int ic=i+1;
+        www(k,j+offy_www-1,i+offx_www-1,l) =
+             andiff(fp(kb,j+offy_s-1,i+offx_s-1,l),fp(k,j+offy_s-1,i+offx_s-1,l),wp(k,j+offy_w-1,i+offx_w-1,l),irhow(k,l))-
+            (across(fp(kb,j+offy_s-1,ic+offx_s-1,l)+fp(k,j+offy_s-1,ic+offx_s-1,l)-fp(kb,j+offy_s-1,ib+offx_s-1,l)-
+                    fp(k,j+offy_s-1,ib+offx_s-1,l),wp(k,j+offy_w-1,i+offx_w-1,l), up(kb,j+offy_u-1,i+offx_u-1,l)+
+                    up(k,j+offy_u-1,i+offx_u-1,l)+up(k,j+offy_u-1,ic+offx_u-1,l)+up(kb,j+offy_u-1,ic+offx_u-1,l))+
+             across(fp(k,jc+offy_s-1,i+offx_s-1,l)+fp(kb,jc+offy_s-1,i+offx_s-1,l)-fp(k,jb+offy_s-1,i+offx_s-1,l)-
+                    fp(kb,jb+offy_s-1,i+offx_s-1,l),wp(k,j+offy_w-1,i+offx_w-1,l), vp(kb,j+offy_v-1,i+offx_v-1,l)+
+                    vp(kb,jc+offy_v-1,i+offx_v-1,l)+vp(k,jc+offy_v-1,i+offx_v-1,l)+vp(k,j+offy_v-1,i+offx_v-1,l))) *irho(k,l);
+      }
+    });
+
+    pack_for(1, ny+4, nx+4, [&] (int k, int j, int i, int l) {
+      www(0,j,i,l) = 0.0;
+    });
+
+    if (nonos) {
+      pack_for(nzm, ny+2, nx+2, [&] (int k, int j, int i, int l) {
+        int kc=std::min(nzm-1,k+1);
+        int kb=std::max(0,k-1);
+        int jb=j-1;
+        int jc=j+1;
+        int ib=i-1;
+        int ic=i+1;
+        mx(k,j,i,l) =
+            max(fp(k,j+offy_s-1,ib+offx_s-1,l),max(fp(k,j+offy_s-1,ic+offx_s-1,l),max(fp(k,jb+offy_s-1,i+offx_s-1,l),
+            max(fp(k,jc+offy_s-1,i+offx_s-1,l),max(fp(kb,j+offy_s-1,i+offx_s-1,l),max(fp(kc,j+offy_s-1,i+offx_s-1,l),
+            max(fp(k,j+offy_s-1,i+offx_s-1,l),mx(k,j,i,l))))))));
+        mn(k,j,i,l) =
+            min(fp(k,j+offy_s-1,ib+offx_s-1,l),min(fp(k,j+offy_s-1,ic+offx_s-1,l),min(fp(k,jb+offy_s-1,i+offx_s-1,l),
+            min(fp(k,jc+offy_s-1,i+offx_s-1,l),min(fp(kb,j+offy_s-1,i+offx_s-1,l),min(fp(kc,j+offy_s-1,i+offx_s-1,l),
+            min(fp(k,j+offy_s-1,i+offx_s-1,l),mn(k,j,i,l))))))));
+      });
+
+      pack_for(nzm, ny+2, nx+2, [&] (int k, int j, int i, int l) {
+        int kc=std::min(nzm-1,k+1);
+        int jc=j+1;
+        int ic=i+1;
+        mx(k,j,i,l)=rho(k,l)*(mx(k,j,i,l)-fp(k,j+offy_s-1,i+offx_s-1,l))/
+                  ( pn3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,l)) + pp3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,l))+
+                    pn3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,l)) + pp3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,l))+
+                   (pn3(www(kc,j+offy_www-1,i+offx_www-1,l)) + pp3(www(k,j+offy_www-1,i+offx_www-1,l)))*iadz(k,l)+eps);
+        mn(k,j,i,l)=rho(k,l)*(fp(k,j+offy_s-1,i+offx_s-1,l)-mn(k,j,i,l))/
+                  ( pp3(uuu(k,j+offy_uuu-1,ic+offx_uuu-1,l)) + pn3(uuu(k,j+offy_uuu-1,i+offx_uuu-1,l))+
+                    pp3(vvv(k,jc+offy_vvv-1,i+offx_vvv-1,l)) + pn3(vvv(k,j+offy_vvv-1,i+offx_vvv-1,l))+
+                   (pp3(www(kc,j+offy_www-1,i+offx_www-1,l)) + pn3(www(k,j+offy_www-1,i+offx_www-1,l)))*iadz(k,l)+eps);
+      });
+
+      pack_for(nzm, ny+1, nx+1, [&] (int k, int j, int i, int l) {
+        if (j <= ny-1) {
+          int ib=i-1;
+          uuu(k,j+offy_uuu,i+offx_uuu,l) =
+                pp3(uuu(k,j+offy_uuu,i+offx_uuu,l))*min(1.0,min(mx(k,j+offy_m,i+offx_m,l), mn(k,j+offy_m,ib+offx_m,l)))
+               -pn3(uuu(k,j+offy_uuu,i+offx_uuu,l))*min(1.0,min(mx(k,j+offy_m,ib+offx_m,l),mn(k,j+offy_m,i+offx_m,l)));
+        }
+        if (i <= nx-1) {
+          int jb=j-1;
+          vvv(k,j+offy_vvv,i+offx_vvv,l) =
+                pp3(vvv(k,j+offy_vvv,i+offx_vvv,l))*min(1.0,min(mx(k,j+offy_m,i+offx_m,l), mn(k,jb+offy_m,i+offx_m,l)))
+               -pn3(vvv(k,j+offy_vvv,i+offx_vvv,l))*min(1.0,min(mx(k,jb+offy_m,i+offx_m,l),mn(k,j+offy_m,i+offx_m,l)));
+        }
+        if (i <= nx-1 && j <= ny-1) {
+          int kb=std::max(0,k-1);
+          www(k,j+offy_www,i+offx_www,l) =
+                pp3(www(k,j+offy_www,i+offx_www,l))*min(1.0,min(mx(k,j+offy_m,i+offx_m,l), mn(kb,j+offy_m,i+offx_m,l)))
+               -pn3(www(k,j+offy_www,i+offx_www,l))*min(1.0,min(mx(kb,j+offy_m,i+offx_m,l),mn(k,j+offy_m,i+offx_m,l)));
+        }
+      });
+
+      sum_www(offy_www);
+    }
+
+    pack_for(nzm, ny, nx, [&] (int k, int j, int i, int l) {
+      fp(k,j+offy_s,i+offx_s,l) =
+           max(0.0,fp(k,j+offy_s,i+offx_s,l) -(uuu(k,j+offy_uuu,i+offx_uuu+1,l)-uuu(k,j+offy_uuu,i+offx_uuu,l)+
+                   vvv(k,j+offy_vvv+1,i+offx_vvv,l)-vvv(k,j+offy_vvv,i+offx_vvv,l)+(www(k+1,j+offy_www,i+offx_www,l)-
+                   www(k,j+offy_www,i+offx_www,l))*iadz(k,l))*irho(k,l));
+    });
+
+    pack_out(fp, f, icrm0, nzm, dimy_s, dimx_s);
+    int const nl = std::min(pack_size, ncrms-icrm0);
+    for (int k=0; k<nzm; k++) {
+      for (int l=0; l<nl; l++) { flux(k,icrm0+l) = flx[k][l]; }
+    }
+  }
+}
+
+
+void advect_scalar3D_packed(real4d &f, real2d &flux) {
+  int const npacks = (ncrms+pack_size-1)/pack_size;
+#if defined(YAKL_ARCH_OPENMP)
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int ipack=0; ipack<npacks; ipack++) {
+    advect_scalar3D_pack(f, flux, ipack*pack_size);
+  }
+}
+
+
+void advect2_mom_xy_packed() {
+  auto &u    = ::u;
+  auto &v    = ::v;
+  auto &w    = ::w;
+  auto &dudt = ::dudt;
+  auto &dvdt = ::dvdt;
+  auto &dwdt = ::dwdt;
+  auto &rho  = ::rho;
+  auto &adz  = ::adz;
+  auto &rhow = ::rhow;
+  auto &adzw = ::adzw;
+  int const nam1  = na-1;
+  int const ncrms = ::ncrms;
+  real const dx25 = 0.25 / dx;
+  real const dy25 = 0.25 / dy;
+
+  // Each k writes dudt and dvdt at k and dwdt at k+1 only
+#if defined(YAKL_ARCH_OPENMP)
+  #pragma omp parallel for schedule(static)
+#endif
+  for (int k=0; k<nzm; k++) {
+    int kc= k+1;
+    int kcu = std::min(kc, nzm-1);
+    for (int jj=0; jj<ny; jj+=tile_j) {
+      for (int ii=0; ii<nx; ii+=tile_i) {
+        int const jend = std::min(ny, jj+tile_j);
+        int const iend = std::min(nx, ii+tile_i);
+        for (int j=jj; j<jend; j++) {
+          for (int i=ii; i<iend; i++) {
+            int jb = j-1;
+            int jc = j+1;
+            int ib = i-1;
+            int ic = i+1;
+            if (RUN3D) {
+              SAMXX_SIMD for (int icrm=0; icrm<ncrms; icrm++) {
+                real irho = 1.0/(rhow(kc,icrm)*adzw(kc,icrm));
+                real fu1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)+u(k,j+offy_u,i-1+offx_u,icrm))*
+                                (u(k,j+offy_u,i-1+offx_u,icrm)+u(k,j+offy_u,ic-1+offx_u,icrm));
+                real fu2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)+u(k,j+offy_u,i+offx_u,icrm))*
+                                (u(k,j+offy_u,i+offx_u,icrm)+u(k,j+offy_u,ic+offx_u,icrm));
+                dudt(nam1,k,j,i,icrm)  = dudt(nam1,k,j,i,icrm)  - (fu2-fu1);
+                real fv1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)+u(k,jb+offy_u,ic-1+offx_u,icrm))*
+                                (v(k,j+offy_v,i-1+offx_v,icrm)+v(k,j+offy_v,ic-1+offx_v,icrm));
+                real fv2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)+u(k,jb+offy_u,ic+offx_u,icrm))*
+                                (v(k,j+offy_v,i+offx_v,icrm)+v(k,j+offy_v,ic+offx_v,icrm));
+                dvdt(nam1,k,j,i,icrm)  = dvdt(nam1,k,j,i,icrm)  - (fv2-fv1);
+                real fw1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)*rho(k,icrm)*adz(k,icrm)+
+                                 u(kcu,j+offy_u,ic-1+offx_u,icrm)*rho(kcu,icrm)*adz(kcu,icrm))*
+                                 (w(kc,j+offy_w,i-1+offx_w,icrm)+w(kc,j+offy_w,ic-1+offx_w,icrm));
+                real fw2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)*rho(k,icrm)*adz(k,icrm)+
+                                 u(kcu,j+offy_u,ic+offx_u,icrm)*rho(kcu,icrm)*adz(kcu,icrm))*
+                                 (w(kc,j+offy_w,i+offx_w,icrm)+w(kc,j+offy_w,ic+offx_w,icrm));
+                dwdt(nam1,kc,j,i,icrm) = dwdt(nam1,kc,j,i,icrm)-irho*(fw2-fw1);
+
+                fu1 = dy25*(v(k,jc-1+offy_v,i+offx_v,icrm)+v(k,jc-1+offy_v,ib+offx_v,icrm))*
+                           (u(k,j-1+offy_u,i+offx_u,icrm)+u(k,jc-1+offy_u,i+offx_u,icrm));
+                fu2 = dy25*(v(k,jc+offy_v,i+offx_v,icrm)+v(k,jc+offy_v,ib+offx_v,icrm))*
+                           (u(k,j+offy_u,i+offx_u,icrm)+u(k,jc+offy_u,i+offx_u,icrm));
+                dudt(nam1,k,j,i,icrm) = dudt(nam1,k,j,i,icrm) - (fu2-fu1);
+                fv1 = dy25*(v(k,jc-1+offy_v,i+offx_v,icrm)+v(k,j-1+offy_v,i+offx_v,icrm))*
+                           (v(k,j-1+offy_v,i+offx_v,icrm)+v(k,jc-1+offy_v,i+offx_v,icrm));
+                fv2 = dy25*(v(k,jc+offy_v,i+offx_v,icrm)+v(k,j+offy_v,i+offx_v,icrm))*
+                           (v(k,j+offy_v,i+offx_v,icrm)+v(k,jc+offy_v,i+offx_v,icrm));
+                dvdt(nam1,k,j,i,icrm) = dvdt(nam1,k,j,i,icrm) - (fv2-fv1);
+                fw1 = dy25*(v(k,jc-1+offy_v,i+offx_v,icrm)*rho(k,icrm)*adz(k,icrm)+
+                            v(kcu,jc-1+offy_v,i+offx_v,icrm)*rho(kcu,icrm)*adz(kcu,icrm))*
+                            (w(kc,j-1+offy_w,i+offx_w,icrm)+w(kc,jc-1+offy_w,i+offx_w,icrm));
+                fw2 = dy25*(v(k,jc+offy_v,i+offx_v,icrm)*rho(k,icrm)*adz(k,icrm)+
+                            v(kcu,jc+offy_v,i+offx_v,icrm)*rho(kcu,icrm)*adz(kcu,icrm))*
+                            (w(kc,j+offy_w,i+offx_w,icrm)+w(kc,jc+offy_w,i+offx_w,icrm));
+                dwdt(nam1,kc,j,i,icrm)= dwdt(nam1,kc,j,i,icrm)-irho*(fw2-fw1);
+              }
+            } else {
+              SAMXX_SIMD for (int icrm=0; icrm<ncrms; icrm++) {
+                real irho = 1.0/(rhow(kc,icrm)*adzw(kc,icrm));
+                real fu1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)+u(k,j+offy_u,i-1+offx_u,icrm))*
+                                (u(k,j+offy_u,i-1+offx_u,icrm)+u(k,j+offy_u,ic-1+offx_u,icrm));
+                real fu2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)+u(k,j+offy_u,i+offx_u,icrm))*
+                                (u(k,j+offy_u,i+offx_u,icrm)+u(k,j+offy_u,ic+offx_u,icrm));
+                dudt(nam1,k,j,i,icrm)  = dudt(nam1,k,j,i,icrm)  - (fu2-fu1);
+                real fv1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)+u(k,j+offy_u,i-1+offx_u,icrm))*
+                                (v(k,j+offy_v,i-1+offx_v,icrm)+v(k,j+offy_v,ic-1+offx_v,icrm));
+                real fv2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)+u(k,j+offy_u,i+offx_u,icrm))*
+                                (v(k,j+offy_v,i+offx_v,icrm)+v(k,j+offy_v,ic+offx_v,icrm));
+                dvdt(nam1,k,j,i,icrm)  = dvdt(nam1,k,j,i,icrm)  - (fv2-fv1);
+                real fw1 = dx25*(u(k,j+offy_u,ic-1+offx_u,icrm)*rho(k,icrm)*adz(k,icrm)+u(kcu,j+offy_u,ic-1+offx_u,icrm)*
+                                 rho(kcu,icrm)*adz(kcu,icrm))*(w(kc,j+offy_w,i-1+offx_w,icrm)+w(kc,j+offy_w,ic-1+offx_w,icrm));
+                real fw2 = dx25*(u(k,j+offy_u,ic+offx_u,icrm)*rho(k,icrm)*adz(k,icrm)+u(kcu,j+offy_u,ic+offx_u,icrm)*
+                                 rho(kcu,icrm)*adz(kcu,icrm))*(w(kc,j+offy_w,i+offx_w,icrm)+w(kc,j+offy_w,ic+offx_w,icrm));
+                dwdt(nam1,kc,j,i,icrm) = dwdt(nam1,kc,j,i,icrm)-irho*(fw2-fw1);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+#endif
+
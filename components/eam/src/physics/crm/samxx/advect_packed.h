@@ -0,0 +1,44 @@
+
+#pragma once
+
+#include "samxx_const.h"
+#include "vars.h"
+
+// CPU kernels for the scalar and momentum advection (SAMXX_USE_PACKED_KERNELS).
+//
+// The default kernels are flat parallel_for(SimpleBounds<4>(nzm,ny,nx,ncrms)),
+// which on the CPU become a single collapsed loop with an integer division per
+// index, so the compiler does not vectorize along icrm. These kernels use
+// nested loops instead, with the (j,i) plane split in tiles and the innermost
+// loop over a fixed number of CRMs (pack_size) marked for SIMD.
+//
+// advect_scalar3D_packed copies each pack of pack_size CRMs into a pack-major
+// layout (k, j, i, lane), with the halos, and runs all the stages of the
+// scheme for that pack before moving to the next one, so the temporaries of a
+// pack stay in cache between stages. Lanes past ncrms in the last pack repeat
+// the last CRM and are not copied back. The result is bit-for-bit identical to
+// advect_scalar3D on a serial CPU build.
+//
+// advect2_mom_xy_packed is a single stage, so it works in place on the
+// (k, j, i, icrm) arrays, tiled over (j,i), with icrm innermost.
+//
+// The kernels are used by advect_scalar3D and advect2_mom_xy when
+// use_packed_kernels is true (the default when they are compiled in).
+
+#ifndef SAMXX_PACK_SIZE
+  #define SAMXX_PACK_SIZE 8
+#endif
+
+int constexpr pack_size = SAMXX_PACK_SIZE;
+
+#ifdef SAMXX_USE_PACKED_KERNELS
+
+extern bool use_packed_kernels;
+
+// f is indexed as (k, offy_s+j, offx_s+i, icrm), flux as (k, icrm)
+void advect_scalar3D_packed(real4d &f, real2d &flux);
+
+void advect2_mom_xy_packed();
+
+#endif
+
@@ -1,4 +1,5 @@
 #include "advect_scalar2D.h"
+#include "samxx_scratch.h"
 
 void advect_scalar2D(real4d &f, real2d &flux) {
   YAKL_SCOPE( dowallx        , :: dowallx);
@@ -17,13 +18,14 @@ void advect_scalar2D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j        = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,1,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,1,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,1,nx+5,ncrms);
+  real4d www  = scratch_real4d("www",nz,1,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -212,13 +214,14 @@ void advect_scalar2D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,1,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,1,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,1,nx+5,ncrms);
+  real4d www  = scratch_real4d("www",nz,1,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
@@ -408,13 +411,14 @@ void advect_scalar2D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr j = 0;
 
-  real4d mx   ("mx"   ,nzm,1,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,1,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,1,nx+5,ncrms);
-  real4d www  ("www"  ,nz,1,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,1,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,1,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,1,nx+5,ncrms);
+  real4d www  = scratch_real4d("www",nz,1,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int i=0; i<nx+4; i++) {
   //  for (int icrm=0; icrm<ncrms; icrm++) {
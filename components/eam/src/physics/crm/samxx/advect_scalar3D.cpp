@@ -1,4 +1,6 @@
 #include "advect_scalar3D.h"
+#include "samxx_scratch.h"
+#include "advect_packed.h"
 
 void advect_scalar3D(real4d &f, real2d &flux) {
   YAKL_SCOPE( dowallx  , ::dowallx);
@@ -23,14 +25,15 @@ void advect_scalar3D(real4d &f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,ny+2,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,ny+2,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,ny+4,nx+5,ncrms);
+  real4d vvv  = scratch_real4d("vvv",nzm,ny+5,nx+4,ncrms);
+  real4d www  = scratch_real4d("www",nz ,ny+4,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -84,6 +87,13 @@ void advect_scalar3D(real4d &f, real2d &flux) {
     }
   }
 
+#ifdef SAMXX_USE_PACKED_KERNELS
+  if (use_packed_kernels) {
+    advect_scalar3D_packed(f, flux);
+    return;
+  }
+#endif
+
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -320,14 +330,15 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,ny+2,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,ny+2,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,ny+4,nx+5,ncrms);
+  real4d vvv  = scratch_real4d("vvv",nzm,ny+5,nx+4,ncrms);
+  real4d www  = scratch_real4d("www",nz ,ny+4,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -381,6 +392,14 @@ void advect_scalar3D(real5d &f, int ind_f, real2d &flux) {
     }
   }
 
+#ifdef SAMXX_USE_PACKED_KERNELS
+  if (use_packed_kernels) {
+    real4d f_slice("f", &f(ind_f,0,0,0,0), nzm, dimy_s, dimx_s, ncrms);
+    advect_scalar3D_packed(f_slice, flux);
+    return;
+  }
+#endif
+
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -617,14 +636,15 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
   int  constexpr offx_www = 2;
   int  constexpr offy_www = 2;
 
-  real4d mx   ("mx"   ,nzm,ny+2,nx+2,ncrms);
-  real4d mn   ("mn"   ,nzm,ny+2,nx+2,ncrms);
-  real4d uuu  ("uuu"  ,nzm,ny+4,nx+5,ncrms);
-  real4d vvv  ("vvv"  ,nzm,ny+5,nx+4,ncrms);
-  real4d www  ("www"  ,nz ,ny+4,nx+4,ncrms);
-  real2d iadz ("iadz" ,nzm,ncrms);
-  real2d irho ("irho" ,nzm,ncrms);
-  real2d irhow("irhow",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real4d mx   = scratch_real4d("mx",nzm,ny+2,nx+2,ncrms);
+  real4d mn   = scratch_real4d("mn",nzm,ny+2,nx+2,ncrms);
+  real4d uuu  = scratch_real4d("uuu",nzm,ny+4,nx+5,ncrms);
+  real4d vvv  = scratch_real4d("vvv",nzm,ny+5,nx+4,ncrms);
+  real4d www  = scratch_real4d("www",nz ,ny+4,nx+4,ncrms);
+  real2d iadz = scratch_real2d("iadz",nzm,ncrms);
+  real2d irho = scratch_real2d("irho",nzm,ncrms);
+  real2d irhow = scratch_real2d("irhow",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int j=0; j<ny+4; j++) {
@@ -678,6 +698,15 @@ void advect_scalar3D(real5d &f, int ind_f, real3d &flux, int ind_flux) {
     }
   }
 
+#ifdef SAMXX_USE_PACKED_KERNELS
+  if (use_packed_kernels) {
+    real4d f_slice   ("f"   , &f(ind_f,0,0,0,0), nzm, dimy_s, dimx_s, ncrms);
+    real2d flux_slice("flux", &flux(ind_flux,0,0), nz, ncrms);
+    advect_scalar3D_packed(f_slice, flux_slice);
+    return;
+  }
+#endif
+
   if (nonos) {
     // for (int k=0; k<nzm; k++) {
     //   for (int j=0; j<ny+2; j++) {
@@ -3,6 +3,7 @@
 #include "post_timeloop.h"
 #include "timeloop.h"
 #include "vars.h"
+#include "samxx_scratch.h"
 
 
 extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_input_bflxls_p, 
@@ -101,6 +102,8 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
 
   allocate();
 
+  scratch_allocate();
+
   init_values();
 
   pre_timeloop();
@@ -109,6 +112,10 @@ extern "C" void crm(int ncrms_in, int pcols_in, real dt_gl, int plev, real *crm_
 
   post_timeloop();
 
+#ifdef SAMXX_SCRATCH_REPORT
+  scratch_report();
+#endif
+
   copy_outputs_and_destroy(crm_state_u_wind_p, crm_state_v_wind_p, crm_state_w_wind_p, crm_state_temperature_p, 
                            crm_state_qv_p, crm_state_qp_p, crm_state_qn_p, crm_rad_temperature_p, 
                            crm_rad_qv_p, crm_rad_qc_p, crm_rad_qi_p, crm_rad_cld_p, crm_output_subcycle_factor_p, 
@@ -1,5 +1,6 @@
 
 #include "diffuse_mom2D.h"
+#include "samxx_scratch.h"
 
 void diffuse_mom2D(real5d &tk) {
   YAKL_SCOPE( dx            , :: dx );
@@ -26,9 +27,10 @@ void diffuse_mom2D(real5d &tk) {
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( ncrms         , :: ncrms );
   
-  real4d fu("fu",nz,1,nx+1,ncrms);
-  real4d fv("fv",nz,1,nx+1,ncrms);
-  real4d fw("fw",nz,1,nx+1,ncrms);
+  ScratchScope scratch_scope;
+  real4d fu = scratch_real4d("fu",nz,1,nx+1,ncrms);
+  real4d fv = scratch_real4d("fv",nz,1,nx+1,ncrms);
+  real4d fw = scratch_real4d("fw",nz,1,nx+1,ncrms);
 
   real rdx2=1.0/dx/dx;
   real rdx25=0.25*rdx2;
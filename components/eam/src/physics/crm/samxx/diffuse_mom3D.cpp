@@ -1,4 +1,5 @@
 #include "diffuse_mom3D.h"
+#include "samxx_scratch.h"
 
 void diffuse_mom3D(real5d &tk) {
   YAKL_SCOPE( dx            , :: dx );
@@ -26,9 +27,10 @@ void diffuse_mom3D(real5d &tk) {
   YAKL_SCOPE( adz           , :: adz );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
-  real4d fu("fu",nz,ny+1,nx+1,ncrms);
-  real4d fv("fv",nz,ny+1,nx+1,ncrms);
-  real4d fw("fw",nz,ny+1,nx+1,ncrms);
+  ScratchScope scratch_scope;
+  real4d fu = scratch_real4d("fu",nz,ny+1,nx+1,ncrms);
+  real4d fv = scratch_real4d("fv",nz,ny+1,nx+1,ncrms);
+  real4d fw = scratch_real4d("fw",nz,ny+1,nx+1,ncrms);
 
   real rdx2=1.0/(dx*dx);
   real rdy2=1.0/(dy*dy);
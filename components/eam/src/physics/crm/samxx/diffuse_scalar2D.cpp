@@ -1,5 +1,6 @@
 
 #include "diffuse_scalar2D.h"
+#include "samxx_scratch.h"
 
 void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
                       int ind_tkh, real2d &flux) {
@@ -20,8 +21,9 @@ void diffuse_scalar2D(real4d &field, real3d &fluxb, real3d &fluxt, real5d &tkh,
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch_scope;
+    real4d flx = scratch_real4d("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch_real4d("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -109,8 +111,9 @@ void diffuse_scalar2D(real5d &field, int ind_field, real3d &fluxb, real3d &fluxt
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch_scope;
+    real4d flx = scratch_real4d("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch_real4d("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
@@ -198,8 +201,9 @@ void diffuse_scalar2D(real5d &field, int ind_field, real4d &fluxb, int ind_fluxb
     int constexpr offx_flx = 1;
     int constexpr offz_flx = 1;
 
-    real4d flx("flx", nzm+1, 1, nx+1, ncrms);
-    real4d dfdt("dfdt", nzm, ny, nx, ncrms);
+    ScratchScope scratch_scope;
+    real4d flx = scratch_real4d("flx", nzm+1, 1, nx+1, ncrms);
+    real4d dfdt = scratch_real4d("dfdt", nzm, ny, nx, ncrms);
 
     // for (int k=0; k<nzm; k++) {
     //  for (int i=0; i<nx; i++) {
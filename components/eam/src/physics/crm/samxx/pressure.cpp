@@ -1,41 +1,19 @@
 
 #include "pressure.h"
+#include "samxx_scratch.h"
+#include "samxx_fft.h"
 
 void pressure() {
   YAKL_SCOPE( p             , :: p );
-  YAKL_SCOPE( rhow          , :: rhow );
-  YAKL_SCOPE( adz           , :: adz );
-  YAKL_SCOPE( adzw          , :: adzw );
-  YAKL_SCOPE( dz            , :: dz );
-  YAKL_SCOPE( dx            , :: dx );
-  YAKL_SCOPE( dy            , :: dy );
-  YAKL_SCOPE( rho           , :: rho );
   YAKL_SCOPE( ncrms         , :: ncrms );
 
   int npressureslabs = nsubdomains;
   int nzslab = max(1,nzm/npressureslabs); 
   int nx2 = nx+2;
   int ny2 = ny+2*YES3D;
-  int constexpr n3i=3*nx_gl/2+1;
-  int constexpr n3j=3*ny_gl/2+1;
-  int constexpr fftySize = ny > 4 ? ny : 4;
 
-  real4d f ("f" , nzslab, ny2, nx2, ncrms);
-  real4d ff("ff", nzm,ny2,nx+1,ncrms);
-  real2d a ("a" , nzm, ncrms);
-  real2d c ("c" , nzm, ncrms);
-
-  int iwall = 0;
-  int nypp, jwall;
-
-  if (RUN2D) {
-    nypp = 1;
-    jwall = 0;
-  } else {
-    nypp = ny+2;
-  }
-
-  real2d eign("eign",nypp,nx+1);
+  ScratchScope scratch_scope;
+  real4d f = scratch_real4d("f", nzslab, ny2, nx2, ncrms);
 
   press_rhs();
 
@@ -47,51 +25,67 @@ void pressure() {
     f(k,j,i,icrm) = p(k,j+offy_p,i+offx_p,icrm);
   });
 
-  #ifndef USE_ORIG_FFT
+  pressure_solve(f, nzslab);
 
-    pressure_fftx.forward_real(f, 2, nx);
-    if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+  parallel_for( SimpleBounds<4>(nzslab,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+    int jj, ii;
 
-  #else
+    if (YES3D) {
+      if (j == 0) {
+        jj = ny-1; 
+      } else {
+        jj = j-1;
+      }
+    } else {
+      jj = j;
+    }
 
-    realHost2d work  ("work"  ,ny2,nx2);
-    realHost1d ftmp_x("ftmp_x",nx2);
-    realHost1d ftmp_y("ftmp_y",ny2);
-    realHost1d trigxi("trigxi",n3i);
-    realHost1d trigxj("trigxj",n3j);
-    intHost1d  ifaxi ("ifaxi" ,100);
-    intHost1d  ifaxj ("ifaxj" ,100);
-    realHost4d fHost = f.createHostCopy();
+    if (i == 0) {
+      ii = nx-1;
+    } else {
+      ii = i-1;
+    }
 
-    yakl::fence();
+    p(k,j,i,icrm) = f(k,jj,ii,icrm);
+  });
 
-    fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
-    if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
+  press_grad();
+}
 
-    for (int k = 0 ; k < nzslab ; k++) {
-      for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , -1 );
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
-      }
-    }
-    if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , -1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
-      }
-    }
 
-    fHost.deep_copy_to(f);
+void pressure_solve(real4d &f, int nzslab) {
+  pressure_fft_forward(f, nzslab);
+  pressure_solve_spectral(f, nzslab);
+  pressure_fft_inverse(f, nzslab);
+}
+
+
+void pressure_solve_spectral(real4d &f, int nzslab) {
+  YAKL_SCOPE( rhow          , :: rhow );
+  YAKL_SCOPE( adz           , :: adz );
+  YAKL_SCOPE( adzw          , :: adzw );
+  YAKL_SCOPE( dz            , :: dz );
+  YAKL_SCOPE( dx            , :: dx );
+  YAKL_SCOPE( dy            , :: dy );
+  YAKL_SCOPE( rho           , :: rho );
+  YAKL_SCOPE( ncrms         , :: ncrms );
+
+  int ny2 = ny+2*YES3D;
+
+  ScratchScope scratch_scope;
+  real4d ff = scratch_real4d("ff", nzm,ny2,nx+1,ncrms);
+  real2d a = scratch_real2d("a", nzm, ncrms);
+  real2d c = scratch_real2d("c", nzm, ncrms);
 
-  #endif
+  int nypp;
+
+  if (RUN2D) {
+    nypp = 1;
+  } else {
+    nypp = ny+2;
+  }
+
+  real2d eign = scratch_real2d("eign",nypp,nx+1);
 
   // for(int k=0; k<nzslab; k++) {
   //  for(int j=0; j<nypp; j++) {
@@ -171,66 +165,4 @@ void pressure() {
   parallel_for( SimpleBounds<4>(nzslab,nypp,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
     f(k,j,i,icrm) = ff(k,j,i,icrm);
   });
-
-  #ifndef USE_ORIG_FFT
-
-    if (RUN3D) { pressure_ffty.inverse_real(f); }
-    pressure_fftx.inverse_real(f);
-
-  #else
-
-    f.deep_copy_to(fHost);
-    yakl::fence();
-
-    if (RUN3D) {
-      for (int k = 0 ; k < nzslab ; k++) {
-        for (int i = 0 ; i < nx_gl+1 ; i++) {
-          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
-            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , +1);
-            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
-          }
-        }
-      }
-    }
-
-    for (int k = 0 ; k < nzslab ; k++) {
-      for (int j = 0 ; j < ny_gl ; j++) {
-        for (int icrm = 0 ; icrm < ncrms ; icrm++) {
-          for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
-          fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , +1);
-          for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
-        }
-      }
-    }
-
-    fHost.deep_copy_to(f);
-
-  #endif
-
-  parallel_for( SimpleBounds<4>(nzslab,dimy_p,nx+1,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
-    int jj, ii;
-
-    if (YES3D) {
-      if (j == 0) {
-        jj = ny-1; 
-      } else {
-        jj = j-1;
-      }
-    } else {
-      jj = j;
-    }
-
-    if (i == 0) {
-      ii = nx-1;
-    } else {
-      ii = i-1;
-    }
-
-    p(k,j,i,icrm) = f(k,jj,ii,icrm);
-  });
-
-  press_grad();
 }
-
-
@@ -12,3 +12,11 @@ extern "C" void fft991_crm(real *a, real *work, real *trigs, int *ifax, int inc,
 
 void pressure();
 
+// Solve the Poisson equation for the pressure: on input, f holds the rhs
+// (computed by press_rhs), and on output it holds the pressure.
+void pressure_solve(real4d &f, int nzslab);
+
+// The spectral part of pressure_solve: on input, f holds the horizontal
+// transform of the rhs, and on output the transform of the pressure.
+void pressure_solve_spectral(real4d &f, int nzslab);
+
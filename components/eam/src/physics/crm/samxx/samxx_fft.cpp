@@ -0,0 +1,278 @@
+
+#include "samxx_fft.h"
+#include "vars.h"
+
+#if defined(SAMXX_USE_FFTW) && defined(USE_ORIG_FFT)
+  #error "SAMXX_USE_FFTW and USE_ORIG_FFT are mutually exclusive"
+#endif
+
+
+
+#include "pressure.h"
+
+namespace {
+  int constexpr n3i=3*nx_gl/2+1;
+  int constexpr n3j=3*ny_gl/2+1;
+
+  void fft991_all(real4d &f, int nzslab, int isign) {
+    int constexpr nx2 = nx+2;
+    int constexpr ny2 = ny+2*YES3D;
+
+    realHost2d work  ("work"  ,ny2,nx2);
+    realHost1d ftmp_x("ftmp_x",nx2);
+    realHost1d ftmp_y("ftmp_y",ny2);
+    realHost1d trigxi("trigxi",n3i);
+    realHost1d trigxj("trigxj",n3j);
+    intHost1d  ifaxi ("ifaxi" ,100);
+    intHost1d  ifaxj ("ifaxj" ,100);
+    realHost4d fHost = f.createHostCopy();
+
+    yakl::fence();
+
+    fftfax_crm( nx_gl , ifaxi.data() , trigxi.data() );
+    if (RUN3D) fftfax_crm( ny_gl , ifaxj.data() , trigxj.data() );
+
+    auto fft_x = [&] () {
+      for (int k = 0 ; k < nzslab ; k++) {
+        for (int j = 0 ; j < ny_gl ; j++) {
+          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
+            for (int i=0 ; i < nx2 ; i++) { ftmp_x(i) = fHost(k,j,i,icrm); }
+            fft991_crm( ftmp_x.data() , work.data() , trigxi.data() , ifaxi.data() , 1 , nx2 , nx_gl , 1 , isign );
+            for (int i=0 ; i < nx2 ; i++) { fHost(k,j,i,icrm) = ftmp_x(i); }
+          }
+        }
+      }
+    };
+    auto fft_y = [&] () {
+      for (int k = 0 ; k < nzslab ; k++) {
+        for (int i = 0 ; i < nx_gl+1 ; i++) {
+          for (int icrm = 0 ; icrm < ncrms ; icrm++) {
+            for (int j=0 ; j < ny2 ; j++) { ftmp_y(j) = fHost(k,j,i,icrm); }
+            fft991_crm( ftmp_y.data() , work.data() , trigxj.data() , ifaxj.data() , 1 , nx2 , ny_gl , 1 , isign );
+            for (int j=0 ; j < ny2 ; j++) { fHost(k,j,i,icrm) = ftmp_y(j); }
+          }
+        }
+      }
+    };
+
+    if (isign < 0) {
+      fft_x();
+      if (RUN3D) { fft_y(); }
+    } else {
+      if (RUN3D) { fft_y(); }
+      fft_x();
+    }
+
+    fHost.deep_copy_to(f);
+  }
+}
+
+void pressure_fft991_forward(real4d &f, int nzslab) {
+  fft991_all(f, nzslab, -1);
+}
+
+void pressure_fft991_inverse(real4d &f, int nzslab) {
+  fft991_all(f, nzslab, +1);
+}
+
+
+
+#if defined(SAMXX_USE_FFTW)
+
+#if defined(YAKL_ARCH_CUDA) || defined(YAKL_ARCH_HIP) || defined(YAKL_ARCH_SYCL)
+  #error "SAMXX_USE_FFTW is only available for CPU builds"
+#endif
+
+#include <fftw3.h>
+#include <algorithm>
+#include <vector>
+#include <type_traits>
+
+static_assert(std::is_same<real,double>::value, "SAMXX_USE_FFTW requires double precision reals");
+
+namespace {
+  // The CRMs are transformed in batches of nbatch: a batch is gathered from f
+  // into a work buffer with the layout of f and nbatch CRMs (zero padded past
+  // ncrms), transformed with one execution of each plan, and scattered back.
+  // The plans then only depend on nzslab, and not on ncrms, which changes
+  // from step to step with CRM load balancing. They are measured once, and
+  // only built again if nzslab changes.
+  int constexpr nbatch = 8;
+
+  struct PlanSet {
+    int nzslab = -1;
+    fftw_plan fwd_x = nullptr;
+    fftw_plan fwd_y = nullptr;
+    fftw_plan inv_x = nullptr;
+    fftw_plan inv_y = nullptr;
+  };
+  PlanSet plans;
+  // Input and output buffers of the plans, one batch each
+  std::vector<real> work_in;
+  std::vector<real> work_out;
+
+  size_t batch_points(int nzslab) {
+    int constexpr nx2 = nx+2;
+    int constexpr ny2 = ny+2*YES3D;
+    return (size_t) nzslab*ny2*nx2;
+  }
+
+  void destroy_plans() {
+    if (plans.fwd_x) { fftw_destroy_plan(plans.fwd_x); }
+    if (plans.fwd_y) { fftw_destroy_plan(plans.fwd_y); }
+    if (plans.inv_x) { fftw_destroy_plan(plans.inv_x); }
+    if (plans.inv_y) { fftw_destroy_plan(plans.inv_y); }
+    plans = PlanSet();
+  }
+
+  // f(k,j,i,icrm) is stored with icrm fastest, and so is a batch. Complex
+  // coefficient m of a transform along i (or j) is stored at i=2*m (real
+  // part) and i=2*m+1 (imaginary part), which is the layout of fft991 and
+  // YAKL. FFTW's split interface expresses it with an output stride of 2 and
+  // an imaginary part offset by one element along the transformed dimension.
+  // The plans always run on work_in and work_out.
+  void make_plans(int nzslab) {
+    int constexpr nx2 = nx+2;
+    int constexpr ny2 = ny+2*YES3D;
+    int constexpr stride_i = nbatch;
+    int constexpr stride_j = nx2*nbatch;
+    int constexpr stride_k = ny2*nx2*nbatch;
+
+    destroy_plans();
+    // FFTW_MEASURE overwrites the buffers, which are filled for each batch anyway
+    work_in .assign(batch_points(nzslab)*nbatch, 0.);
+    work_out.assign(batch_points(nzslab)*nbatch, 0.);
+    real *in  = work_in .data();
+    real *out = work_out.data();
+    unsigned const flags = FFTW_MEASURE;
+
+    // x transforms: batched over icrm, j (physical rows only) and k
+    {
+      fftw_iodim dims    [1] = { {nx, stride_i, 2*stride_i} };
+      fftw_iodim howmany [3] = { {nbatch, 1       , 1       } ,
+                                 {ny    , stride_j, stride_j} ,
+                                 {nzslab, stride_k, stride_k} };
+      plans.fwd_x = fftw_plan_guru_split_dft_r2c(1, dims, 3, howmany, in, out, out+stride_i, flags);
+      fftw_iodim dims_inv[1] = { {nx, 2*stride_i, stride_i} };
+      plans.inv_x = fftw_plan_guru_split_dft_c2r(1, dims_inv, 3, howmany, in, in+stride_i, out, flags);
+    }
+    // y transforms: batched over icrm, the nx+1 x-coefficients used by the solver, and k
+    if (RUN3D) {
+      fftw_iodim dims    [1] = { {ny, stride_j, 2*stride_j} };
+      fftw_iodim howmany [3] = { {nbatch, 1       , 1       } ,
+                                 {nx+1  , stride_i, stride_i} ,
+                                 {nzslab, stride_k, stride_k} };
+      plans.fwd_y = fftw_plan_guru_split_dft_r2c(1, dims, 3, howmany, in, out, out+stride_j, flags);
+      fftw_iodim dims_inv[1] = { {ny, 2*stride_j, stride_j} };
+      plans.inv_y = fftw_plan_guru_split_dft_c2r(1, dims_inv, 3, howmany, in, in+stride_j, out, flags);
+    }
+    if (plans.fwd_x == nullptr || plans.inv_x == nullptr || (RUN3D && (plans.fwd_y == nullptr || plans.inv_y == nullptr))) {
+      yakl::yakl_throw("ERROR: could not create the FFTW plans for the pressure solver");
+    }
+    plans.nzslab = nzslab;
+  }
+
+  PlanSet const &get_plans(int nzslab) {
+    if (plans.nzslab != nzslab) { make_plans(nzslab); }
+    return plans;
+  }
+
+  // Copy CRMs icrm0 to icrm0+nbatch-1 of f to work_in
+  void gather(real const *f, int nzslab, int icrm0) {
+    int const nb = std::min(nbatch, ncrms-icrm0);
+    size_t const npts = batch_points(nzslab);
+    for (size_t n=0; n < npts; n++) {
+      for (int ib=0 ; ib < nb    ; ib++) { work_in[n*nbatch+ib] = f[n*ncrms+icrm0+ib]; }
+      for (int ib=nb; ib < nbatch; ib++) { work_in[n*nbatch+ib] = 0.; }
+    }
+  }
+
+  // Copy work_out, times scale, back to CRMs icrm0 to icrm0+nbatch-1 of f
+  void scatter(real *f, int nzslab, int icrm0, real scale) {
+    int const nb = std::min(nbatch, ncrms-icrm0);
+    size_t const npts = batch_points(nzslab);
+    for (size_t n=0; n < npts; n++) {
+      for (int ib=0; ib < nb; ib++) { f[n*ncrms+icrm0+ib] = scale*work_out[n*nbatch+ib]; }
+    }
+  }
+
+  // The transforms do not set all the entries of their output: those keep
+  // the values of the input, like with the other backends
+  void in_to_out() { std::copy(work_in .begin(), work_in .end(), work_out.begin()); }
+  void out_to_in() { std::copy(work_out.begin(), work_out.end(), work_in .begin()); }
+}
+
+void pressure_fft_forward(real4d &f, int nzslab) {
+  PlanSet const &p = get_plans(nzslab);
+  // fft991 normalizes the forward transform
+  real const scale = 1. / (RUN3D ? nx*ny : nx);
+
+  yakl::fence();
+  for (int icrm0=0; icrm0 < ncrms; icrm0 += nbatch) {
+    gather(f.data(), nzslab, icrm0);
+    in_to_out();
+    fftw_execute(p.fwd_x);
+    if (RUN3D) {
+      out_to_in();
+      fftw_execute(p.fwd_y);
+    }
+    scatter(f.data(), nzslab, icrm0, scale);
+  }
+}
+
+void pressure_fft_inverse(real4d &f, int nzslab) {
+  PlanSet const &p = get_plans(nzslab);
+
+  yakl::fence();
+  for (int icrm0=0; icrm0 < ncrms; icrm0 += nbatch) {
+    gather(f.data(), nzslab, icrm0);
+    in_to_out();
+    if (RUN3D) {
+      fftw_execute(p.inv_y);
+      out_to_in();
+    }
+    fftw_execute(p.inv_x);
+    scatter(f.data(), nzslab, icrm0, 1.);
+  }
+}
+
+void pressure_fft_finalize() {
+  destroy_plans();
+  work_in  = std::vector<real>();
+  work_out = std::vector<real>();
+}
+
+
+
+#elif defined(USE_ORIG_FFT)
+
+void pressure_fft_forward(real4d &f, int nzslab) {
+  pressure_fft991_forward(f, nzslab);
+}
+
+void pressure_fft_inverse(real4d &f, int nzslab) {
+  pressure_fft991_inverse(f, nzslab);
+}
+
+void pressure_fft_finalize() {
+}
+
+
+
+#else
+
+void pressure_fft_forward(real4d &f, int nzslab) {
+  pressure_fftx.forward_real(f, 2, nx);
+  if (RUN3D) { pressure_ffty.forward_real(f, 1, ny); }
+}
+
+void pressure_fft_inverse(real4d &f, int nzslab) {
+  if (RUN3D) { pressure_ffty.inverse_real(f); }
+  pressure_fftx.inverse_real(f);
+}
+
+void pressure_fft_finalize() {
+}
+
+#endif
+
@@ -0,0 +1,29 @@
+
+#pragma once
+
+#include "samxx_const.h"
+
+// Horizontal real-to-spectral transforms used by the anelastic pressure solver.
+//
+// f has dimensions (nzslab, ny+2*YES3D, nx+2, ncrms). The forward transform
+// is done in x (and then in y if RUN3D) for all slabs and all CRMs at once,
+// with the packed real/imaginary layout and the 1/n normalization of fft991.
+// The inverse transform is done in the reverse order.
+//
+// The backend is selected at compile time:
+//  - default        : YAKL RealFFT1D (runs on the device)
+//  - USE_ORIG_FFT   : original fft991_crm on the host, one transform at a time
+//  - SAMXX_USE_FFTW : FFTW, one plan per direction for a fixed batch of CRMs,
+//                     built the first time the transform is needed and reused
+//                     until nzslab changes (CPU builds only)
+void pressure_fft_forward(real4d &f, int nzslab);
+void pressure_fft_inverse(real4d &f, int nzslab);
+
+// The fft991_crm transforms, available with all the backends: they are the
+// USE_ORIG_FFT backend, and the reference the other ones are checked against
+void pressure_fft991_forward(real4d &f, int nzslab);
+void pressure_fft991_inverse(real4d &f, int nzslab);
+
+// Release the FFTW plans and work buffer (no-op for the other backends)
+void pressure_fft_finalize();
+
@@ -0,0 +1,105 @@
+
+#include "samxx_scratch.h"
+#include "samxx_fft.h"
+#include "vars.h"
+#include <algorithm>
+#include <iostream>
+
+namespace {
+  // Alignment of each array in the arena, in number of reals
+  size_t constexpr align = 16;
+
+  real1d arena;
+  size_t capacity = 0;
+  size_t arena_offset   = 0;
+  size_t hwm      = 0;
+  int    overflows = 0;
+
+  // Returns nullptr if the arena has no room for n reals
+  real * scratch_get(size_t n) {
+    size_t n_aligned = ((n+align-1)/align)*align;
+    if (arena_offset + n_aligned > capacity) {
+      overflows++;
+      return nullptr;
+    }
+    real *ptr = arena.data() + arena_offset;
+    arena_offset += n_aligned;
+    hwm = std::max(hwm,arena_offset);
+    return ptr;
+  }
+}
+
+void scratch_allocate() {
+  // Largest set of temporaries alive at the same time, which is advect_scalar3D
+  // (called from advect_all_scalars) and diffuse_scalar3D (called from sgs).
+  // Together with their callers, they need at most 6 arrays of size
+  // (nz+1)*(dimy_s+1)*(dimx_s+1) per crm, plus a few column arrays,
+  // and some padding for the alignment.
+  size_t block = static_cast<size_t>(nz+1)*(dimy_s+1)*(dimx_s+1);
+  size_t needed = (6*block + 16*(nz+1))*ncrms + 64*align;
+  if (needed > capacity) {
+    arena = real1d("scratch_arena",needed);
+    capacity = needed;
+  }
+  arena_offset = 0;
+  hwm = 0;
+  overflows = 0;
+}
+
+extern "C" void crm_scratch_finalize() {
+  scratch_finalize();
+  // The pressure FFT plans persist across crm() calls as well
+  pressure_fft_finalize();
+}
+
+void scratch_finalize() {
+  arena = real1d();
+  capacity = 0;
+  arena_offset = 0;
+}
+
+size_t scratch_high_water_mark() {
+  return hwm;
+}
+
+void scratch_report() {
+  std::cout << "samxx scratch arena: capacity = " << capacity*sizeof(real) << " bytes"
+            << ", high-water mark = " << hwm*sizeof(real) << " bytes"
+            << ", overflows = " << overflows << std::endl;
+}
+
+ScratchScope::ScratchScope() : offset(arena_offset) {}
+
+ScratchScope::~ScratchScope() {
+  arena_offset = offset;
+}
+
+real1d scratch_real1d(char const *label, int d0) {
+  real *ptr = scratch_get(static_cast<size_t>(d0));
+  if (ptr == nullptr) { return real1d(label,d0); }
+  return real1d(label,ptr,d0);
+}
+
+real2d scratch_real2d(char const *label, int d0, int d1) {
+  real *ptr = scratch_get(static_cast<size_t>(d0)*d1);
+  if (ptr == nullptr) { return real2d(label,d0,d1); }
+  return real2d(label,ptr,d0,d1);
+}
+
+real3d scratch_real3d(char const *label, int d0, int d1, int d2) {
+  real *ptr = scratch_get(static_cast<size_t>(d0)*d1*d2);
+  if (ptr == nullptr) { return real3d(label,d0,d1,d2); }
+  return real3d(label,ptr,d0,d1,d2);
+}
+
+real4d scratch_real4d(char const *label, int d0, int d1, int d2, int d3) {
+  real *ptr = scratch_get(static_cast<size_t>(d0)*d1*d2*d3);
+  if (ptr == nullptr) { return real4d(label,d0,d1,d2,d3); }
+  return real4d(label,ptr,d0,d1,d2,d3);
+}
+
+real5d scratch_real5d(char const *label, int d0, int d1, int d2, int d3, int d4) {
+  real *ptr = scratch_get(static_cast<size_t>(d0)*d1*d2*d3*d4);
+  if (ptr == nullptr) { return real5d(label,d0,d1,d2,d3,d4); }
+  return real5d(label,ptr,d0,d1,d2,d3,d4);
+}
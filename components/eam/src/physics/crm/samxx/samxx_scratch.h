@@ -0,0 +1,50 @@
+
+#pragma once
+
+#include "samxx_const.h"
+
+// Persistent scratch arena for the temporary arrays of the routines called
+// inside the time loop (advection, diffusion, pressure, sgs, ...).
+//
+// Rather than allocating fresh arrays at every call, these routines take
+// unmanaged arrays carved out of a single device allocation. The arena is
+// sized at crm() entry from ncrms and the CRM dimensions, and it is kept
+// across crm() calls (it is only reallocated if ncrms grows), so that the
+// inner loop does no allocation and touches pages that are already mapped.
+//
+// Usage: declare a ScratchScope at the top of the routine, and get arrays
+// with scratch_real*d. All arrays obtained after the ScratchScope was created
+// are released when it goes out of scope (stack discipline). Kernels are
+// launched in order on the same stream, so it is safe to release an array
+// while kernels using it may still be running on the device.
+// If the arena is full, a regular (managed) array is returned instead, and
+// the overflow is recorded in the report.
+
+// Allocate (if needed) the arena, and reset the high-water mark
+void scratch_allocate();
+
+// Release the arena (must be called before YAKL/gator are finalized)
+void scratch_finalize();
+extern "C" void crm_scratch_finalize();
+
+// High-water mark (in number of reals) since the last scratch_allocate call
+size_t scratch_high_water_mark();
+
+// Print capacity, high-water mark, and number of overflows of the current crm() call
+void scratch_report();
+
+class ScratchScope {
+public:
+  ScratchScope ();
+  ~ScratchScope ();
+  ScratchScope (const ScratchScope&) = delete;
+  ScratchScope& operator= (const ScratchScope&) = delete;
+private:
+  size_t offset;
+};
+
+real1d scratch_real1d(char const *label, int d0);
+real2d scratch_real2d(char const *label, int d0, int d1);
+real3d scratch_real3d(char const *label, int d0, int d1, int d2);
+real4d scratch_real4d(char const *label, int d0, int d1, int d2, int d3);
+real5d scratch_real5d(char const *label, int d0, int d1, int d2, int d3, int d4);
@@ -1,5 +1,6 @@
 
 #include "sgs.h"
+#include "samxx_scratch.h"
 
 void kurant_sgs(real &cfl) {
   YAKL_SCOPE( sgs_field_diag , :: sgs_field_diag );
@@ -13,7 +14,8 @@ void kurant_sgs(real &cfl) {
   YAKL_SCOPE( grdf_z         , :: grdf_z );
   YAKL_SCOPE( ncrms          , :: ncrms );
 
-  real2d tkhmax("tkhmax",nzm,ncrms);
+  ScratchScope scratch_scope;
+  real2d tkhmax = scratch_real2d("tkhmax",nzm,ncrms);
 
   // for (int k=0; k<nzm; k++) {
   //   for (int icrm=0; icrm<ncrms; icrm++) {
@@ -81,7 +83,8 @@ void sgs_mom() {
 
 void sgs_scalars() {
   YAKL_SCOPE( use_ESMT, :: use_ESMT );
-  real2d dummy("dummy", nz, ncrms);
+  ScratchScope scratch_scope;
+  real2d dummy = scratch_real2d("dummy", nz, ncrms);
 
   diffuse_scalar(sgs_field_diag,1,t,fluxbt,fluxtt,tdiff,twsb);
 
@@ -0,0 +1,159 @@
+
+// Standalone benchmark of the packed CPU advection kernels (advect_packed.h).
+//
+// The CRM dimensions are compile-time constants, so this is built once per
+// configuration (see CMakeLists.txt). It runs the scalar advection
+// (advect_scalar3D, 3D only) and the horizontal momentum advection
+// (advect2_mom_xy) with the default kernels and with the packed kernels,
+// reports the time per call of each, and checks that both give the same result.
+//
+// Usage: ./advect_bench_3d [ncrms] [nrepeat]
+
+#include "vars.h"
+#include "advect_scalar3D.h"
+#include "advect2_mom_xy.h"
+#include "advect_packed.h"
+#include "samxx_scratch.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+template <class T> real max_abs_diff(T const &a, T const &b) {
+  auto aHost = a.createHostCopy();
+  auto bHost = b.createHostCopy();
+  real maxdiff = 0;
+  for (size_t n=0; n < aHost.get_totElems(); n++) {
+    maxdiff = max(maxdiff, abs(aHost.data()[n]-bHost.data()[n]));
+  }
+  return maxdiff;
+}
+
+int main(int argc, char **argv) {
+  int nrepeat = 50;
+  ncrms = 64;
+  if (argc > 1) { ncrms   = atoi(argv[1]); }
+  if (argc > 2) { nrepeat = atoi(argv[2]); }
+
+  yakl::init();
+  {
+    allocate();
+
+    dx = CRM_DX;
+    dy = CRM_DX;
+    na = 1;
+    dowallx = false;
+    dowally = false;
+    YAKL_SCOPE( ncrms , :: ncrms );
+    YAKL_SCOPE( u     , :: u     );
+    YAKL_SCOPE( v     , :: v     );
+    YAKL_SCOPE( w     , :: w     );
+    YAKL_SCOPE( adz   , :: adz   );
+    YAKL_SCOPE( adzw  , :: adzw  );
+    YAKL_SCOPE( rho   , :: rho   );
+    YAKL_SCOPE( rhow  , :: rhow  );
+    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+      if (k < nzm) {
+        adz (k,icrm) = 1. + 0.05*k;
+        rho (k,icrm) = 1.2*exp(-0.1*k);
+      }
+      adzw(k,icrm) = 1. + 0.05*k - 0.025;
+      rhow(k,icrm) = 1.2*exp(-0.1*k + 0.05);
+    });
+    parallel_for( SimpleBounds<4>(nz,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      if (k < nzm && j < dimy_u && i < dimx_u) { u(k,j,i,icrm) = 5.*sin(0.3*i + 0.2*j + 0.1*k + 0.01*icrm); }
+      if (k < nzm && j < dimy_v && i < dimx_v) { v(k,j,i,icrm) = 3.*cos(0.2*i + 0.3*j + 0.1*k + 0.02*icrm); }
+      if (            j < dimy_w && i < dimx_w) { w(k,j,i,icrm) = 0.5*sin(0.5*i*j + 0.2*k + 0.03*icrm); }
+    });
+
+    scratch_allocate();
+
+    real4d f0  ("f0"  ,nzm,dimy_s,dimx_s,ncrms);
+    real4d f   ("f"   ,nzm,dimy_s,dimx_s,ncrms);
+    real2d flux("flux",nz,ncrms);
+    parallel_for( SimpleBounds<4>(nzm,dimy_s,dimx_s,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      f0(k,j,i,icrm) = 1.e-3*(1. + sin(0.7*i + 0.4*j + 0.11*k + 0.01*icrm)) + 1.e-4*cos(1.3*i*j + icrm);
+    });
+
+    auto run = [&] (bool packed, real &scalar_time, real &mom_time) {
+      use_packed_kernels = packed;
+      yakl::memset(dudt,0.);
+      yakl::memset(dvdt,0.);
+      yakl::memset(dwdt,0.);
+      scalar_time = 0;
+      mom_time    = 0;
+      for (int n=0; n < nrepeat; n++) {
+        f0.deep_copy_to(f);
+        yakl::fence();
+        auto t0 = std::chrono::steady_clock::now();
+        if (RUN3D) { advect_scalar3D(f, flux); }
+        yakl::fence();
+        auto t1 = std::chrono::steady_clock::now();
+        advect2_mom_xy();
+        yakl::fence();
+        auto t2 = std::chrono::steady_clock::now();
+        scalar_time += std::chrono::duration<real>(t1-t0).count();
+        mom_time    += std::chrono::duration<real>(t2-t1).count();
+      }
+    };
+
+    real scalar_time_ref, mom_time_ref, scalar_time, mom_time;
+    // Warm up (page in the scratch arena and the pack work space)
+    int nrepeat_bench = nrepeat;
+    nrepeat = 1;
+    run(false, scalar_time_ref, mom_time_ref);
+    run(true , scalar_time    , mom_time    );
+    nrepeat = nrepeat_bench;
+
+    run(false, scalar_time_ref, mom_time_ref);
+    real4d fref    = f   .createDeviceCopy();
+    real2d fluxref = flux.createDeviceCopy();
+    real5d dudtref = dudt.createDeviceCopy();
+    real5d dvdtref = dvdt.createDeviceCopy();
+    real5d dwdtref = dwdt.createDeviceCopy();
+
+    run(true , scalar_time    , mom_time    );
+    real maxdiff = 0;
+    if (RUN3D) {
+      maxdiff = max(maxdiff, max_abs_diff(f   , fref   ));
+      maxdiff = max(maxdiff, max_abs_diff(flux, fluxref));
+    }
+    maxdiff = max(maxdiff, max_abs_diff(dudt, dudtref));
+    maxdiff = max(maxdiff, max_abs_diff(dvdt, dvdtref));
+    maxdiff = max(maxdiff, max_abs_diff(dwdt, dwdtref));
+
+    std::cout << std::scientific;
+    std::cout << "CRM size (nx x ny x nz): " << nx << " x " << ny << " x " << nz << "\n";
+    std::cout << "ncrms: " << ncrms << ", pack size: " << pack_size << ", repeats: " << nrepeat << "\n";
+    if (RUN3D) {
+      std::cout << "advect_scalar3D time per call [s], default: " << scalar_time_ref/nrepeat
+                << ", packed: " << scalar_time/nrepeat << ", speedup: " << scalar_time_ref/scalar_time << "\n";
+    }
+    std::cout << "advect2_mom_xy time per call [s],  default: " << mom_time_ref/nrepeat
+              << ", packed: " << mom_time/nrepeat << ", speedup: " << mom_time_ref/mom_time << "\n";
+    std::cout << "Max abs difference: " << maxdiff << "\n";
+
+    // The kernels are the same operations in the same order, so the results
+    // should match to round-off (bit-for-bit on serial builds)
+    int ierr = maxdiff > 1.e-12 ? -1 : 0;
+    std::cout << "Packed vs default: " << (ierr == 0 ? "PASS" : "FAIL") << std::endl;
+
+    f0      = real4d();
+    f       = real4d();
+    flux    = real2d();
+    fref    = real4d();
+    fluxref = real2d();
+    dudtref = real5d();
+    dvdtref = real5d();
+    dwdtref = real5d();
+    scratch_finalize();
+    finalize();
+
+    if (ierr != 0) {
+      yakl::finalize();
+      return ierr;
+    }
+  }
+  yakl::finalize();
+  return 0;
+}
+
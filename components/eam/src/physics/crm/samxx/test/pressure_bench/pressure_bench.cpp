@@ -0,0 +1,180 @@
+
+// Standalone benchmark of the anelastic pressure (Poisson) solve.
+//
+// The CRM dimensions are compile-time constants, so this is built once per
+// configuration (see CMakeLists.txt). It times the forward+inverse horizontal
+// transforms alone, checking that they are an identity, and the full spectral
+// solve, for the FFT backend samxx was compiled with. It also checks that the
+// backend gives the same coefficients (packed layout and 1/n normalization)
+// and the same pressure as the fft991 transforms.
+//
+// Usage: ./pressure_bench_2d [ncrms] [nrepeat]
+
+#include "vars.h"
+#include "pressure.h"
+#include "samxx_fft.h"
+#include "samxx_scratch.h"
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+// Max abs difference of a and b over (nzslab,nj,ni,ncrms), and max abs value of b
+void max_diff(real4d const &a, real4d const &b, int nzslab, int nj, int ni, real &diff, real &bmax) {
+  realHost4d aHost = a.createHostCopy();
+  realHost4d bHost = b.createHostCopy();
+  diff = 0;
+  bmax = 0;
+  for (int k=0; k < nzslab; k++) {
+    for (int j=0; j < nj; j++) {
+      for (int i=0; i < ni; i++) {
+        for (int icrm=0; icrm < ncrms; icrm++) {
+          diff = max(diff, abs(aHost(k,j,i,icrm)-bHost(k,j,i,icrm)));
+          bmax = max(bmax, abs(bHost(k,j,i,icrm)));
+        }
+      }
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  int nrepeat = 100;
+  ncrms = 64;
+  if (argc > 1) { ncrms   = atoi(argv[1]); }
+  if (argc > 2) { nrepeat = atoi(argv[2]); }
+
+  yakl::init();
+  {
+    allocate();
+
+    int constexpr nx2 = nx+2;
+    int constexpr ny2 = ny+2*YES3D;
+    int const nzslab  = max(1,nzm/nsubdomains);
+
+    // Reference-like stretched grid and density profile
+    dx = CRM_DX;
+    dy = CRM_DX;
+    YAKL_SCOPE( ncrms , :: ncrms );
+    YAKL_SCOPE( adz   , :: adz   );
+    YAKL_SCOPE( adzw  , :: adzw  );
+    YAKL_SCOPE( dz    , :: dz    );
+    YAKL_SCOPE( rho   , :: rho   );
+    YAKL_SCOPE( rhow  , :: rhow  );
+    parallel_for( SimpleBounds<2>(nz,ncrms) , YAKL_LAMBDA (int k, int icrm) {
+      if (k == 0) { dz(icrm) = 50.; }
+      if (k < nzm) {
+        adz (k,icrm) = 1. + 0.05*k;
+        rho (k,icrm) = 1.2*exp(-0.1*k);
+      }
+      adzw(k,icrm) = 1. + 0.05*k - 0.025;
+      rhow(k,icrm) = 1.2*exp(-0.1*k + 0.05);
+    });
+
+    scratch_allocate();
+
+    real4d f   ("f"   ,nzslab,ny2,nx2,ncrms);
+    real4d fref("fref",nzslab,ny2,nx2,ncrms);
+    parallel_for( SimpleBounds<4>(nzslab,ny2,nx2,ncrms) , YAKL_LAMBDA (int k, int j, int i, int icrm) {
+      if (j < ny && i < nx) {
+        fref(k,j,i,icrm) = sin(0.3*i + 0.7*j + 0.11*k + 0.01*icrm) + 0.1*cos(1.3*i*j + icrm);
+      } else {
+        fref(k,j,i,icrm) = 0.;
+      }
+    });
+
+    // Warm up (this is where the persistent plans, if any, are built)
+    fref.deep_copy_to(f);
+    pressure_fft_forward(f, nzslab);
+    pressure_fft_inverse(f, nzslab);
+    pressure_solve(f, nzslab);
+    yakl::fence();
+
+    // Same coefficients as fft991, for the entries used by the solver
+    int constexpr nypp = RUN3D ? ny+2 : 1;
+    real4d f991("f991",nzslab,ny2,nx2,ncrms);
+    real coef_err, coef_max;
+    fref.deep_copy_to(f);
+    fref.deep_copy_to(f991);
+    pressure_fft_forward(f, nzslab);
+    pressure_fft991_forward(f991, nzslab);
+    max_diff(f, f991, nzslab, nypp, nx+1, coef_err, coef_max);
+
+    // Same pressure as with the fft991 transforms
+    real press_err, press_max;
+    fref.deep_copy_to(f);
+    fref.deep_copy_to(f991);
+    pressure_solve(f, nzslab);
+    pressure_fft991_forward(f991, nzslab);
+    pressure_solve_spectral(f991, nzslab);
+    pressure_fft991_inverse(f991, nzslab);
+    max_diff(f, f991, nzslab, ny, nx, press_err, press_max);
+    f991 = real4d();
+
+    // Round trip transforms
+    fref.deep_copy_to(f);
+    yakl::fence();
+    auto t0 = std::chrono::steady_clock::now();
+    for (int n=0; n < nrepeat; n++) {
+      pressure_fft_forward(f, nzslab);
+      pressure_fft_inverse(f, nzslab);
+    }
+    yakl::fence();
+    auto t1 = std::chrono::steady_clock::now();
+
+    realHost4d fHost    = f.createHostCopy();
+    realHost4d frefHost = fref.createHostCopy();
+    real maxerr = 0;
+    for (int k=0; k < nzslab; k++) {
+      for (int j=0; j < ny; j++) {
+        for (int i=0; i < nx; i++) {
+          for (int icrm=0; icrm < ncrms; icrm++) {
+            maxerr = max(maxerr, abs(fHost(k,j,i,icrm)-frefHost(k,j,i,icrm)));
+          }
+        }
+      }
+    }
+
+    // Full Poisson solve
+    real solve_time = 0;
+    for (int n=0; n < nrepeat; n++) {
+      fref.deep_copy_to(f);
+      yakl::fence();
+      auto s0 = std::chrono::steady_clock::now();
+      pressure_solve(f, nzslab);
+      yakl::fence();
+      auto s1 = std::chrono::steady_clock::now();
+      solve_time += std::chrono::duration<real>(s1-s0).count();
+    }
+
+    real fft_time = std::chrono::duration<real>(t1-t0).count();
+    std::cout << std::scientific;
+    std::cout << "CRM size (nx x ny x nz): " << nx << " x " << ny << " x " << nz << "\n";
+    std::cout << "ncrms: " << ncrms << ", repeats: " << nrepeat << "\n";
+    std::cout << "FFT round trip time per call [s]: " << fft_time  /nrepeat << "\n";
+    std::cout << "Poisson solve time per call [s]:  " << solve_time/nrepeat << "\n";
+    std::cout << "FFT round trip max abs error:     " << maxerr << "\n";
+    std::cout << "Coefficients max rel diff to fft991: " << coef_err /coef_max  << "\n";
+    std::cout << "Pressure max rel diff to fft991:     " << press_err/press_max << "\n";
+
+    bool round_trip_ok = maxerr <= 1.e-10;
+    bool coef_ok       = coef_err  <= 1.e-12*coef_max;
+    bool press_ok      = press_err <= 1.e-10*press_max;
+    std::cout << "Round trip: "              << (round_trip_ok ? "PASS" : "FAIL") << "\n";
+    std::cout << "Coefficients vs fft991: "  << (coef_ok       ? "PASS" : "FAIL") << "\n";
+    std::cout << "Pressure vs fft991: "      << (press_ok      ? "PASS" : "FAIL") << std::endl;
+    int ierr = (round_trip_ok && coef_ok && press_ok) ? 0 : -1;
+
+    f    = real4d();
+    fref = real4d();
+    scratch_finalize();
+    pressure_fft_finalize();
+    finalize();
+
+    if (ierr != 0) {
+      yakl::finalize();
+      return ierr;
+    }
+  }
+  yakl::finalize();
+  return 0;
+}
+
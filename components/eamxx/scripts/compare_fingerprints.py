@@ -0,0 +1,138 @@
+from utils import expect
+
+import pathlib, struct
+
+###############################################################################
+class FingerprintLog(object):
+###############################################################################
+    """
+    Reader for the binary state fingerprint logs written by
+    AtmosphereProcess::record_state_fingerprint. The file is made of an 8-byte
+    header (b"EXXFP1\\n\\0"), followed by records, all in native (little endian)
+    byte order. Strings are stored as an int32 length followed by the characters.
+      - process record: 'P', int32 proc_id, string proc_name,
+                        int32 nfields, nfields strings (field_name@grid_name)
+      - hash record:    'H', int32 proc_id, int32 step, int32 subcycle,
+                        nfields uint64 (global hash of each field)
+    A process record is written the first time a process records its hashes,
+    and tells the field names of all subsequent hash records of that process.
+    """
+
+    HEADER = b"EXXFP1\n\0"
+
+    ###########################################################################
+    def __init__(self,file):
+    ###########################################################################
+
+        self._file = pathlib.Path(file).resolve().absolute()
+        expect (self._file.exists(),
+                "Error! File '{}' does not exist.".format(self._file))
+
+        self._data = self._file.read_bytes()
+        self._pos  = 0
+        expect (self._read(len(self.HEADER))==self.HEADER,
+                f"Error! File '{self._file}' is not a state fingerprint log.")
+
+    ###########################################################################
+    def _read(self,n):
+    ###########################################################################
+        expect (self._pos+n<=len(self._data),
+                f"Error! Unexpected end of file in '{self._file}'.")
+        chunk = self._data[self._pos:self._pos+n]
+        self._pos += n
+        return chunk
+
+    ###########################################################################
+    def _read_int(self):
+    ###########################################################################
+        return struct.unpack("<i",self._read(4))[0]
+
+    ###########################################################################
+    def _read_str(self):
+    ###########################################################################
+        return self._read(self._read_int()).decode()
+
+    ###########################################################################
+    def records(self):
+    ###########################################################################
+        """
+        Yields the hash records in the order they were written, as tuples
+        (proc_name, step, subcycle, [(field_name,hash),...])
+        """
+        procs = {}
+        while self._pos<len(self._data):
+            rtype = self._read(1)
+            pid = self._read_int()
+            if rtype==b'P':
+                name = self._read_str()
+                nfields = self._read_int()
+                procs[pid] = (name,[self._read_str() for _ in range(nfields)])
+            elif rtype==b'H':
+                expect (pid in procs,
+                        f"Error! Hash record for unknown process id {pid} in '{self._file}'.")
+                name, fields = procs[pid]
+                step = self._read_int()
+                subcycle = self._read_int()
+                hashes = struct.unpack(f"<{len(fields)}Q",self._read(8*len(fields)))
+                yield (name,step,subcycle,list(zip(fields,hashes)))
+            else:
+                expect (False, f"Error! Unrecognized record type {rtype} in '{self._file}'.")
+
+###############################################################################
+class CompareFingerprints(object):
+###############################################################################
+
+    ###########################################################################
+    def __init__(self,src,tgt,max_fields=10):
+    ###########################################################################
+
+        self._src = FingerprintLog(src)
+        self._tgt = FingerprintLog(tgt)
+        self._max_fields = max_fields
+
+    ###########################################################################
+    def run(self):
+    ###########################################################################
+        """
+        Walk the two logs in parallel, and report the first record (i.e., the
+        first process, step, and subcycle) where they differ. Returns True if
+        the two logs are identical.
+        """
+
+        src_recs = self._src.records()
+        tgt_recs = self._tgt.records()
+        nrecs = 0
+        while True:
+            s = next(src_recs,None)
+            t = next(tgt_recs,None)
+            if s is None and t is None:
+                print (f" All {nrecs} records match.")
+                return True
+            if s is None or t is None:
+                short = "source" if s is None else "target"
+                print (f" The {short} log ends after {nrecs} matching records.")
+                return False
+
+            s_name, s_step, s_sc, s_hashes = s
+            t_name, t_step, t_sc, t_hashes = t
+            if (s_name,s_step,s_sc)!=(t_name,t_step,t_sc):
+                print (f" The logs have a different sequence of records after {nrecs} matching records.\n"
+                       f"   - source: {s_name}, step {s_step}, subcycle {s_sc}\n"
+                       f"   - target: {t_name}, step {t_step}, subcycle {t_sc}")
+                return False
+
+            t_dict = dict(t_hashes)
+            diffs = [f for f,h in s_hashes if f in t_dict and t_dict[f]!=h]
+            missing = [f for f,_ in s_hashes if f not in t_dict] + \
+                      [f for f,_ in t_hashes if f not in dict(s_hashes)]
+            if diffs or missing:
+                print (f" First difference: process {s_name}, step {s_step}, subcycle {s_sc}")
+                if diffs:
+                    print (f"   - fields with different hashes ({len(diffs)}): "
+                           f"{', '.join(diffs[:self._max_fields])}"
+                           f"{', ...' if len(diffs)>self._max_fields else ''}")
+                if missing:
+                    print (f"   - fields in only one log: {', '.join(missing)}")
+                return False
+
+            nrecs += 1
@@ -721,6 +721,7 @@ void AtmosphereDriver::initialize_output_managers () {
   using vos_t = std::vector<std::string>;
   const auto& output_yaml_files = io_params.get<vos_t>("output_yaml_files",vos_t{});
   int om_tally = 0;
+  m_diag_cache = std::make_shared<DiagnosticCache>();
   for (const auto& fname : output_yaml_files) {
     ekat::ParameterList params;
     ekat::parse_yaml_file(fname,params);
@@ -739,6 +740,7 @@ void AtmosphereDriver::initialize_output_managers () {
     m_output_managers.emplace_back();
     auto& om = m_output_managers.back();
     om.set_logger(m_atm_logger);
+    om.set_diagnostic_cache(m_diag_cache);
     om.setup(m_atm_comm,params,m_field_mgrs,m_grids_manager,m_run_t0,m_case_t0,false);
   }
 
@@ -1646,6 +1648,16 @@ void AtmosphereDriver::run (const int dt) {
   m_atm_logger->info("[EAMxx::run] memory usage: " + std::to_string(max_mem_usage) + "MB");
 #endif
 
+  // If the surface coupling export is asynchronous, the copy to the cpl
+  // structures may still be in flight, overlapping the output above.
+  // Make sure it is done before returning control to the coupler.
+  for (int proc=0; proc<m_atm_process_group->get_num_processes(); ++proc) {
+    const auto atm_proc = m_atm_process_group->get_process_nonconst(proc);
+    if (atm_proc->type() == AtmosphereProcessType::SurfaceCouplingExporter) {
+      std::dynamic_pointer_cast<SurfaceCouplingExporter>(atm_proc)->complete_export();
+    }
+  }
+
   // Flush the logger at least once per time step.
   // Without this flush, depending on how much output we are loggin,
   // it might be several time steps before the file is updated.
@@ -1669,6 +1681,7 @@ void AtmosphereDriver::finalize ( /* inputs? */ ) {
     out_mgr.finalize();
   }
   m_output_managers.clear();
+  m_diag_cache = nullptr;
 
   // Finalize, and then destroy all atmosphere processes
   if (m_atm_process_group.get()) {
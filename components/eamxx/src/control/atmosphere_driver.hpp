@@ -203,6 +203,9 @@ protected:
 
   std::list<OutputManager>                  m_output_managers;
 
+  // Diagnostics requested by output streams, shared across all streams
+  std::shared_ptr<DiagnosticCache>          m_diag_cache;
+
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
   std::shared_ptr<SCDataManager>            m_surface_coupling_export_data_manager;
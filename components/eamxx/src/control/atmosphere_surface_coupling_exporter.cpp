@@ -13,7 +13,7 @@ namespace scream
 SurfaceCouplingExporter::SurfaceCouplingExporter (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
-
+  m_async_export = m_params.get<bool>("async_export",false);
 }
 // =========================================================================================
 void SurfaceCouplingExporter::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
@@ -156,6 +156,13 @@ void SurfaceCouplingExporter::setup_surface_coupling_data(const SCDataManager &s
 
   m_column_info_d = decltype(m_column_info_d) ("m_info", m_num_scream_exports);
   m_column_info_h = Kokkos::create_mirror_view(m_column_info_d);
+
+  // If the device can't access host memory, stage async exports in pinned memory
+  constexpr bool host_accessible =
+    Kokkos::SpaceAccessibility<DefaultDevice::memory_space,Kokkos::HostSpace>::accessible;
+  if (m_async_export and not host_accessible) {
+    m_cpl_exports_staging = pinned_view_2d("cpl_exports_staging", m_num_cols, m_num_cpl_exports);
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
@@ -197,6 +204,14 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   // Copy data to device for use in do_export()
   Kokkos::deep_copy(m_column_info_d, m_column_info_h);
 
+  m_cpl_to_scream_export = view_1d<DefaultDevice,int>("cpl_to_scream_export",m_num_cpl_exports);
+  auto cpl_to_scream_export_h = Kokkos::create_mirror_view(m_cpl_to_scream_export);
+  Kokkos::deep_copy(cpl_to_scream_export_h,-1);
+  for (int i=0; i<m_num_scream_exports; ++i) {
+    cpl_to_scream_export_h(m_cpl_indices_view(i)) = i;
+  }
+  Kokkos::deep_copy(m_cpl_to_scream_export,cpl_to_scream_export_h);
+
   // Set the number of exports from eamxx or set to a constant, default type = FROM_MODEL
   using vos_type = std::vector<std::string>;
   using vor_type = std::vector<Real>;
@@ -300,7 +315,10 @@ void SurfaceCouplingExporter::initialize_impl (const RunType /* run_type */)
   EKAT_REQUIRE_MSG(m_num_from_model_exports>=0,"Error! surface_coupling_exporter - The number of exports derived from EAMxx < 0, something must have gone wrong in assigning the types of exports for all variables.");
 
   // Perform initial export (if any are marked for export during initialization)
-  if (any_initial_exports) do_export(0, true);
+  if (any_initial_exports) {
+    do_export(0, true);
+    complete_export();
+  }
 }
 // =========================================================================================
 void SurfaceCouplingExporter::run_impl (const double dt)
@@ -519,44 +537,78 @@ void SurfaceCouplingExporter::compute_eamxx_exports(const double dt, const bool
       if (export_source(idx_Faxa_rainl)==FROM_MODEL) { Faxa_rainl(i) = precip_liq_surf_mass(i)/dt*(1000.0/PC::RHO_H2O); }
       if (export_source(idx_Faxa_snowl)==FROM_MODEL) { Faxa_snowl(i) = precip_ice_surf_mass(i)/dt*(1000.0/PC::RHO_H2O); }
     }
-  });
-  // Variables that are already surface vars in the ATM can just be copied directly.
-  if (m_export_source_h(idx_Faxa_swndr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndr, sfc_flux_dir_nir); }
-  if (m_export_source_h(idx_Faxa_swvdr)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdr, sfc_flux_dir_vis); }
-  if (m_export_source_h(idx_Faxa_swndf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swndf, sfc_flux_dif_nir); }
-  if (m_export_source_h(idx_Faxa_swvdf)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swvdf, sfc_flux_dif_vis); }
-  if (m_export_source_h(idx_Faxa_swnet)==FROM_MODEL) { Kokkos::deep_copy(Faxa_swnet, sfc_flux_sw_net); }
-  if (m_export_source_h(idx_Faxa_lwdn )==FROM_MODEL) { Kokkos::deep_copy(Faxa_lwdn,  sfc_flux_lw_dn); }
 
+    // Variables that are already surface vars in the ATM can just be copied directly.
+    if (export_source(idx_Faxa_swndr)==FROM_MODEL) { Faxa_swndr(i) = sfc_flux_dir_nir(i); }
+    if (export_source(idx_Faxa_swvdr)==FROM_MODEL) { Faxa_swvdr(i) = sfc_flux_dir_vis(i); }
+    if (export_source(idx_Faxa_swndf)==FROM_MODEL) { Faxa_swndf(i) = sfc_flux_dif_nir(i); }
+    if (export_source(idx_Faxa_swvdf)==FROM_MODEL) { Faxa_swvdf(i) = sfc_flux_dif_vis(i); }
+    if (export_source(idx_Faxa_swnet)==FROM_MODEL) { Faxa_swnet(i) = sfc_flux_sw_net(i); }
+    if (export_source(idx_Faxa_lwdn )==FROM_MODEL) { Faxa_lwdn(i)  = sfc_flux_lw_dn(i); }
+  });
 }
 // =========================================================================================
-void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
+template<typename ViewT>
+void SurfaceCouplingExporter::export_to_view (const ViewT& cpl_exports, const bool called_during_initialization)
 {
   using policy_type = KT::RangePolicy;
-  // Any field not exported by scream, or not exported
-  // during initialization, is set to 0.0
-  Kokkos::deep_copy(m_cpl_exports_view_d, 0.0);
-  const auto cpl_exports_view_d = m_cpl_exports_view_d;
-  const int  num_exports        = m_num_scream_exports;
-  const int  num_cols           = m_num_cols;
-  const auto col_info           = m_column_info_d;
-  // Export to cpl data
-  auto export_policy   = policy_type (0,num_exports*num_cols);
+  const int  num_cpl_exports      = m_num_cpl_exports;
+  const int  num_cols             = m_num_cols;
+  const auto col_info             = m_column_info_d;
+  const auto cpl_to_scream_export = m_cpl_to_scream_export;
+  // Export to cpl data. Any field not exported by scream, or not exported
+  // during initialization, is set to 0.0. The cpl index strides faster,
+  // so that consecutive threads write consecutive entries.
+  auto export_policy   = policy_type (0,num_cols*num_cpl_exports);
   Kokkos::parallel_for(export_policy, KOKKOS_LAMBDA(const int& i) {
-    const int ifield = i / num_cols;
-    const int icol   = i % num_cols;
-    const auto& info = col_info(ifield);
-    const auto offset = icol*info.col_stride + info.col_offset;
-
-    // if this is during initialization, check whether or not the field should be exported
-    bool do_export = (not called_during_initialization || info.transfer_during_initialization);
-    if (do_export) {
-      cpl_exports_view_d(icol,info.cpl_indx) = info.constant_multiple*info.data[offset];
+    const int icol   = i / num_cpl_exports;
+    const int icpl   = i % num_cpl_exports;
+    const int ifield = cpl_to_scream_export(icpl);
+
+    Real value = 0.0;
+    if (ifield>=0) {
+      const auto& info = col_info(ifield);
+      const auto offset = icol*info.col_stride + info.col_offset;
+
+      // if this is during initialization, check whether or not the field should be exported
+      bool do_export = (not called_during_initialization || info.transfer_during_initialization);
+      if (do_export) {
+        value = info.constant_multiple*info.data[offset];
+      }
     }
+    cpl_exports(icol,icpl) = value;
   });
+}
+// =========================================================================================
+void SurfaceCouplingExporter::do_export_to_cpl(const bool called_during_initialization)
+{
+  if (m_cpl_exports_staging.size()>0) {
+    // Write straight into pinned host memory
+    export_to_view(m_cpl_exports_staging,called_during_initialization);
+  } else {
+    export_to_view(m_cpl_exports_view_d,called_during_initialization);
+  }
+
+  m_export_pending = true;
+  if (not m_async_export) {
+    complete_export();
+  }
+}
+// =========================================================================================
+void SurfaceCouplingExporter::complete_export()
+{
+  if (not m_export_pending) {
+    return;
+  }
 
-  // Deep copy fields from device to cpl host array
-  Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  // Deep copy fields from device (or staging buffer) to cpl host array
+  Kokkos::fence();
+  if (m_cpl_exports_staging.size()>0) {
+    Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_staging);
+  } else {
+    Kokkos::deep_copy(m_cpl_exports_view_h,m_cpl_exports_view_d);
+  }
+  m_export_pending = false;
 }
 // =========================================================================================
 void SurfaceCouplingExporter::finalize_impl()
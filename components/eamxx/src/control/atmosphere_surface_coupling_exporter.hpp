@@ -84,6 +84,16 @@ public:
   void set_from_file_exports(const int dt);                                                   // Export vars are set by interpolation of data from files
   void do_export_to_cpl(const bool called_during_initialization=false);                       // Finish export by copying data to cpl structures.
 
+  // Fills all entries of the (num_cols,num_cpl_exports) view cpl_exports, in a single pass.
+  // Public only because it contains a device lambda.
+  template<typename ViewT>
+  void export_to_view (const ViewT& cpl_exports, const bool called_during_initialization);
+
+  // With async_export=true, do_export_to_cpl only launches the copy of the exports to the
+  // cpl structures, and this routine waits for it (and must be called before the cpl uses them).
+  // With async_export=false (default), this is a no-op.
+  void complete_export();
+
   // Take and store data from SCDataManager
   void setup_surface_coupling_data(const SCDataManager &sc_data_manager);
 protected:
@@ -141,6 +151,16 @@ protected:
   view_2d <DefaultDevice, Real> m_cpl_exports_view_d;
   uview_2d<HostDevice,    Real> m_cpl_exports_view_h;
 
+  // For async export on devices with separate memory, the export kernel writes directly
+  // into this pinned host buffer, which is copied into m_cpl_exports_view_h in complete_export().
+  using pinned_view_2d = Kokkos::View<Real**,Kokkos::LayoutRight,Kokkos::SharedHostPinnedSpace>;
+  bool            m_async_export = false;
+  bool            m_export_pending = false;
+  pinned_view_2d  m_cpl_exports_staging;
+
+  // For each cpl export, the index of the corresponding scream export (or -1 if none)
+  view_1d<DefaultDevice, int> m_cpl_to_scream_export;
+
   // Array storing the field names for exports
   name_t*                   m_export_field_names;
   std::vector<std::string>  m_export_field_names_vector;
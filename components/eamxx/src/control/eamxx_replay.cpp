@@ -0,0 +1,220 @@
+// Offline replay of the state captured by an atm process (see the
+// state_capture_file parameter of AtmosphereProcess).
+//
+// The process is built on a grid made of the captured columns only, with the
+// captured geometry data, and it is run repeatedly on the captured state.
+// Before each call to run, all the process fields are reset to the captured
+// values, so that each call sees the same (realistic) input. Each call is
+// timed with a GPTL timer, with a fence after the call.
+//
+// Usage: eamxx-replay <capture file> <params yaml file> [nsteps] [nwarmup]
+//
+// The yaml file contains the parameters of the atm process, as in the process
+// section of the EAMxx input yaml file (including the Type entry).
+// NOTE: the process time stamp advances at each call, so processes that do not
+//       do all their work at every step (e.g., rrtmgp with rad_frequency>1)
+//       should be configured to do so in the yaml file.
+
+#include "physics/register_physics.hpp"
+#include "share/atm_process/atmosphere_process.hpp"
+#include "share/atm_process/atmosphere_process_capture.hpp"
+#include "share/field/field_manager.hpp"
+#include "share/grid/point_grid.hpp"
+#include "share/grid/single_grid_grids_manager.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/scream_session.hpp"
+#include "share/util/scream_timing.hpp"
+
+#include "ekat/ekat_parse_yaml_file.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <numeric>
+#include <set>
+
+namespace scream {
+
+void replay (const ekat::Comm& comm, const std::string& capture_file,
+             const std::string& params_file, const int nsteps, const int nwarmup)
+{
+  auto sc = read_state_capture(capture_file);
+
+  // The replay must not capture again, and synthetic checks are not needed
+  auto params = ekat::parse_yaml_file(params_file);
+  params.set<std::string>("state_capture_file","");
+  params.set("enable_precondition_checks",false);
+  params.set("enable_postcondition_checks",false);
+
+  // A grid with the captured columns, split across ranks. Processes usually
+  // look up the physics grid by its alias.
+  auto grid = create_point_grid(sc.grid_name,sc.ncols,sc.nlevs,comm);
+  grid->add_alias("Physics");
+  const int nlocal = grid->get_num_local_dofs();
+  const int offset = nlocal>0 ? grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>()(0) : 0;
+  std::vector<int> cols(nlocal);
+  std::iota(cols.begin(),cols.end(),0);
+
+  // Copies a captured entry into f, restricting COL dimensions to this rank's columns
+  auto set_data = [&](StateCapture::Entry& e, const Field& f) {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    const bool by_col = fl.rank()>0 && fl.tag(0)==FieldTag::Column;
+    auto dims = e.layout.dims();
+    if (by_col) {
+      dims[0] = nlocal;
+    }
+    EKAT_REQUIRE_MSG (dims==fl.dims(),
+        "Error! Captured field layout is not compatible with the replay field layout.\n"
+        " - field name: " + f.name() + "\n"
+        " - captured layout: " + e.layout.to_string() + "\n"
+        " - replay layout: " + fl.to_string() + "\n");
+    const long long col_size = by_col ? fl.size() / nlocal : 0;
+    copy_field_data(f,e.data.data()+offset*col_size,cols,true);
+  };
+
+  for (auto& e : sc.geometry) {
+    auto dims = e.layout.dims();
+    if (e.layout.rank()>0 && e.layout.tag(0)==FieldTag::Column) {
+      dims[0] = nlocal;
+    }
+    FieldLayout fl (e.layout.tags(),dims,e.layout.names());
+    set_data(e,grid->create_geometry_data(e.name,fl));
+  }
+
+  // Create the atm proc
+  register_physics();
+  auto& apf = AtmosphereProcessFactory::instance();
+  const auto ap_type = params.isParameter("Type")
+                     ? params.get<std::string>("Type")
+                     : params.name();
+  auto ap = apf.create(ap_type,comm,params);
+  auto gm = std::make_shared<SingleGridGM>(grid);
+  ap->set_grids(gm);
+  EKAT_REQUIRE_MSG (ap->name()==sc.proc_name,
+      "Error! The state capture was written by a different atm process.\n"
+      " - capture file: " + capture_file + "\n"
+      " - captured atm proc: " + sc.proc_name + "\n"
+      " - replay atm proc: " + ap->name() + "\n");
+
+  // Create fields and groups, like the AtmosphereDriver does
+  auto fm = std::make_shared<FieldManager>(grid);
+  fm->registration_begins();
+  for (const auto& req : ap->get_required_field_requests()) fm->register_field(req);
+  for (const auto& req : ap->get_computed_field_requests()) fm->register_field(req);
+  for (const auto& req : ap->get_required_group_requests()) fm->register_group(req);
+  for (const auto& req : ap->get_computed_group_requests()) fm->register_group(req);
+  fm->registration_ends();
+  for (const auto& req : ap->get_computed_field_requests()) {
+    ap->set_computed_field(fm->get_field(req.fid));
+  }
+  for (const auto& req : ap->get_computed_group_requests()) {
+    ap->set_computed_group(fm->get_field_group(req.name));
+  }
+  for (const auto& req : ap->get_required_group_requests()) {
+    ap->set_required_group(fm->get_field_group(req.name).get_const());
+  }
+  for (const auto& req : ap->get_required_field_requests()) {
+    ap->set_required_field(fm->get_field(req.fid).get_const());
+  }
+  fm->init_fields_time_stamp(sc.t0);
+
+  ATMBufferManager buffer;
+  buffer.request_bytes(ap->requested_buffer_size_in_bytes());
+  buffer.allocate();
+  ap->init_buffers(buffer);
+
+  ap->initialize(sc.t0,RunType::Initial);
+
+  // All fields must be in the capture (initialize may have changed them)
+  std::map<std::string,StateCapture::Entry*> captured;
+  for (auto& e : sc.fields) {
+    captured[e.name] = &e;
+  }
+  std::vector<Field> fields;
+  std::set<std::string> added;
+  auto add = [&](const Field& f) {
+    if (f.data_type()==DataType::RealType && added.insert(f.name()).second) {
+      EKAT_REQUIRE_MSG (captured.count(f.name())==1,
+          "Error! Field not found in the state capture.\n"
+          " - capture file: " + capture_file + "\n"
+          " - field name: " + f.name() + "\n");
+      // Inputs are read-only in the atm proc, so write through the FM copy
+      fields.push_back(fm->has_field(f.name()) ? fm->get_field(f.name()) : f);
+    }
+  };
+  for (const auto& f : ap->get_fields_in())  add(f);
+  for (const auto& g : ap->get_groups_in())  for (const auto& e : g.m_fields) add(*e.second);
+  for (const auto& f : ap->get_fields_out()) add(f);
+  for (const auto& g : ap->get_groups_out()) for (const auto& e : g.m_fields) add(*e.second);
+  for (const auto& f : ap->get_internal_fields()) add(f);
+
+  auto reset_state = [&]() {
+    for (const auto& f : fields) {
+      set_data(*captured.at(f.name()),f);
+    }
+    Kokkos::fence();
+  };
+
+  for (int n=0; n<nwarmup; ++n) {
+    reset_state();
+    ap->run(sc.dt);
+    Kokkos::fence();
+  }
+
+  const std::string timer = "EAMxx::replay::" + ap->name();
+  for (int n=0; n<nsteps; ++n) {
+    reset_state();
+    start_timer(timer);
+    ap->run(sc.dt);
+    Kokkos::fence();
+    stop_timer(timer);
+  }
+  const double time_per_call = nsteps>0 ? get_timer_wallclock(timer) / nsteps : 0;
+
+  if (comm.am_i_root()) {
+    std::cout << "atm proc: " << ap->name() << ", captured at " << sc.t0.to_string()
+              << " (step " << sc.t0.get_num_steps() << ", dt=" << sc.dt << ")\n";
+    std::cout << "columns: " << sc.ncols << ", levels: " << sc.nlevs
+              << ", ranks: " << comm.size() << ", calls: " << nsteps << "\n";
+    std::cout << std::scientific;
+    std::cout << "time per call [s]: " << time_per_call
+              << ", time per column [s]: " << time_per_call/sc.ncols << std::endl;
+  }
+
+  ap->finalize();
+}
+
+} // namespace scream
+
+int main (int argc, char** argv) {
+  using namespace scream;
+
+  MPI_Init(&argc,&argv);
+  ekat::Comm comm(MPI_COMM_WORLD);
+  if (argc<3) {
+    if (comm.am_i_root()) {
+      std::cout << "Usage: " << argv[0] << " <capture file> <params yaml file> [nsteps] [nwarmup]\n";
+    }
+    MPI_Finalize();
+    return 1;
+  }
+  const int nsteps  = argc>3 ? std::atoi(argv[3]) : 10;
+  const int nwarmup = argc>4 ? std::atoi(argv[4]) : 1;
+
+  initialize_scream_session(comm.am_i_root());
+  scorpio::init_subsystem(comm);
+  bool gptl_was_inited;
+  init_gptl(gptl_was_inited);
+
+  replay(comm,argv[1],argv[2],nsteps,nwarmup);
+
+  if (not gptl_was_inited) {
+    finalize_gptl();
+  }
+  scorpio::finalize_subsystem();
+  finalize_scream_session();
+  MPI_Finalize();
+
+  return 0;
+}
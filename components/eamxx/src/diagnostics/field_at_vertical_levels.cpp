@@ -0,0 +1,219 @@
+#include "diagnostics/field_at_vertical_levels.hpp"
+#include "share/util/scream_universal_constants.hpp"
+
+#include "ekat/std_meta/ekat_std_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/util/ekat_units.hpp"
+
+namespace scream
+{
+
+// =========================================================================================
+FieldAtVerticalLevels::
+FieldAtVerticalLevels (const ekat::Comm& comm, const ekat::ParameterList& params)
+ : AtmosphereDiagnostic(comm,params)
+{
+  m_field_name  = m_params.get<std::string>("field_name");
+  m_levels_name = m_params.get<std::string>("vertical_levels");
+
+  const auto coord = m_params.get<std::string>("vertical_coordinate","pressure");
+  EKAT_REQUIRE_MSG (coord=="pressure" or coord=="height_above_sealevel" or coord=="height_above_surface",
+      "Error! Invalid vertical coordinate for FieldAtVerticalLevels.\n"
+      " - field name         : " + m_field_name + "\n"
+      " - vertical coordinate: " + coord + "\n"
+      " - valid options      : pressure, height_above_sealevel, height_above_surface\n");
+
+  if (m_params.isParameter("levels")) {
+    for (auto l : m_params.get<std::vector<double>>("levels")) {
+      m_levels.push_back(l);
+    }
+  } else {
+    EKAT_REQUIRE_MSG (coord=="pressure",
+        "Error! Predefined sets of levels are only available for the pressure coordinate.\n"
+        " - field name         : " + m_field_name + "\n"
+        " - vertical coordinate: " + coord + "\n");
+    m_levels = get_named_levels(m_levels_name);
+    EKAT_REQUIRE_MSG (m_levels.size()>0,
+        "Error! Unrecognized set of pressure levels for FieldAtVerticalLevels.\n"
+        " - field name : " + m_field_name + "\n"
+        " - levels name: " + m_levels_name + "\n"
+        " - valid names: plev3, plev4, plev8, plev19\n");
+  }
+
+  // Consistently with FieldAtPressureLevel and FieldAtHeight, values outside
+  // the column are masked for pressure, and extrapolated as constant for height
+  m_mask_out_of_range = coord=="pressure";
+  m_mask_val = m_params.get<double>("mask_value",Real(constants::DefaultFillValue<float>::value));
+
+  if (coord=="pressure") {
+    m_coord_prefix = "p";
+    m_diag_name = m_field_name + "_at_" + m_levels_name;
+  } else {
+    m_coord_prefix = coord=="height_above_sealevel" ? "z" : "height";
+    m_diag_name = m_field_name + "_at_" + m_levels_name + "_above_" + ekat::split(coord,"_above_").back();
+  }
+}
+
+std::vector<Real> FieldAtVerticalLevels::
+get_named_levels (const std::string& name)
+{
+  // CMIP6 pressure levels sets
+  if (name=="plev3") {
+    return {85000, 50000, 25000};
+  } else if (name=="plev4") {
+    return {92500, 85000, 50000, 25000};
+  } else if (name=="plev8") {
+    return {100000, 85000, 70000, 50000, 25000, 10000, 5000, 1000};
+  } else if (name=="plev19") {
+    return {100000, 92500, 85000, 70000, 60000, 50000, 40000, 30000, 25000, 20000,
+             15000, 10000,  7000,  5000,  3000,  2000,  1000,   500,   100};
+  }
+  return {};
+}
+
+void FieldAtVerticalLevels::
+set_grids (const std::shared_ptr<const GridsManager> grids_manager)
+{
+  const auto& gname = m_params.get<std::string>("grid_name");
+  add_field<Required>(m_field_name,gname);
+
+  // We don't know yet which one we need
+  add_field<Required>(m_coord_prefix+"_mid",gname);
+  add_field<Required>(m_coord_prefix+"_int",gname);
+}
+
+void FieldAtVerticalLevels::
+initialize_impl (const RunType /*run_type*/)
+{
+  const auto& f = get_field_in(m_field_name);
+  const auto& fid = f.get_header().get_identifier();
+
+  // Sanity checks
+  using namespace ShortFieldTagsNames;
+  const auto& layout = fid.get_layout();
+  EKAT_REQUIRE_MSG (f.data_type()==DataType::RealType,
+      "Error! FieldAtVerticalLevels only supports Real data type field.\n"
+      " - field name: " + fid.name() + "\n"
+      " - field data type: " + e2str(f.data_type()) + "\n");
+  EKAT_REQUIRE_MSG (layout.rank()>=2 && layout.rank()<=3,
+      "Error! Field rank not supported by FieldAtVerticalLevels.\n"
+      " - field name: " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+  const auto tag = layout.tags().back();
+  EKAT_REQUIRE_MSG (tag==LEV || tag==ILEV,
+      "Error! FieldAtVerticalLevels diagnostic expects a layout ending with 'LEV'/'ILEV' tag.\n"
+      " - field name  : " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+
+  m_coord_name = m_coord_prefix + (tag==LEV ? "_mid" : "_int");
+
+  const int ncols = layout.dim(0);
+  const int ntgt  = m_levels.size();
+
+  // All good, create the diag output. The target levels are not a model vertical
+  // dimension, so use a CMP tag (named after the levels set), to make sure
+  // remappers do not treat them as model levels.
+  auto d_layout = layout.clone().strip_dim(tag).append_dim(CMP,ntgt,m_levels_name);
+  FieldIdentifier d_fid (m_diag_name,d_layout,fid.get_units(),fid.get_grid_name());
+  m_diagnostic_output = Field(d_fid);
+  m_diagnostic_output.allocate_view();
+
+  if (m_mask_out_of_range) {
+    // The mask is the same for all components of a vector field, so it has layout (COL,levels)
+    auto nondim = ekat::units::Units::nondimensional();
+    const auto& gname = fid.get_grid_name();
+
+    std::string mask_name = name() + " mask";
+    FieldLayout mask_layout({COL,CMP},{ncols,ntgt},{e2str(COL),m_levels_name});
+    FieldIdentifier mask_fid (mask_name,mask_layout, nondim, gname);
+    Field diag_mask(mask_fid);
+    diag_mask.allocate_view();
+    m_diagnostic_output.get_header().set_extra_data("mask_data",diag_mask);
+    m_diagnostic_output.get_header().set_extra_data("mask_value",m_mask_val);
+  }
+
+  using stratts_t = std::map<std::string,std::string>;
+
+  // Propagate any io string attribute from input field to diag field
+  const auto& src = get_fields_in().front();
+  const auto& src_atts = src.get_header().get_extra_data<stratts_t>("io: string attributes");
+        auto& dst_atts = m_diagnostic_output.get_header().get_extra_data<stratts_t>("io: string attributes");
+  for (const auto& [name, val] : src_atts) {
+    dst_atts[name] = val;
+  }
+
+  // Get the brackets, shared with all other diags interpolating on the same levels
+  m_brackets = get_vertical_interp_brackets(fid.get_grid_name(),m_levels_name,m_coord_name,
+                                            m_levels,ncols,m_mask_out_of_range);
+}
+
+// =========================================================================================
+void FieldAtVerticalLevels::compute_diagnostic_impl()
+{
+  using KT = KokkosTypes<DefaultDevice>;
+  using MemberType = typename KT::MemberType;
+
+  // Search the brackets (no-op if another diag already did it for the current coordinate)
+  m_brackets->update(get_field_in(m_coord_name));
+
+  const auto k_v = m_brackets->get_indices();
+  const auto w_v = m_brackets->get_weights();
+
+  const Field& f = get_field_in(m_field_name);
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const int ncols = fl.dim(0);
+  const int ntgt  = m_levels.size();
+
+  const bool do_mask = m_mask_out_of_range;
+  const auto mval = m_mask_val;
+  decltype(m_diagnostic_output.get_view<Real**>()) mask;
+  if (do_mask) {
+    mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real**>();
+  }
+
+  // All target levels (and components) of a column are done in a single kernel
+  if (fl.rank()==2) {
+    auto diag = m_diagnostic_output.get_view<Real**>();
+    auto f_v  = f.get_view<const Real**>();
+    auto policy = KT::TeamPolicy(ncols,ntgt);
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int icol = team.league_rank();
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ntgt),[&](const int ilev) {
+        const int k = k_v(icol,ilev);
+        if (k<0) {
+          diag(icol,ilev) = mval;
+        } else {
+          const Real w = w_v(icol,ilev);
+          diag(icol,ilev) = (1-w)*f_v(icol,k) + w*f_v(icol,k+1);
+        }
+        if (do_mask) {
+          mask(icol,ilev) = k<0 ? 0 : 1;
+        }
+      });
+    });
+  } else {
+    const int ndims = fl.dim(1);
+    auto diag = m_diagnostic_output.get_view<Real***>();
+    auto f_v  = f.get_view<const Real***>();
+    auto policy = KT::TeamPolicy(ncols,ndims*ntgt);
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int icol = team.league_rank();
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ndims*ntgt),[&](const int idx) {
+        const int idim = idx / ntgt;
+        const int ilev = idx % ntgt;
+        const int k = k_v(icol,ilev);
+        if (k<0) {
+          diag(icol,idim,ilev) = mval;
+        } else {
+          const Real w = w_v(icol,ilev);
+          diag(icol,idim,ilev) = (1-w)*f_v(icol,idim,k) + w*f_v(icol,idim,k+1);
+        }
+        if (do_mask and idim==0) {
+          mask(icol,ilev) = k<0 ? 0 : 1;
+        }
+      });
+    });
+  }
+}
+
+} //namespace scream
@@ -0,0 +1,70 @@
+#ifndef EAMXX_FIELD_AT_VERTICAL_LEVELS_HPP
+#define EAMXX_FIELD_AT_VERTICAL_LEVELS_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "diagnostics/vertical_interp_brackets.hpp"
+
+namespace scream
+{
+
+/*
+ * This diagnostic will produce a field interpolated on a set of pressure
+ * (or height) levels, such as the CMIP plev19 set. The output field has the
+ * target levels as its last dimension.
+ *
+ * Unlike FieldAtPressureLevel/FieldAtHeight, the search of the bracketing source
+ * levels is not done by each diagnostic: all FieldAtVerticalLevels instances
+ * interpolating on the same levels share the same VerticalInterpBrackets, so the
+ * search is done once per step, no matter how many fields are interpolated.
+ *
+ * Parameters:
+ *  - field_name: the name of the input field
+ *  - grid_name: the name of the grid of the input field
+ *  - vertical_levels: the name of the set of levels. If "levels" is not
+ *    specified, it must be one of the predefined pressure sets (see get_named_levels)
+ *  - levels: the values of the target levels (optional)
+ *  - vertical_coordinate: one of 'pressure' (default, levels in Pa),
+ *    'height_above_sealevel', 'height_above_surface' (levels in m)
+ *  - mask_value: value used for targets outside the column (pressure only)
+ */
+
+class FieldAtVerticalLevels : public AtmosphereDiagnostic
+{
+public:
+
+  // Constructors
+  FieldAtVerticalLevels (const ekat::Comm& comm, const ekat::ParameterList& params);
+
+  // The name of the diagnostic
+  std::string name () const { return m_diag_name; }
+
+  // Set the grid
+  void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
+
+  // Predefined sets of pressure levels (in Pa). Returns an empty vector if name is not recognized
+  static std::vector<Real> get_named_levels (const std::string& name);
+
+protected:
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  void compute_diagnostic_impl ();
+protected:
+  void initialize_impl (const RunType /*run_type*/);
+
+  std::string         m_field_name;
+  std::string         m_diag_name;
+  std::string         m_levels_name;
+  std::string         m_coord_prefix;
+  std::string         m_coord_name;
+
+  std::vector<Real>   m_levels;
+  bool                m_mask_out_of_range;
+  Real                m_mask_val;
+
+  std::shared_ptr<VerticalInterpBrackets> m_brackets;
+}; // class FieldAtVerticalLevels
+
+} //namespace scream
+
+#endif // EAMXX_FIELD_AT_VERTICAL_LEVELS_HPP
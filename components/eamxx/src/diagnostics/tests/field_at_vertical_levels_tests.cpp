@@ -0,0 +1,183 @@
+#include "catch2/catch.hpp"
+
+#include "diagnostics/field_at_vertical_levels.hpp"
+#include "diagnostics/register_diagnostics.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_utils.hpp"
+#include "share/util/scream_setup_random_test.hpp"
+
+namespace scream {
+
+TEST_CASE("field_at_vertical_levels")
+{
+  using namespace ShortFieldTagsNames;
+
+  register_diagnostics();
+
+  // Get an MPI comm group for test
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager w/ a point grid
+  int ncols = 5;
+  int ndims = 2;
+  int nlevs = 32;
+  int num_global_cols = ncols*comm.size();
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,num_global_cols);
+  gm->build_grids();
+  auto grid = gm->get_grid("Point Grid");
+
+  const auto Pa = ekat::units::Pa;
+  const auto m  = ekat::units::m;
+  FieldIdentifier p_mid_fid ("p_mid",FieldLayout({COL,LEV}, {ncols,nlevs}),  Pa,grid->name());
+  FieldIdentifier p_int_fid ("p_int",FieldLayout({COL,ILEV},{ncols,nlevs+1}),Pa,grid->name());
+  FieldIdentifier z_mid_fid ("z_mid",FieldLayout({COL,LEV}, {ncols,nlevs}),  m, grid->name());
+  FieldIdentifier z_int_fid ("z_int",FieldLayout({COL,ILEV},{ncols,nlevs+1}),m, grid->name());
+  FieldIdentifier s_fid ("s",FieldLayout({COL,    LEV},{ncols,      nlevs}),m,grid->name());
+  FieldIdentifier t_fid ("t",FieldLayout({COL,    LEV},{ncols,      nlevs}),m,grid->name());
+  FieldIdentifier v_fid ("v",FieldLayout({COL,CMP,LEV},{ncols,ndims,nlevs}),m,grid->name());
+
+  Field p_mid (p_mid_fid), p_int (p_int_fid), z_mid (z_mid_fid), z_int (z_int_fid);
+  Field s (s_fid), t (t_fid), v (v_fid);
+  for (auto f : {&p_mid,&p_int,&z_mid,&z_int,&s,&t,&v}) {
+    f->allocate_view();
+    f->get_header().get_tracking().update_time_stamp(t0);
+  }
+
+  // Pressure goes from p_top to p_surf (varying with the column), and z goes from
+  // z_top to 0. Fields are linear in the vertical coordinate, so interpolation is exact.
+  const Real p_top = 5000;
+  const Real z_top = 20000;
+  auto p_v = p_mid.get_view<Real**,Host>();
+  auto z_v = z_mid.get_view<Real**,Host>();
+  auto s_v = s.get_view<Real**,Host>();
+  auto t_v = t.get_view<Real**,Host>();
+  auto v_v = v.get_view<Real***,Host>();
+  auto p_surf = [&](const int icol) { return 90000 + icol*5000; };
+  for (int icol=0; icol<ncols; ++icol) {
+    for (int k=0; k<nlevs; ++k) {
+      p_v(icol,k) = p_top + (p_surf(icol)-p_top)*(k+0.5)/nlevs;
+      z_v(icol,k) = z_top*(nlevs-k-0.5)/nlevs;
+      s_v(icol,k) = 2*p_v(icol,k) + icol;
+      t_v(icol,k) = 3*z_v(icol,k) - icol;
+      for (int d=0; d<ndims; ++d) {
+        v_v(icol,d,k) = (d+1)*p_v(icol,k);
+      }
+    }
+  }
+  for (auto f : {&p_mid,&z_mid,&s,&t,&v}) {
+    f->sync_to_dev();
+  }
+
+  auto& factory = AtmosphereDiagnosticFactory::instance();
+  auto create_diag = [&](const Field& f, ekat::ParameterList pl) {
+    pl.set("field_name",f.name());
+    pl.set("grid_name",grid->name());
+    auto diag = factory.create("FieldAtVerticalLevels",comm,pl);
+    diag->set_grids(gm);
+    for (const auto& req : diag->get_required_field_requests()) {
+      const auto& n = req.fid.name();
+      if (n==f.name()) {
+        diag->set_required_field(f);
+      } else if (n=="p_mid") {
+        diag->set_required_field(p_mid);
+      } else if (n=="p_int") {
+        diag->set_required_field(p_int);
+      } else if (n=="z_mid") {
+        diag->set_required_field(z_mid);
+      } else if (n=="z_int") {
+        diag->set_required_field(z_int);
+      }
+    }
+    diag->initialize(t0,RunType::Initial);
+    return diag;
+  };
+
+  const Real tol = std::numeric_limits<Real>::epsilon()*1e3;
+  const Real mask_val = -1;
+
+  SECTION ("plev19") {
+    ekat::ParameterList pl;
+    pl.set<std::string>("vertical_levels","plev19");
+    pl.set<double>("mask_value",mask_val);
+    auto diag_s = create_diag(s,pl);
+    auto diag_v = create_diag(v,pl);
+    REQUIRE (diag_s->name()=="s_at_plev19");
+
+    diag_s->compute_diagnostic();
+    diag_v->compute_diagnostic();
+
+    // Both diags share the same brackets, which were computed only once
+    const auto levels = FieldAtVerticalLevels::get_named_levels("plev19");
+    auto brackets = get_vertical_interp_brackets(grid->name(),"plev19","p_mid",levels,ncols,true);
+    REQUIRE (brackets->num_updates()==1);
+
+    const auto& ds = diag_s->get_diagnostic();
+    const auto& dv = diag_v->get_diagnostic();
+    const std::vector<int> s_dims = {ncols,19};
+    const std::vector<int> v_dims = {ncols,ndims,19};
+    REQUIRE (ds.get_header().get_identifier().get_layout().dims()==s_dims);
+    REQUIRE (dv.get_header().get_identifier().get_layout().dims()==v_dims);
+    ds.sync_to_host();
+    dv.sync_to_host();
+    auto mask = ds.get_header().get_extra_data<Field>("mask_data");
+    mask.sync_to_host();
+    auto ds_v = ds.get_view<const Real**,Host>();
+    auto dv_v = dv.get_view<const Real***,Host>();
+    auto m_v  = mask.get_view<const Real**,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<19; ++ilev) {
+        const Real p = levels[ilev];
+        if (p<p_v(icol,0) or p>p_v(icol,nlevs-1)) {
+          REQUIRE (ds_v(icol,ilev)==mask_val);
+          REQUIRE (m_v(icol,ilev)==0);
+          for (int d=0; d<ndims; ++d) {
+            REQUIRE (dv_v(icol,d,ilev)==mask_val);
+          }
+        } else {
+          REQUIRE (std::abs(ds_v(icol,ilev)-(2*p+icol)) <= tol*2*p);
+          REQUIRE (m_v(icol,ilev)==1);
+          for (int d=0; d<ndims; ++d) {
+            REQUIRE (std::abs(dv_v(icol,d,ilev)-(d+1)*p) <= tol*(d+1)*p);
+          }
+        }
+      }
+    }
+
+    // Once p_mid is updated, brackets are recomputed (only once)
+    util::TimeStamp t1 = t0 + 60;
+    for (auto f : {&p_mid,&s,&v}) {
+      f->get_header().get_tracking().update_time_stamp(t1);
+    }
+    diag_s->compute_diagnostic();
+    diag_v->compute_diagnostic();
+    REQUIRE (brackets->num_updates()==2);
+  }
+
+  SECTION ("height") {
+    ekat::ParameterList pl;
+    const std::vector<double> levels = {50000, 10000, 2000, 10, 0};
+    pl.set<std::string>("vertical_levels","zlev5");
+    pl.set<std::string>("vertical_coordinate","height_above_sealevel");
+    pl.set("levels",levels);
+    auto diag = create_diag(t,pl);
+    REQUIRE (diag->name()=="t_at_zlev5_above_sealevel");
+    diag->compute_diagnostic();
+
+    const auto& d = diag->get_diagnostic();
+    REQUIRE (not d.get_header().has_extra_data("mask_data"));
+    d.sync_to_host();
+    auto d_v = d.get_view<const Real**,Host>();
+    for (int icol=0; icol<ncols; ++icol) {
+      for (int ilev=0; ilev<5; ++ilev) {
+        // Outside the column, values are extrapolated as constant
+        const Real z = std::max(std::min(Real(levels[ilev]),z_v(icol,0)),z_v(icol,nlevs-1));
+        REQUIRE (std::abs(d_v(icol,ilev)-(3*z-icol)) <= tol*std::max(Real(1),3*z));
+      }
+    }
+  }
+}
+
+} // namespace scream
@@ -0,0 +1,140 @@
+#include "diagnostics/vertical_interp_brackets.hpp"
+
+#include <map>
+#include <sstream>
+
+namespace scream
+{
+
+VerticalInterpBrackets::
+VerticalInterpBrackets (const std::string& coord_name,
+                        const std::vector<Real>& levels,
+                        const int ncols,
+                        const bool mask_out_of_range)
+ : m_coord_name (coord_name)
+ , m_mask_out_of_range (mask_out_of_range)
+{
+  EKAT_REQUIRE_MSG (levels.size()>0,
+      "Error! VerticalInterpBrackets requires at least one target level.\n"
+      "  - coordinate name: " + coord_name + "\n");
+
+  const int nlevs = levels.size();
+  m_levels = decltype(m_levels)("levels",nlevs);
+  auto levels_h = Kokkos::create_mirror_view(m_levels);
+  for (int i=0; i<nlevs; ++i) {
+    levels_h(i) = levels[i];
+  }
+  Kokkos::deep_copy(m_levels,levels_h);
+
+  m_k = view_2d<int>("k",ncols,nlevs);
+  m_w = view_2d<Real>("w",ncols,nlevs);
+  m_k_c = m_k;
+  m_w_c = m_w;
+}
+
+void VerticalInterpBrackets::update (const Field& coord)
+{
+  const auto& ts = coord.get_header().get_tracking().get_time_stamp();
+  if (ts.is_valid() and m_ts.is_valid() and ts==m_ts) {
+    // Brackets are already up to date
+    return;
+  }
+
+  compute(coord);
+  m_ts = ts;
+}
+
+void VerticalInterpBrackets::compute (const Field& coord)
+{
+  using MemberType = typename KT::MemberType;
+
+  const auto& layout = coord.get_header().get_identifier().get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()==2 and layout.dim(0)==static_cast<int>(m_k.extent(0)),
+      "Error! Invalid layout for the vertical coordinate of VerticalInterpBrackets.\n"
+      "  - coordinate name: " + coord.name() + "\n"
+      "  - coordinate layout: " + layout.to_string() + "\n"
+      "  - expected number of columns: " + std::to_string(m_k.extent(0)) + "\n");
+
+  const int ncols = layout.dim(0);
+  const int nlevs = layout.dim(1);
+  const int ntgt  = num_levels();
+  EKAT_REQUIRE_MSG (nlevs>=2,
+      "Error! VerticalInterpBrackets requires at least two source levels.\n"
+      "  - coordinate name: " + coord.name() + "\n");
+
+  const auto x_v = coord.get_view<const Real**>();
+  const auto tgt = m_levels;
+  const auto k_v = m_k;
+  const auto w_v = m_w;
+  const bool mask = m_mask_out_of_range;
+
+  auto policy = KT::TeamPolicy(ncols,ntgt);
+  Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+    const int icol = team.league_rank();
+    auto x = ekat::subview(x_v,icol);
+
+    // Coordinate can be increasing (pressure) or decreasing (height) with the level index
+    const Real s = x(nlevs-1)>x(0) ? 1 : -1;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,ntgt),[&](const int ilev) {
+      const Real t = tgt(ilev);
+      if (s*t<s*x(0)) {
+        k_v(icol,ilev) = mask ? -1 : 0;
+        w_v(icol,ilev) = 0;
+      } else if (s*t>s*x(nlevs-1)) {
+        k_v(icol,ilev) = mask ? -1 : nlevs-2;
+        w_v(icol,ilev) = 1;
+      } else {
+        // Find the last k such that s*x(k)<=s*t
+        int lo = 0, hi = nlevs-1;
+        while (hi-lo>1) {
+          const int mid = (lo+hi)/2;
+          if (s*x(mid)<=s*t) {
+            lo = mid;
+          } else {
+            hi = mid;
+          }
+        }
+        if (s*x(hi)<=s*t) {
+          // Corner case: t==x(nlevs-1)
+          k_v(icol,ilev) = nlevs-2;
+          w_v(icol,ilev) = 1;
+        } else {
+          k_v(icol,ilev) = lo;
+          w_v(icol,ilev) = (t-x(lo)) / (x(lo+1)-x(lo));
+        }
+      }
+    });
+  });
+
+  ++m_num_updates;
+}
+
+std::shared_ptr<VerticalInterpBrackets>
+get_vertical_interp_brackets (const std::string& grid_name,
+                              const std::string& levels_name,
+                              const std::string& coord_name,
+                              const std::vector<Real>& levels,
+                              const int ncols,
+                              const bool mask_out_of_range)
+{
+  // Weak ptrs, so that brackets are released (before Kokkos is finalized)
+  // once all the diagnostics using them are destroyed.
+  static std::map<std::string,std::weak_ptr<VerticalInterpBrackets>> registry;
+
+  std::stringstream ss;
+  ss << grid_name << ":" << coord_name << ":" << levels_name << ":" << ncols << ":" << mask_out_of_range << ":";
+  ss.precision(17);
+  for (auto l : levels) {
+    ss << l << ",";
+  }
+  const auto key = ss.str();
+
+  auto brackets = registry[key].lock();
+  if (not brackets) {
+    brackets = std::make_shared<VerticalInterpBrackets>(coord_name,levels,ncols,mask_out_of_range);
+    registry[key] = brackets;
+  }
+  return brackets;
+}
+
+} //namespace scream
@@ -0,0 +1,89 @@
+#ifndef EAMXX_VERTICAL_INTERP_BRACKETS_HPP
+#define EAMXX_VERTICAL_INTERP_BRACKETS_HPP
+
+#include "share/field/field.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Bracketing indices and weights for the linear interpolation of column data
+ * onto a fixed set of target values of a vertical coordinate (e.g., p_mid, z_mid).
+ *
+ * For each column icol and target level ilev, the interpolated value of a field f is
+ *
+ *    (1-w(icol,ilev))*f(icol,k(icol,ilev)) + w(icol,ilev)*f(icol,k(icol,ilev)+1)
+ *
+ * If the target is outside the range of the coordinate, then
+ *  - if mask_out_of_range=true, k(icol,ilev)=-1;
+ *  - otherwise, the value is extrapolated as constant (k and w select the closest end).
+ *
+ * The search is redone only if the time stamp of the coordinate field changed
+ * since the last call to update, so that multiple diagnostics interpolating
+ * different fields on the same levels only pay for the search once per step.
+ */
+
+class VerticalInterpBrackets
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  VerticalInterpBrackets (const std::string& coord_name,
+                          const std::vector<Real>& levels,
+                          const int ncols,
+                          const bool mask_out_of_range);
+
+  // Recompute brackets, unless coord's time stamp is the same as last time
+  void update (const Field& coord);
+
+  const std::string& coord_name () const { return m_coord_name; }
+  int num_levels () const { return m_levels.extent(0); }
+  bool mask_out_of_range () const { return m_mask_out_of_range; }
+
+  const view_2d<const int>&  get_indices () const { return m_k_c; }
+  const view_2d<const Real>& get_weights () const { return m_w_c; }
+
+  // Number of searches performed so far (for testing purposes)
+  int num_updates () const { return m_num_updates; }
+
+#ifndef KOKKOS_ENABLE_CUDA
+protected:
+#endif
+  void compute (const Field& coord);
+protected:
+
+  std::string                      m_coord_name;
+  typename KT::template view_1d<Real>  m_levels;
+  bool                             m_mask_out_of_range;
+
+  view_2d<int>        m_k;
+  view_2d<Real>       m_w;
+  view_2d<const int>  m_k_c;
+  view_2d<const Real> m_w_c;
+
+  util::TimeStamp     m_ts;
+  int                 m_num_updates = 0;
+};
+
+// Retrieve brackets for a given (grid, coordinate, set of levels), creating them if
+// needed. Brackets are shared among all callers requesting the same key, and they
+// are released once the last user is gone.
+std::shared_ptr<VerticalInterpBrackets>
+get_vertical_interp_brackets (const std::string& grid_name,
+                              const std::string& levels_name,
+                              const std::string& coord_name,
+                              const std::vector<Real>& levels,
+                              const int ncols,
+                              const bool mask_out_of_range);
+
+} //namespace scream
+
+#endif // EAMXX_VERTICAL_INTERP_BRACKETS_HPP
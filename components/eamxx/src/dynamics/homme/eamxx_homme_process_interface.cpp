@@ -699,7 +699,10 @@ void HommeDynamics::homme_post_process (const double dt) {
   const auto T_view  = get_field_out("T_mid").get_view<Pack**>();
   const auto T_prev_view = m_helper_fields.at("FT_phys").get_view<Pack**>();
 
-  m_helper_fields.at("FM_phys").deep_copy(get_field_out("horiz_winds"));
+  // Store uv at end of the dyn timestep in FM_phys (to back out tendencies later).
+  // This is done in the kernel below, rather than with a separate deep copy.
+  const auto v_view  = get_field_out("horiz_winds").get_view<const Pack***>();
+  const auto V_prev_view = m_helper_fields.at("FM_phys").get_view<Pack***>();
 
   const auto ncols = m_phys_grid->get_num_local_dofs();
   const auto nlevs = m_phys_grid->get_num_vertical_levels();
@@ -754,8 +757,10 @@ void HommeDynamics::homme_post_process (const double dt) {
       T_val = PF::calculate_temperature_from_virtual_temperature(T_val,qv(ilev));
       T_val = PF::calculate_T_from_theta(T_val,p_mid(ilev));
 
-      // Store T at end of the dyn timestep (to back out tendencies later)
+      // Store T and uv at end of the dyn timestep (to back out tendencies later)
       T_prev(ilev) = T_val;
+      V_prev_view(icol,0,ilev) = v_view(icol,0,ilev);
+      V_prev_view(icol,1,ilev) = v_view(icol,1,ilev);
     });
   });
 
@@ -0,0 +1,182 @@
+#include "cosp_native_functions.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/ekat_pack.hpp"
+
+namespace scream {
+namespace CospNativeFunc {
+
+void main (const int ncol, const int nsubcol, const int nlay,
+           const Real emsfc_lw, const std::uint64_t step_seed,
+           const view_1d<const Real>& sunlit,  const view_1d<const Real>& skt,
+           const view_2d<const Real>& T_mid,   const view_2d<const Real>& p_mid,
+           const view_2d<const Real>& p_int,   const view_2d<const Real>& z_mid,
+           const view_2d<const Real>& qv,      const view_2d<const Real>& cldfrac,
+           const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
+           const view_1d<Real>& isccp_cldtot,  const view_3d<Real>& isccp_ctptau,
+           const view_3d<Real>& modis_ctptau,  const view_3d<Real>& misr_cthtau)
+{
+  using MT  = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  // Histograms are accumulated with atomics, so start from zero
+  Kokkos::deep_copy(isccp_cldtot, 0);
+  Kokkos::deep_copy(isccp_ctptau, 0);
+  Kokkos::deep_copy(modis_ctptau, 0);
+  Kokkos::deep_copy(misr_cthtau,  0);
+
+  // Each subcolumn contributes this much (in percent) to the column statistics
+  const Real w = 100.0 / nsubcol;
+
+  // One team per column, one thread per subcolumn. Each thread walks down the column
+  // once, generating the subcolumn cloud mask and accumulating what all simulators need.
+  const auto policy = ESU::get_default_team_policy(ncol, nsubcol);
+  Kokkos::parallel_for("CospNativeFunc::main", policy, KOKKOS_LAMBDA(const MT& team) {
+    const int i = team.league_rank();
+    if (sunlit(i)==0) {
+      return;
+    }
+
+    // Seed from the surface pressure (like COSP does), so that results do not
+    // depend on the domain decomposition, and from the step, so that the
+    // subcolumns change in time.
+    const std::uint64_t seed = static_cast<std::uint64_t>(p_int(i,nlay))*2654435761ULL + step_seed;
+
+    // Tropopause, used to bound the ISCCP cloud top search
+    int itrop = 0;
+    Real attrop = 1e10;
+    for (int k=0; k<nlay; ++k) {
+      if (p_mid(i,k)>5000 && p_mid(i,k)<40000 && T_mid(i,k)<attrop) {
+        attrop = T_mid(i,k);
+        itrop = k;
+      }
+    }
+
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team, nsubcol), [&](const int isub) {
+      Real threshold = 0;
+      bool cloudy_above = false;
+
+      Real tau = 0;
+
+      // ISCCP: TOA 10.5 micron fluxes for the all-sky and clear-sky subcolumn
+      Real fluxtop = 0, trans = 1;
+      Real fluxtop_clr = 0, trans_clr = 1;
+
+      // MODIS: extinction-weighted pressure down to tau=1
+      Real modis_tau = 0, modis_prod = 0;
+
+      // MISR: height where optical depth from the top reaches 1, or lowest cloud
+      Real misr_z = -99999, z_last_cloud = -99999;
+
+      for (int k=0; k<nlay; ++k) {
+        // SCOPS, maximum-random overlap
+        const Real cf = cldfrac(i,k);
+        bool cloudy;
+        if (nsubcol==1) {
+          cloudy = true;
+        } else {
+          const Real ran = uniform_random(seed,isub,k);
+          if (k==0) {
+            threshold = ran;
+          } else {
+            const Real threshold_min = ekat::impl::min(cldfrac(i,k-1),cf);
+            const bool maxosc = cloudy_above && threshold<threshold_min;
+            if (not maxosc) {
+              threshold = threshold_min + (1-threshold_min)*ran;
+            }
+          }
+          cloudy = threshold < cf;
+        }
+        cloudy_above = cloudy;
+
+        // Subcolumn optics. With a single subcolumn, use grid-box mean values
+        Real dtau = 0, demis = 0;
+        if (cloudy) {
+          const Real scale = nsubcol==1 ? cf : 1;
+          dtau  = scale*dtau067(i,k);
+          demis = 1 - exp(-scale*dtau105(i,k));
+        }
+        tau += dtau;
+
+        // ISCCP
+        const Real dem_wv = wv_emissivity(p_mid(i,k), p_int(i,k+1)-p_int(i,k), T_mid(i,k), qv(i,k));
+        const Real bb = planck_11(T_mid(i,k));
+        const Real dem = 1 - (1-dem_wv)*(1-demis);
+        fluxtop     += dem*bb*trans;
+        trans       *= 1-dem;
+        fluxtop_clr += dem_wv*bb*trans_clr;
+        trans_clr   *= 1-dem_wv;
+
+        // MODIS
+        if (dtau>0 && modis_tau<1) {
+          const Real dx = ekat::impl::min(dtau, 1-modis_tau);
+          modis_prod += p_int(i,k)*dx;
+          modis_tau  += dx;
+        }
+
+        // MISR
+        if (dtau>0) {
+          z_last_cloud = z_mid(i,k);
+          if (misr_z==-99999 && tau>=1) {
+            misr_z = z_mid(i,k);
+          }
+        }
+      }
+
+      const int itau = tau_bin(tau);
+
+      // ISCCP
+      if (tau>isccp_taumin) {
+        const Real bb_sfc = planck_11(skt(i));
+        fluxtop     += emsfc_lw*bb_sfc*trans;
+        fluxtop_clr += emsfc_lw*bb_sfc*trans_clr;
+
+        // Adjust the cloud top temperature for semi-transparent clouds (top_height=1)
+        const Real tauir = tau/2.13;
+        const Real emcld = 1 - exp(-tauir);
+        const Real flux = ekat::impl::max(Real(1e-6), (fluxtop - (1-emcld)*fluxtop_clr)/emcld);
+        const Real tb = 1307.27/log(1 + 1/flux);
+
+        // Highest pair of levels (from the tropopause down) whose temperatures
+        // bracket tb, with log(p) interpolated between them (top_height_direction=2).
+        // If there is none, the cloud top is the tropopause if tb is colder than
+        // it, and the subcolumn is not counted otherwise (ptop=0 in icarus).
+        Real ptop = 0;
+        bool found = false;
+        for (int k=itrop; k<nlay-1 && not found; ++k) {
+          const Real t1 = T_mid(i,k);
+          const Real t2 = T_mid(i,k+1);
+          if ((t1>=tb && t2<=tb) || (t1<=tb && t2>=tb)) {
+            const Real logp1 = log(p_mid(i,k));
+            const Real logp2 = log(p_mid(i,k+1));
+            ptop = t2!=t1 ? exp(logp1 + (logp2-logp1)*(tb-t1)/(t2-t1)) : p_mid(i,k);
+            found = true;
+          }
+        }
+        if (not found && tb<=attrop) {
+          ptop = p_mid(i,itrop);
+        }
+
+        if (ptop>0) {
+          Kokkos::atomic_add(&isccp_cldtot(i), w);
+          Kokkos::atomic_add(&isccp_ctptau(i,itau,prs_bin(ptop)), w);
+        }
+      }
+
+      // MODIS
+      if (tau>modis_taumin) {
+        const Real ctp = modis_prod/modis_tau;
+        Kokkos::atomic_add(&modis_ctptau(i,itau,prs_bin(ctp)), w);
+      }
+
+      // MISR
+      if (tau>misr_taumin) {
+        const Real cth = misr_z==-99999 ? z_last_cloud : misr_z;
+        Kokkos::atomic_add(&misr_cthtau(i,itau,cth_bin(cth)), w);
+      }
+    });
+  });
+}
+
+} // namespace CospNativeFunc
+} // namespace scream
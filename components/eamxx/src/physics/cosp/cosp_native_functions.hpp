@@ -0,0 +1,142 @@
+#ifndef SCREAM_COSP_NATIVE_FUNCTIONS_HPP
+#define SCREAM_COSP_NATIVE_FUNCTIONS_HPP
+
+#include "share/scream_types.hpp"
+
+#include <cstdint>
+#include <limits>
+
+namespace scream {
+
+/*
+ * Device-native (Kokkos) implementation of the subset of COSP used by EAMxx.
+ *
+ * This is an alternative to the F90 bridge in cosp_functions.hpp, which requires
+ * syncing all inputs to host and permuting them to layoutLeft. Everything here
+ * runs on the device views of the fields, and writes directly into the output views.
+ *
+ * What is implemented:
+ *  - SCOPS subcolumn generator, with maximum-random overlap (COSP overlap=3).
+ *    Random numbers come from a counter-based generator seeded with the column
+ *    surface pressure, so results do not depend on the number of ranks, but they
+ *    are not BFB with the mo_rng generator used by the F90 code.
+ *  - ISCCP simulator (icarus), with top_height=1 (cloud top pressure adjusted via
+ *    the simulated 10.5 micron brightness temperature, including water vapor
+ *    continuum emission) and top_height_direction=2.
+ *  - MODIS cloud top pressure vs optical thickness joint histogram, with cloud top
+ *    pressure defined as the extinction-weighted pressure down to tau=1 (i.e., no
+ *    CO2 slicing), and no reflectance-based retrieval of tau (the subcolumn tau is used).
+ *  - MISR cloud top height vs optical thickness joint histogram, with the cloud top
+ *    height defined as the height at which the optical depth from the top reaches 1.
+ *
+ * All histograms are expressed in percent of the number of subcolumns, and are
+ * only computed for sunlit columns (zero elsewhere), consistently with cosp_c2f.
+ */
+
+namespace CospNativeFunc {
+
+using KT = ekat::KokkosTypes<DefaultDevice>;
+
+template <typename S>
+using view_1d = typename KT::template view_1d<S>;
+template <typename S>
+using view_2d = typename KT::template view_2d<S>;
+template <typename S>
+using view_3d = typename KT::template view_3d<S>;
+
+// Bins of the joint histograms (same as COSP). Pressure bins are ordered
+// from the surface up, like in COSP's pres_binBounds.
+constexpr int num_tau_bins = 7;
+constexpr int num_prs_bins = 7;
+constexpr int num_cth_bins = 16;
+
+// Thresholds for cloud detection
+constexpr Real isccp_taumin = 0.3;
+constexpr Real modis_taumin = 0.3;
+constexpr Real misr_taumin  = 0.3;
+
+KOKKOS_INLINE_FUNCTION
+int tau_bin (const Real tau) {
+  constexpr Real edges[num_tau_bins+1] = {0.0, 0.3, 1.3, 3.6, 9.4, 23.0, 60.0, 100000.0};
+  for (int b=num_tau_bins-1; b>0; --b) {
+    if (tau>=edges[b]) return b;
+  }
+  return 0;
+}
+
+KOKKOS_INLINE_FUNCTION
+int prs_bin (const Real p) {
+  constexpr Real edges[num_prs_bins+1] = {100000.0, 80000.0, 68000.0, 56000.0, 44000.0, 31000.0, 18000.0, 0.0};
+  for (int b=num_prs_bins-1; b>0; --b) {
+    if (p<edges[b]) return b;
+  }
+  return 0;
+}
+
+KOKKOS_INLINE_FUNCTION
+int cth_bin (const Real z) {
+  constexpr Real edges[num_cth_bins+1] = {-99999.0, 0.0, 500.0, 1000.0, 1500.0, 2000.0, 2500.0, 3000.0,
+                                          4000.0, 5000.0, 7000.0, 9000.0, 11000.0, 13000.0, 15000.0,
+                                          17000.0, 99999.0};
+  for (int b=num_cth_bins-1; b>0; --b) {
+    if (z>=edges[b]) return b;
+  }
+  return 0;
+}
+
+// Counter-based uniform random number in [0,1), from the splitmix64 finalizer.
+KOKKOS_INLINE_FUNCTION
+Real uniform_random (const std::uint64_t seed, const int isub, const int ilev) {
+  std::uint64_t z = seed + 0x9E3779B97F4A7C15ULL*(1 + static_cast<std::uint64_t>(isub)*4099 + ilev);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  z =  z ^ (z >> 31);
+  // Keep only as many bits as Real represents exactly, so that the result is < 1
+  // also in single precision (for double, this is the usual 53 bits).
+  constexpr int nbits = std::numeric_limits<Real>::digits;
+  return static_cast<Real>(z >> (64-nbits)) / static_cast<Real>(std::uint64_t(1) << nbits);
+}
+
+// Planck function at 10.5 micron (up to a constant), as in icarus
+KOKKOS_INLINE_FUNCTION
+Real planck_11 (const Real T) {
+  return 1 / (exp(1307.27/T) - 1);
+}
+
+// Emissivity of the water vapor continuum in a layer, as in icarus
+KOKKOS_INLINE_FUNCTION
+Real wv_emissivity (const Real p_mid, const Real dp, const Real T, const Real qv) {
+  constexpr Real wtmair = 28.9644;
+  constexpr Real wtmh20 = 18.01534;
+  constexpr Real Navo   = 6.023e23;
+  constexpr Real grav   = 9.806650e2;   // cm/s2
+  constexpr Real pstd   = 1.013250e6;   // dyne/cm2
+  constexpr Real t0     = 296;
+
+  const Real press  = p_mid*10;   // Pa -> dyne/cm2
+  const Real atmden = dp*10/grav; // g/cm2
+  const Real rvh20  = qv*wtmair/wtmh20;
+  const Real wk     = rvh20*Navo*atmden/wtmair;
+  const Real rhoave = (press/pstd)*(t0/T);
+  const Real rh20s  = rvh20*rhoave;
+  const Real rfrgn  = rhoave - rh20s;
+  const Real tmpexp = exp(-0.02*(T-t0));
+  const Real tauwv  = wk*1e-20*((0.0224697*rh20s*tmpexp) + (3.41817e-7*rfrgn))*0.98;
+  return 1 - exp(-tauwv);
+}
+
+// Run the native simulators for all columns. Outputs are overwritten.
+void main (const int ncol, const int nsubcol, const int nlay,
+           const Real emsfc_lw, const std::uint64_t step_seed,
+           const view_1d<const Real>& sunlit,  const view_1d<const Real>& skt,
+           const view_2d<const Real>& T_mid,   const view_2d<const Real>& p_mid,
+           const view_2d<const Real>& p_int,   const view_2d<const Real>& z_mid,
+           const view_2d<const Real>& qv,      const view_2d<const Real>& cldfrac,
+           const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
+           const view_1d<Real>& isccp_cldtot,  const view_3d<Real>& isccp_ctptau,
+           const view_3d<Real>& modis_ctptau,  const view_3d<Real>& misr_cthtau);
+
+} // namespace CospNativeFunc
+} // namespace scream
+
+#endif // SCREAM_COSP_NATIVE_FUNCTIONS_HPP
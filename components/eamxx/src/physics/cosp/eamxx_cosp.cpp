@@ -1,5 +1,6 @@
 #include "eamxx_cosp.hpp"
 #include "cosp_functions.hpp"
+#include "cosp_native_functions.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
 #include "ekat/ekat_assert.hpp"
@@ -25,6 +26,10 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to run the Kokkos implementation of the simulators, which works on device
+  // data directly, rather than bridging to the F90 COSP library on host
+  m_use_native = m_params.get<bool>("cosp_use_native", false);
 }
 
 // =========================================================================================
@@ -99,7 +104,9 @@ void Cosp::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
 void Cosp::initialize_impl (const RunType /* run_type */)
 {
   // Set property checks for fields in this process
-  CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
+  if (not m_use_native) {
+    CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
+  }
 
 
   // Add note to output files about processing ISCCP fields that are only valid during
@@ -134,6 +141,11 @@ void Cosp::run_impl (const double dt)
   auto ts = timestamp();
   auto update_cosp = cosp_do(cosp_freq_in_steps, ts.get_num_steps());
 
+  if (m_use_native) {
+    run_native(update_cosp);
+    return;
+  }
+
   // Get fields from field manager; note that we get host views because this
   // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
   // all then need to be copied to layoutLeft views to permute the indices for
@@ -254,11 +266,80 @@ void Cosp::run_impl (const double dt)
   get_field_out("cosp_sunlit").sync_to_dev();
 }
 
+// =========================================================================================
+void Cosp::run_native (const bool update_cosp)
+{
+  using PFD = scream::PhysicsFunctions<DefaultDevice>;
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  auto isccp_cldtot = get_field_out("isccp_cldtot").get_view<Real*>();
+  auto isccp_ctptau = get_field_out("isccp_ctptau").get_view<Real***>();
+  auto modis_ctptau = get_field_out("modis_ctptau").get_view<Real***>();
+  auto misr_cthtau  = get_field_out("misr_cthtau").get_view<Real***>();
+  auto cosp_sunlit  = get_field_out("cosp_sunlit").get_view<Real*>();
+
+  if (not update_cosp) {
+    // See comment in run_impl about how to recover the time-averaged statistics
+    Kokkos::deep_copy(isccp_cldtot, 0.0);
+    Kokkos::deep_copy(isccp_ctptau, 0.0);
+    Kokkos::deep_copy(modis_ctptau, 0.0);
+    Kokkos::deep_copy(misr_cthtau, 0.0);
+    Kokkos::deep_copy(cosp_sunlit, 0.0);
+    return;
+  }
+
+  auto qv      = get_field_in("qv").get_view<const Real**>();
+  auto sunlit  = get_field_in("sunlit").get_view<const Real*>();
+  auto skt     = get_field_in("surf_radiative_T").get_view<const Real*>();
+  auto T_mid   = get_field_in("T_mid").get_view<const Real**>();
+  auto p_mid   = get_field_in("p_mid").get_view<const Real**>();
+  auto p_int   = get_field_in("p_int").get_view<const Real**>();
+  auto phis    = get_field_in("phis").get_view<const Real*>();
+  auto pseudo_density = get_field_in("pseudo_density").get_view<const Real**>();
+  auto cldfrac = get_field_in("cldfrac_rad").get_view<const Real**>();
+  auto dtau067 = get_field_in("dtau067").get_view<const Real**>();
+  auto dtau105 = get_field_in("dtau105").get_view<const Real**>();
+
+  // Compute heights (on device)
+  const auto ncol = m_num_cols;
+  const auto nlev = m_num_levs;
+  const auto z_mid = CospNativeFunc::view_2d<Real>("z_mid", ncol, nlev);
+  const auto z_int = CospNativeFunc::view_2d<Real>("z_int", ncol, nlev+1);
+  const auto dz = z_mid;  // reuse tmp memory for dz
+  const auto scan_policy = ESU::get_thread_range_parallel_scan_team_policy(ncol, nlev);
+  Kokkos::parallel_for(scan_policy, KOKKOS_LAMBDA (const KT::MemberType& team) {
+      const int i = team.league_rank();
+      const auto dz_s    = ekat::subview(dz,    i);
+      const auto p_mid_s = ekat::subview(p_mid, i);
+      const auto T_mid_s = ekat::subview(T_mid, i);
+      const auto qv_s    = ekat::subview(qv, i);
+      const auto z_int_s = ekat::subview(z_int, i);
+      const auto z_mid_s = ekat::subview(z_mid, i);
+      const Real z_surf  = phis(i) / 9.81;
+      const auto pseudo_density_s = ekat::subview(pseudo_density, i);
+      PFD::calculate_dz(team, pseudo_density_s, p_mid_s, T_mid_s, qv_s, dz_s);
+      team.team_barrier();
+      PFD::calculate_z_int(team,nlev,dz_s,z_surf,z_int_s);
+      team.team_barrier();
+      PFD::calculate_z_mid(team,nlev,z_int_s,z_mid_s);
+      team.team_barrier();
+  });
+
+  // Night values are left at zero, since our I/O does not handle masked values in averages
+  const Real emsfc_lw = 0.99;
+  Kokkos::deep_copy(cosp_sunlit, sunlit);
+  CospNativeFunc::main(ncol, m_num_subcols, nlev, emsfc_lw, timestamp().get_num_steps(),
+                       sunlit, skt, T_mid, p_mid, p_int, z_mid, qv, cldfrac, dtau067, dtau105,
+                       isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau);
+}
+
 // =========================================================================================
 void Cosp::finalize_impl()
 {
   // Finalize COSP wrappers
-  CospFunc::finalize();
+  if (not m_use_native) {
+    CospFunc::finalize();
+  }
 }
 // =========================================================================================
 
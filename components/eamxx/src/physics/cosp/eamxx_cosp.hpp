@@ -58,6 +58,8 @@ protected:
 public:
 #endif
   void run_impl        (const double dt);
+  // Run the device-native simulators (see cosp_native_functions.hpp)
+  void run_native      (const bool update_cosp);
 protected:
   void finalize_impl   ();
 
@@ -73,6 +75,9 @@ protected:
   Int m_num_ctp = 7;
   Int m_num_cth = 16;
 
+  // Whether to use the device-native simulators rather than the F90 bridge
+  bool m_use_native;
+
   std::shared_ptr<const AbstractGrid> m_grid;
 
 }; // class Cosp
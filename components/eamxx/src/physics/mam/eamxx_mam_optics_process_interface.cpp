@@ -245,8 +245,29 @@ void MAMOptics::initialize_impl(const RunType run_type) {
   //aerosol forward scattered fraction * tau * w
   tau_f_sw_= mam_coupling::view_3d("tau_f_sw_", ncol_, nswbands_, nlev_ + 1);
 
-  // read table info
-  {
+  // The optics tables are read only once per process: if another instance already
+  // read the same tables, simply reuse its (device) views.
+  std::vector<std::string> table_files;
+  for(int imode = 0; imode < ntot_amode; imode++) {
+    table_files.push_back(m_params.get<std::string>(
+        "mam4_mode" + std::to_string(imode+1) + "_physical_properties_file"));
+  }
+  table_files.push_back(m_params.get<std::string>("mam4_water_refindex_file"));
+  for (const std::string spec_name : {"soa","dust","nacl","so4","pom","bc","mom"}) {
+    table_files.push_back(m_params.get<std::string>(
+        "mam4_" + spec_name + "_physical_properties_file"));
+  }
+  std::string tables_key;
+  for (const auto& fname : table_files) {
+    tables_key += fname + ";";
+  }
+  const auto cache_dir =
+      m_params.get<std::string>("mam4_optics_table_cache_dir", "");
+
+  shared_optics_data_ = mam_coupling::get_shared_optics_data(tables_key);
+  if (shared_optics_data_) {
+    aerosol_optics_device_data_ = *shared_optics_data_;
+  } else {
     using namespace ShortFieldTagsNames;
 
     using view_1d_host = typename KT::view_1d<Real>::HostMirror;
@@ -276,7 +297,8 @@ void MAMOptics::initialize_impl(const RunType run_type) {
                                      imode,  // mode No
                                      rrtmg_params, grid_, host_views, layouts,
                                      aerosol_optics_host_data,
-                                     aerosol_optics_device_data_);
+                                     aerosol_optics_device_data_,
+                                     cache_dir);
     }
 
     std::string table_name_water =
@@ -285,7 +307,8 @@ void MAMOptics::initialize_impl(const RunType run_type) {
     // it will syn data to device.
     mam_coupling::read_water_refindex(table_name_water, grid_,
                                       aerosol_optics_device_data_.crefwlw,
-                                      aerosol_optics_device_data_.crefwsw);
+                                      aerosol_optics_device_data_.crefwsw,
+                                      cache_dir);
     //
     {
       // make a list of host views
@@ -322,10 +345,8 @@ void MAMOptics::initialize_impl(const RunType run_type) {
         // read data
         // need to update table name
         params_aero.set("Filename", fname);
-        AtmosphereInput refindex_aerosol(params_aero, grid_, host_views_aero,
-                                         layouts_aero);
-        refindex_aerosol.read_variables();
-        refindex_aerosol.finalize();
+        mam_coupling::read_optics_table(params_aero, grid_, host_views_aero,
+                                        layouts_aero, cache_dir);
         // copy data to device
         mam_coupling::set_refindex_aerosol(
             species_id, host_views_aero,
@@ -340,6 +361,11 @@ void MAMOptics::initialize_impl(const RunType run_type) {
           aerosol_optics_device_data_.specrefindex_lw, "long_wave",
           specrefndxlw_host);
     }
+
+    shared_optics_data_ =
+        std::make_shared<mam_coupling::AerosolOpticsDeviceData>(
+            aerosol_optics_device_data_);
+    mam_coupling::register_shared_optics_data(tables_key, shared_optics_data_);
   }
   //FIXME: We are hard-coding the band ordering in RRTMGP.
   //TODO: We can update optics file using the ordering below (rrtmg_to_rrtmgp_swbands_).
@@ -171,6 +171,9 @@ class MAMOptics final : public scream::AtmosphereProcess {
   // long wave extinction in the units of [1/km]
   mam_coupling::view_3d ext_cmip6_lw_;
   mam4::modal_aer_opt::AerosolOpticsDeviceData aerosol_optics_device_data_;
+  // keeps the optics tables alive in the process-wide registry, so that other
+  // users of the same tables can share them
+  std::shared_ptr<mam_coupling::AerosolOpticsDeviceData> shared_optics_data_;
   // physics grid for column information
   std::shared_ptr<const AbstractGrid> grid_;
   mam_coupling::view_2d work_;
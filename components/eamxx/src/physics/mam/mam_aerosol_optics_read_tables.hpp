@@ -3,6 +3,7 @@
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "mam_coupling.hpp"
+#include "mam_optics_tables.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -145,7 +146,8 @@ inline void read_rrtmg_table(
     const std::map<std::string, view_1d_host> &host_views_1d,
     const std::map<std::string, FieldLayout> &layouts,
     const AerosolOpticsHostData &aerosol_optics_host_data,
-    const AerosolOpticsDeviceData &aerosol_optics_device_data) {
+    const AerosolOpticsDeviceData &aerosol_optics_device_data,
+    const std::string &cache_dir = "") {
   constexpr int refindex_real = mam4::modal_aer_opt::refindex_real;
   constexpr int refindex_im   = mam4::modal_aer_opt::refindex_im;
   constexpr int coef_number   = mam4::modal_aer_opt::coef_number;
@@ -157,9 +159,7 @@ inline void read_rrtmg_table(
                                refindex_im);
 
   params.set("Filename", table_filename);
-  AtmosphereInput rrtmg(params, grid, host_views_1d, layouts);
-  rrtmg.read_variables();
-  rrtmg.finalize();
+  read_optics_table(params, grid, host_views_1d, layouts, cache_dir);
 
   // copy data from host to device for mode 1
   int d1 = imode;
@@ -256,7 +256,8 @@ inline void read_rrtmg_table(
 inline void read_water_refindex(const std::string &table_filename,
                                 const std::shared_ptr<const AbstractGrid> &grid,
                                 const complex_view_1d &crefwlw,
-                                const complex_view_1d &crefwsw) {
+                                const complex_view_1d &crefwsw,
+                                const std::string &cache_dir = "") {
   // refractive index for water read in read_water_refindex
   // crefwsw(nswbands) ! complex refractive index for water visible
   // crefwlw(nlwbands) ! complex refractive index for water infrared
@@ -300,9 +301,7 @@ inline void read_water_refindex(const std::string &table_filename,
   layouts_water.emplace("refindex_real_water_lw",refindex_water_lw_layout);
 
   // create a object to read data
-  AtmosphereInput refindex_water(params, grid, host_views_water, layouts_water);
-  refindex_water.read_variables();
-  refindex_water.finalize();
+  read_optics_table(params, grid, host_views_water, layouts_water, cache_dir);
 
   //  maybe make a 1D vied of Kokkos::complex<Real>
   const auto crefwlw_host = Kokkos::create_mirror_view(crefwlw);
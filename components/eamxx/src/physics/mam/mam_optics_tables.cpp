@@ -0,0 +1,279 @@
+#include "physics/mam/mam_optics_tables.hpp"
+
+#include <netcdf.h> // for serial NetCDF file reads on MPI root
+
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace scream::mam_coupling {
+
+namespace {
+
+constexpr char cache_magic[9] = "EAMXXOPT";
+constexpr std::int32_t cache_version = 1;
+
+// FNV-1a, 64 bits
+constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime  = 1099511628211ULL;
+
+void fnv1a (const char* data, const std::size_t n, std::uint64_t& h) {
+  for (std::size_t i=0; i<n; ++i) {
+    h ^= static_cast<unsigned char>(data[i]);
+    h *= fnv_prime;
+  }
+}
+
+std::string to_hex (const std::uint64_t h) {
+  std::stringstream ss;
+  ss << std::hex << std::setw(16) << std::setfill('0') << h;
+  return ss.str();
+}
+
+using strvec_t = std::vector<std::string>;
+
+// Try to load all host views from the cache file. Returns false if the file does
+// not exist or does not match what we expect (in which case the views are garbage).
+bool load_from_cache (const std::string& cache_file,
+                      const strvec_t& names,
+                      const std::map<std::string,view_1d_host>& host_views)
+{
+  std::ifstream in(cache_file, std::ios::binary);
+  if (not in.good()) {
+    return false;
+  }
+
+  char magic[8];
+  std::int32_t version, real_size, nvars;
+  in.read(magic,8);
+  in.read(reinterpret_cast<char*>(&version),sizeof(version));
+  in.read(reinterpret_cast<char*>(&real_size),sizeof(real_size));
+  in.read(reinterpret_cast<char*>(&nvars),sizeof(nvars));
+  if (not in.good() || std::strncmp(magic,cache_magic,8)!=0 ||
+      version!=cache_version || real_size!=sizeof(Real) ||
+      nvars!=static_cast<std::int32_t>(names.size())) {
+    return false;
+  }
+
+  for (const auto& name : names) {
+    std::int32_t len;
+    std::int64_t size;
+    in.read(reinterpret_cast<char*>(&len),sizeof(len));
+    if (not in.good() || len!=static_cast<std::int32_t>(name.size())) {
+      return false;
+    }
+    std::string n(len,' ');
+    in.read(&n.front(),len);
+    in.read(reinterpret_cast<char*>(&size),sizeof(size));
+    const auto& v = host_views.at(name);
+    if (not in.good() || n!=name || size!=static_cast<std::int64_t>(v.size())) {
+      return false;
+    }
+    in.read(reinterpret_cast<char*>(v.data()),sizeof(Real)*size);
+  }
+  return in.good();
+}
+
+void write_to_cache (const std::string& cache_file,
+                     const strvec_t& names,
+                     const std::map<std::string,view_1d_host>& host_views)
+{
+  // Write to a tmp file and rename, so that concurrent runs sharing the cache
+  // directory never see a partially written file. The tmp name is unique to
+  // this process (host name and pid), so concurrent writers never share it.
+  char host[256] = {};
+  gethostname(host,sizeof(host)-1);
+  const auto tmp_file = cache_file + ".tmp." + std::string(host) + "." + std::to_string(getpid());
+  {
+    std::ofstream out(tmp_file, std::ios::binary);
+    if (not out.good()) {
+      // Not being able to populate the cache is not an error
+      return;
+    }
+    const std::int32_t real_size = sizeof(Real);
+    const std::int32_t nvars = names.size();
+    out.write(cache_magic,8);
+    out.write(reinterpret_cast<const char*>(&cache_version),sizeof(cache_version));
+    out.write(reinterpret_cast<const char*>(&real_size),sizeof(real_size));
+    out.write(reinterpret_cast<const char*>(&nvars),sizeof(nvars));
+    for (const auto& name : names) {
+      const auto& v = host_views.at(name);
+      const std::int32_t len = name.size();
+      const std::int64_t size = v.size();
+      out.write(reinterpret_cast<const char*>(&len),sizeof(len));
+      out.write(name.data(),len);
+      out.write(reinterpret_cast<const char*>(&size),sizeof(size));
+      out.write(reinterpret_cast<const char*>(v.data()),sizeof(Real)*size);
+    }
+  }
+  std::rename(tmp_file.c_str(),cache_file.c_str());
+}
+
+// Read a whole netcdf variable as Real, whatever its type in the file
+int nc_get_var_real (const int nc_id, const int var_id, double* data) {
+  return nc_get_var_double(nc_id, var_id, data);
+}
+int nc_get_var_real (const int nc_id, const int var_id, float* data) {
+  return nc_get_var_float(nc_id, var_id, data);
+}
+
+// ON HOST (MPI root rank only), reads the whole variables from the table into
+// the host views. The tables are not spatial data, so there is no need to go
+// through scorpio (which would make every rank open the file).
+void read_table_on_root (const std::string& filename,
+                         const strvec_t& names,
+                         const std::map<std::string,view_1d_host>& host_views,
+                         const std::map<std::string,FieldLayout>& layouts)
+{
+  int nc_id;
+  int result = nc_open(filename.c_str(), NC_NOWRITE, &nc_id);
+  EKAT_REQUIRE_MSG (result==NC_NOERR,
+      "Error! Could not open aerosol optics table.\n"
+      "  - file name: " + filename + "\n"
+      "  - netcdf error: " + nc_strerror(result) + "\n");
+
+  for (const auto& name : names) {
+    int var_id, ndims;
+    result = nc_inq_varid(nc_id, name.c_str(), &var_id);
+    EKAT_REQUIRE_MSG (result==NC_NOERR,
+        "Error! Could not find variable in aerosol optics table.\n"
+        "  - file name: " + filename + "\n"
+        "  - var name : " + name + "\n");
+    result = nc_inq_varndims(nc_id, var_id, &ndims);
+    EKAT_REQUIRE_MSG (result==NC_NOERR,
+        "Error! Could not fetch the rank of a variable in aerosol optics table.\n"
+        "  - file name: " + filename + "\n"
+        "  - var name : " + name + "\n");
+    std::vector<int> dim_ids(ndims);
+    nc_inq_vardimid(nc_id, var_id, dim_ids.data());
+    std::size_t size = 1;
+    for (const auto id : dim_ids) {
+      std::size_t len;
+      nc_inq_dimlen(nc_id, id, &len);
+      size *= len;
+    }
+
+    // The layouts list the dims in the same order as the file, so the data
+    // can be read straight into the 1d host views
+    const auto& v = host_views.at(name);
+    EKAT_REQUIRE_MSG (size==static_cast<std::size_t>(layouts.at(name).size()) &&
+                      size==static_cast<std::size_t>(v.size()),
+        "Error! Variable size in aerosol optics table does not match its layout.\n"
+        "  - file name: " + filename + "\n"
+        "  - var name : " + name + "\n"
+        "  - file size: " + std::to_string(size) + "\n"
+        "  - layout   : " + layouts.at(name).to_string() + "\n");
+
+    result = nc_get_var_real(nc_id, var_id, v.data());
+    EKAT_REQUIRE_MSG (result==NC_NOERR,
+        "Error! Could not read variable from aerosol optics table.\n"
+        "  - file name: " + filename + "\n"
+        "  - var name : " + name + "\n"
+        "  - netcdf error: " + nc_strerror(result) + "\n");
+  }
+  nc_close(nc_id);
+}
+
+std::map<std::string,std::weak_ptr<AerosolOpticsDeviceData>>& optics_registry () {
+  static std::map<std::string,std::weak_ptr<AerosolOpticsDeviceData>> registry;
+  return registry;
+}
+
+} // anonymous namespace
+
+std::uint64_t table_signature (const std::string& filename, const ekat::Comm& comm)
+{
+  std::uint64_t h = fnv_offset;
+  if (comm.am_i_root()) {
+    struct stat st;
+    EKAT_REQUIRE_MSG (stat(filename.c_str(),&st)==0,
+        "Error! Could not stat aerosol optics table.\n"
+        "  - file name: " + filename + "\n");
+    const std::int64_t size  = st.st_size;
+    const std::int64_t mtime = st.st_mtime;
+    fnv1a(filename.data(),filename.size(),h);
+    fnv1a(reinterpret_cast<const char*>(&size),sizeof(size),h);
+    fnv1a(reinterpret_cast<const char*>(&mtime),sizeof(mtime),h);
+  }
+  comm.broadcast(reinterpret_cast<char*>(&h),sizeof(h),comm.root_rank());
+  return h;
+}
+
+std::string optics_cache_file (const std::string& filename,
+                               const std::vector<std::string>& names,
+                               const std::string& cache_dir,
+                               const ekat::Comm& comm)
+{
+  // The cache entry depends on the table as well as on the requested variables
+  auto h = table_signature(filename,comm);
+  for (const auto& n : names) {
+    fnv1a(n.data(),n.size(),h);
+  }
+  return cache_dir + "/mam4_optics_" + to_hex(h) + ".bin";
+}
+
+void read_optics_table (const ekat::ParameterList& params,
+                        const std::shared_ptr<const AbstractGrid>& grid,
+                        const std::map<std::string,view_1d_host>& host_views,
+                        const std::map<std::string,FieldLayout>& layouts,
+                        const std::string& cache_dir)
+{
+  const auto& comm = grid->get_comm();
+  const auto& filename = params.get<std::string>("Filename");
+  const auto& names = params.get<strvec_t>("Field Names");
+  const bool use_cache = cache_dir!="";
+
+  std::string cache_file;
+  int found = 0;
+  if (use_cache) {
+    cache_file = optics_cache_file(filename,names,cache_dir,comm);
+    if (comm.am_i_root()) {
+      found = load_from_cache(cache_file,names,host_views) ? 1 : 0;
+    }
+    comm.broadcast(&found,1,comm.root_rank());
+  }
+
+  if (found==0 && comm.am_i_root()) {
+    read_table_on_root(filename,names,host_views,layouts);
+    if (use_cache) {
+      write_to_cache(cache_file,names,host_views);
+    }
+  }
+
+  for (const auto& n : names) {
+    const auto& v = host_views.at(n);
+    comm.broadcast(v.data(),v.size(),comm.root_rank());
+  }
+}
+
+std::shared_ptr<AerosolOpticsDeviceData>
+get_shared_optics_data (const std::string& key)
+{
+  auto& registry = optics_registry();
+  auto it = registry.find(key);
+  if (it==registry.end()) {
+    return nullptr;
+  }
+  auto data = it->second.lock();
+  if (not data) {
+    // Last user is gone, so data was released. Purge the entry.
+    registry.erase(it);
+  }
+  return data;
+}
+
+void register_shared_optics_data (const std::string& key,
+                                  const std::shared_ptr<AerosolOpticsDeviceData>& data)
+{
+  EKAT_REQUIRE_MSG (data!=nullptr,
+      "Error! Cannot register a null aerosol optics data pointer.\n"
+      "  - key: " + key + "\n");
+  optics_registry()[key] = data;
+}
+
+} // namespace scream::mam_coupling
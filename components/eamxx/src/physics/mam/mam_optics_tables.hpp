@@ -0,0 +1,72 @@
+#ifndef MAM_OPTICS_TABLES_HPP
+#define MAM_OPTICS_TABLES_HPP
+
+#include "ekat/ekat_parameter_list.hpp"
+#include "share/field/field_layout.hpp"
+#include "share/grid/abstract_grid.hpp"
+
+#include <mam4xx/mam4.hpp>
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream::mam_coupling {
+
+/*
+ * Shared reading and caching of the (small, global) aerosol optics tables.
+ *
+ * The optics tables are the same on every rank, so they are read with serial
+ * netcdf calls on the root rank only, and broadcast to the other ranks (reading
+ * them with AtmosphereInput would make every rank go through scorpio for each
+ * of the ~12 files). On top of that, there are two optional layers of caching:
+ *
+ *  - a binary cache on disk: once a table has been read, the root rank dumps the
+ *    values of the requested variables in a file named after the table path, size,
+ *    and modification time. In later runs, the root rank reads that file instead
+ *    of the netcdf table. The cache is disabled if the cache directory is an empty string.
+ *  - a process-wide registry of the device-ready data (i.e., after reshaping),
+ *    keyed by the names of all the input tables. Views in the registry are only
+ *    weakly referenced, so the data lives as long as at least one of the MAM
+ *    optics instances using it is alive (and never outlives Kokkos). A second
+ *    instance using the same tables retrieves the same views, rather than reading
+ *    and allocating its own copy.
+ */
+
+using view_1d_host = typename ekat::KokkosTypes<DefaultDevice>::view_1d<Real>::HostMirror;
+
+// Hash of the path, size, and modification time of a file. Only the root rank
+// looks at the file, and the hash is broadcast to all ranks in the comm.
+std::uint64_t table_signature (const std::string& filename, const ekat::Comm& comm);
+
+// Name of the binary cache file for the given variables of the given table.
+// It depends on the table signature (see above) and on the variable names.
+std::string optics_cache_file (const std::string& filename,
+                               const std::vector<std::string>& names,
+                               const std::string& cache_dir,
+                               const ekat::Comm& comm);
+
+// Read the variables listed in params' "Field Names" from params' "Filename"
+// into the input host views. The root rank reads the table, and broadcasts the
+// values. If cache_dir is not empty, the binary cache in that folder is used
+// (and populated, if needed). All ranks in grid's comm must call this.
+void read_optics_table (const ekat::ParameterList& params,
+                        const std::shared_ptr<const AbstractGrid>& grid,
+                        const std::map<std::string,view_1d_host>& host_views,
+                        const std::map<std::string,FieldLayout>& layouts,
+                        const std::string& cache_dir);
+
+// Process-wide registry of device-ready optics data
+using AerosolOpticsDeviceData = mam4::modal_aer_opt::AerosolOpticsDeviceData;
+
+std::shared_ptr<AerosolOpticsDeviceData>
+get_shared_optics_data (const std::string& key);
+
+void register_shared_optics_data (const std::string& key,
+                                  const std::shared_ptr<AerosolOpticsDeviceData>& data);
+
+} // namespace scream::mam_coupling
+
+#endif // MAM_OPTICS_TABLES_HPP
@@ -7,6 +7,14 @@
 #include "share/property_checks/field_within_interval_check.hpp"
 
 namespace scream {
+
+namespace {
+// The python models use "NONE" to signal that a correction is disabled
+bool is_model_enabled (const std::string& path) {
+  return path!="NONE" && path!="None";
+}
+} // anonymous namespace
+
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
                            const ekat::ParameterList &params)
@@ -16,6 +24,13 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ML_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ML_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ML_correction_unit_test");
+
+  const auto backend = m_params.get<std::string>("ML_inference_backend","python");
+  EKAT_REQUIRE_MSG (backend=="python" || backend=="native",
+      "Error! Invalid value for 'ML_inference_backend'.\n"
+      "  - input value : " + backend + "\n"
+      "  - valid values: python, native\n");
+  m_use_native_inference = backend=="native";
 }
 
 // =========================================================================================
@@ -72,18 +87,34 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy  
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_use_native_inference) {
+    // Models are read once (on the root rank) and kept resident on device
+    auto load = [&](ml::NativeMLModel& model, const std::string& path) {
+      if (is_model_enabled(path)) {
+        model.load(path,m_comm);
+        model.setup(m_num_cols,m_num_levs);
+      }
+    };
+    load(m_native_model_tq,m_ML_model_path_tq);
+    load(m_native_model_uv,m_ML_model_path_uv);
+    load(m_native_model_sfc_fluxes,m_ML_model_path_sfc_fluxes);
+
+    m_cos_zenith     = decltype(m_cos_zenith)("cos_zenith",m_num_cols);
+    m_sw_flux_dn_toa = decltype(m_sw_flux_dn_toa)("sw_flux_dn_toa",m_num_cols);
+  } else {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,66 +129,17 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = timestamp();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_use_native_inference) {
+    run_native_models(dt);
+  } else {
+    run_python_models(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),       
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
-      m_num_cols, m_num_levs, num_tracers, dt, 
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;  
-  ekat::enable_fpes(fpe_mask);   
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "None") {
@@ -165,6 +147,7 @@ void MLCorrection::run_impl(const double dt) {
     using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
     using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
@@ -227,6 +210,213 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python_models(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = timestamp();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();  
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),          
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),        
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),       
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),   
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),                                                                                                   
+      m_num_cols, m_num_levs, num_tracers, dt, 
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;  
+  ekat::enable_fpes(fpe_mask);
+}
+
+// =========================================================================================
+void MLCorrection::run_native_models(const double dt) {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RangePolicy = Kokkos::RangePolicy<typename KT::ExeSpace>;
+
+  const auto ncols = m_num_cols;
+
+  // Per-column inputs that are not stored in a field
+  if (not m_ML_correction_unit_test) {
+    const auto ts = timestamp();
+    const double days_since_j2000 = ts.days_from(util::TimeStamp(2000,1,1,12,0,0));
+    const auto lat = m_lat.get_view<const Real*>();
+    const auto lon = m_lon.get_view<const Real*>();
+    const auto SW_flux_dn = get_field_in("SW_flux_dn").get_view<const Real**>();
+    const auto cos_zenith = m_cos_zenith;
+    const auto sw_toa = m_sw_flux_dn_toa;
+    Kokkos::parallel_for("MLCorrection::column_inputs",RangePolicy(0,ncols),
+                         KOKKOS_LAMBDA(const int icol) {
+      cos_zenith(icol) = ml::cos_zenith_angle(days_since_j2000,lat(icol),lon(icol));
+      sw_toa(icol) = SW_flux_dn(icol,0);
+    });
+  }
+
+  // NOTE: models are evaluated in the same order as in ml_correction.py, so that
+  //       the uv and sfc fluxes models see the state already corrected by the tq model.
+  for (auto model : {&m_native_model_tq,&m_native_model_uv,&m_native_model_sfc_fluxes}) {
+    if (not model->is_loaded()) {
+      continue;
+    }
+    fill_native_inputs(*model);
+    model->predict();
+    apply_native_outputs(*model,dt);
+  }
+}
+
+// =========================================================================================
+void MLCorrection::fill_native_inputs(const ml::NativeMLModel& model) {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RangePolicy = Kokkos::RangePolicy<typename KT::ExeSpace>;
+
+  const auto x = model.get_input_matrix();
+  const bool col_wise = model.layout()==ml::SampleLayout::ColumnWise;
+  const int ncols = m_num_cols;
+  const int nlevs = m_num_levs;
+
+  for (const auto& f : model.inputs()) {
+    const int off = f.offset;
+    if (f.name=="T_mid" || f.name=="qv" || f.name=="U" || f.name=="V") {
+      Field src;
+      if (f.name=="U" || f.name=="V") {
+        src = get_field_in("horiz_winds").get_component(f.name=="U" ? 0 : 1);
+      } else {
+        src = get_field_in(f.name);
+      }
+      const auto v = src.get_view<const Real**>();
+      Kokkos::parallel_for("MLCorrection::fill_level_input",RangePolicy(0,ncols*nlevs),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlevs;
+        const int ilev = idx % nlevs;
+        if (col_wise) {
+          x(idx,off) = v(icol,ilev);
+        } else {
+          x(icol,off+ilev) = v(icol,ilev);
+        }
+      });
+    } else {
+      ml::NativeMLModel::view_1d<const Real> v;
+      if (f.name=="cos_zenith_angle") {
+        v = m_cos_zenith;
+      } else if (f.name=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+        v = m_sw_flux_dn_toa;
+      } else if (f.name=="lat") {
+        v = m_lat.get_view<const Real*>();
+      } else if (f.name=="lon") {
+        v = m_lon.get_view<const Real*>();
+      } else if (f.name=="surface_geopotential") {
+        v = get_field_in("phis").get_view<const Real*>();
+      } else if (f.name=="surface_diffused_shortwave_albedo") {
+        v = get_field_in("sfc_alb_dif_vis").get_view<const Real*>();
+      } else {
+        EKAT_ERROR_MSG ("Error! Unsupported input for native ML model.\n"
+                        "  - input name: " + f.name + "\n");
+      }
+      Kokkos::parallel_for("MLCorrection::fill_column_input",RangePolicy(0,col_wise ? ncols*nlevs : ncols),
+                           KOKKOS_LAMBDA(const int idx) {
+        if (col_wise) {
+          x(idx,off) = v(idx / nlevs);
+        } else {
+          x(idx,off) = v(idx);
+        }
+      });
+    }
+  }
+}
+
+// =========================================================================================
+void MLCorrection::apply_native_outputs(const ml::NativeMLModel& model, const double dt) {
+  using KT = KokkosTypes<DefaultDevice>;
+  using RangePolicy = Kokkos::RangePolicy<typename KT::ExeSpace>;
+
+  const auto y = model.get_output_matrix();
+  const bool col_wise = model.layout()==ml::SampleLayout::ColumnWise;
+  const int ncols = m_num_cols;
+  const int nlevs = m_num_levs;
+
+  for (const auto& f : model.outputs()) {
+    const int off = f.offset;
+    if (f.name=="dQ1" || f.name=="dQ2" || f.name=="dQu" || f.name=="dQv" ||
+        f.name=="dQxwind" || f.name=="dQywind") {
+      // Tendencies: state += dQ*dt
+      Field tgt;
+      if (f.name=="dQ1") {
+        tgt = get_field_out("T_mid");
+      } else if (f.name=="dQ2") {
+        tgt = get_field_out("qv");
+      } else {
+        const bool is_u = f.name=="dQu" || f.name=="dQxwind";
+        tgt = get_field_out("horiz_winds").get_component(is_u ? 0 : 1);
+      }
+      const auto v = tgt.get_view<Real**>();
+      Kokkos::parallel_for("MLCorrection::apply_level_output",RangePolicy(0,ncols*nlevs),
+                           KOKKOS_LAMBDA(const int idx) {
+        const int icol = idx / nlevs;
+        const int ilev = idx % nlevs;
+        v(icol,ilev) += dt * (col_wise ? y(idx,off) : y(icol,off+ilev));
+      });
+    } else {
+      // Surface fluxes: the ML prediction overrides the current value
+      EKAT_REQUIRE_MSG (not col_wise,
+          "Error! Surface flux outputs require a Dense native ML model.\n"
+          "  - output name: " + f.name + "\n");
+      Field tgt;
+      if (f.name=="net_shortwave_sfc_flux_via_transmissivity") {
+        tgt = get_field_out("sfc_flux_sw_net");
+      } else if (f.name=="override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface") {
+        tgt = get_field_out("sfc_flux_lw_dn");
+      } else {
+        EKAT_ERROR_MSG ("Error! Unsupported output for native ML model.\n"
+                        "  - output name: " + f.name + "\n");
+      }
+      const auto v = tgt.get_view<Real*>();
+      Kokkos::parallel_for("MLCorrection::apply_column_output",RangePolicy(0,ncols),
+                           KOKKOS_LAMBDA(const int icol) {
+        v(icol) = y(icol,off);
+      });
+    }
+  }
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
@@ -6,6 +6,7 @@
 #include <pybind11/pybind11.h>
 #include <array>
 #include <string>
+#include "physics/ml_correction/ml_correction_native.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_lin_interp.hpp"
@@ -49,6 +50,14 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  // Evaluate the models through the embedded python interpreter (on host)
+  void run_python_models(const double dt);
+
+  // Evaluate the models natively, on device
+  void run_native_models(const double dt);
+  void fill_native_inputs(const ml::NativeMLModel& model);
+  void apply_native_outputs(const ml::NativeMLModel& model, const double dt);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -60,6 +69,12 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  bool m_use_native_inference;
+  ml::NativeMLModel m_native_model_tq;
+  ml::NativeMLModel m_native_model_uv;
+  ml::NativeMLModel m_native_model_sfc_fluxes;
+  ml::NativeMLModel::view_1d<Real> m_cos_zenith;
+  ml::NativeMLModel::view_1d<Real> m_sw_flux_dn_toa;
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
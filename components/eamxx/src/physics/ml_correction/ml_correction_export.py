@@ -0,0 +1,228 @@
+"""Export the ML correction models to the EAMXXMLP format of the native backend.
+
+MLCorrection with ML_inference_backend=native reads its models from flat binary
+files, whose format is documented in ml_correction_native.hpp. This script
+converts the keras-based fv3fit models used by the python backend (see
+ml_correction.py): a standard normalization of each input variable, their
+concatenation, a stack of Dense layers, the split of the last layer in the
+output variables, and a standard de-normalization of each of them.
+
+Usage:
+    python ml_correction_export.py MODEL_PATH OUT_FILE [--layout dense|column_wise] [--check]
+
+With --check, the exported network is evaluated with numpy on random inputs,
+and compared to the keras model.
+"""
+import argparse
+import struct
+
+import numpy as np
+
+MAGIC = b"EAMXXMLP"
+VERSION = 1
+LAYOUTS = {"dense": 0, "column_wise": 1}
+ACTIVATIONS = {"linear": 0, "relu": 1, "tanh": 2, "sigmoid": 3}
+
+
+class NativeModel:
+    """The content of an EAMXXMLP file.
+
+    inputs/outputs are lists of (name, size), and layers a list of
+    (W, b, activation) with W of shape (n_out, n_in).
+    """
+
+    def __init__(self, layout, inputs, outputs, in_mean, in_scale, out_mean, out_scale, layers):
+        self.layout = layout
+        self.inputs = list(inputs)
+        self.outputs = list(outputs)
+        self.in_mean = np.asarray(in_mean, dtype=np.float64)
+        self.in_scale = np.asarray(in_scale, dtype=np.float64)
+        self.out_mean = np.asarray(out_mean, dtype=np.float64)
+        self.out_scale = np.asarray(out_scale, dtype=np.float64)
+        self.layers = [
+            (np.asarray(W, dtype=np.float64), np.asarray(b, dtype=np.float64), act)
+            for W, b, act in layers
+        ]
+        self._check()
+
+    def _check(self):
+        if self.layout not in LAYOUTS:
+            raise ValueError(f"Invalid layout {self.layout}, must be one of {list(LAYOUTS)}")
+        n_in = sum(size for _, size in self.inputs)
+        n_out = sum(size for _, size in self.outputs)
+        if self.layout == "column_wise" and any(
+            size != 1 for _, size in self.inputs + self.outputs
+        ):
+            raise ValueError("The features of column_wise models must have size 1")
+        if self.in_mean.shape != (n_in,) or self.in_scale.shape != (n_in,):
+            raise ValueError(f"The input mean and scale must have size {n_in}")
+        if self.out_mean.shape != (n_out,) or self.out_scale.shape != (n_out,):
+            raise ValueError(f"The output mean and scale must have size {n_out}")
+        if len(self.layers) == 0:
+            raise ValueError("The model has no layers")
+        width = n_in
+        for i, (W, b, act) in enumerate(self.layers):
+            if W.ndim != 2 or W.shape[1] != width or b.shape != (W.shape[0],):
+                raise ValueError(f"Inconsistent sizes in layer {i}")
+            if act not in ACTIVATIONS:
+                raise ValueError(f"Unsupported activation {act} in layer {i}")
+            width = W.shape[0]
+        if width != n_out:
+            raise ValueError(f"The last layer has {width} outputs, but the outputs have size {n_out}")
+
+    def write(self, filename):
+        def pack_int(i):
+            return struct.pack("=i", i)
+
+        def pack_features(features):
+            out = pack_int(len(features))
+            for name, size in features:
+                out += pack_int(len(name)) + name.encode() + pack_int(size)
+            return out
+
+        def pack_doubles(a):
+            return np.ascontiguousarray(a, dtype="=f8").tobytes()
+
+        with open(filename, "wb") as f:
+            f.write(MAGIC)
+            f.write(pack_int(VERSION))
+            f.write(pack_int(LAYOUTS[self.layout]))
+            f.write(pack_features(self.inputs))
+            f.write(pack_features(self.outputs))
+            for a in (self.in_mean, self.in_scale, self.out_mean, self.out_scale):
+                f.write(pack_doubles(a))
+            f.write(pack_int(len(self.layers)))
+            for W, b, act in self.layers:
+                f.write(pack_int(W.shape[1]) + pack_int(W.shape[0]) + pack_int(ACTIVATIONS[act]))
+                f.write(pack_doubles(W))
+                f.write(pack_doubles(b))
+
+    def predict(self, x):
+        """Evaluate the network like NativeMLModel::predict, for x of shape (samples, n_in)"""
+        y = (x - self.in_mean) / self.in_scale
+        for W, b, act in self.layers:
+            y = y @ W.T + b
+            if act == "relu":
+                y = np.maximum(y, 0)
+            elif act == "tanh":
+                y = np.tanh(y)
+            elif act == "sigmoid":
+                y = 1 / (1 + np.exp(-y))
+        return y * self.out_scale + self.out_mean
+
+
+def _feature_size(tensor):
+    shape = tensor.shape
+    return 1 if len(shape) < 2 else int(shape[-1])
+
+
+def _norm_params(layer):
+    """mean and scale of a standard (de)normalization layer, or None"""
+    for scale_attr in ("sigma", "std", "scale"):
+        if hasattr(layer, "mean") and hasattr(layer, scale_attr):
+            mean = np.asarray(getattr(layer, "mean"), dtype=np.float64)
+            scale = np.asarray(getattr(layer, scale_attr), dtype=np.float64)
+            if mean.size > 0 and scale.size == mean.size:
+                return mean, scale
+    return None
+
+
+def _tensor_names(tensors):
+    if not isinstance(tensors, (list, tuple)):
+        tensors = [tensors]
+    return [t.name for t in tensors]
+
+
+def from_keras(keras_model, input_variables, output_variables, layout="dense"):
+    """Convert a keras dense model with per-variable normalization to a NativeModel"""
+    if len(keras_model.inputs) != len(input_variables):
+        raise ValueError("The keras model and the input variables do not match")
+    if len(keras_model.outputs) != len(output_variables):
+        raise ValueError("The keras model and the output variables do not match")
+
+    def scaling(features, tensors, find_layer):
+        mean, scale = [], []
+        for (name, size), t in zip(features, tensors):
+            layer = find_layer(t.name)
+            params = _norm_params(layer) if layer is not None else None
+            if params is None:
+                params = (np.zeros(size), np.ones(size))
+            mean.append(np.broadcast_to(params[0], (size,)))
+            scale.append(np.broadcast_to(params[1], (size,)))
+        return np.concatenate(mean), np.concatenate(scale)
+
+    def consumer_of(name):
+        for layer in keras_model.layers:
+            if _norm_params(layer) is not None and name in _tensor_names(layer.input):
+                return layer
+        return None
+
+    def producer_of(name):
+        for layer in keras_model.layers:
+            if _norm_params(layer) is not None and name in _tensor_names(layer.output):
+                return layer
+        return None
+
+    inputs = [(name, _feature_size(t)) for name, t in zip(input_variables, keras_model.inputs)]
+    outputs = [(name, _feature_size(t)) for name, t in zip(output_variables, keras_model.outputs)]
+    in_mean, in_scale = scaling(inputs, keras_model.inputs, consumer_of)
+    out_mean, out_scale = scaling(outputs, keras_model.outputs, producer_of)
+
+    layers = []
+    for layer in keras_model.layers:
+        kind = type(layer).__name__
+        if kind == "Dense":
+            weights = layer.get_weights()
+            kernel = weights[0]
+            bias = weights[1] if len(weights) > 1 else np.zeros(kernel.shape[1])
+            act = layer.activation.__name__
+            if act not in ACTIVATIONS:
+                raise ValueError(f"Unsupported activation {act} in layer {layer.name}")
+            layers.append((kernel.T, bias, act))
+        elif layer.get_weights() and _norm_params(layer) is None:
+            raise ValueError(f"Unsupported layer {layer.name} of type {kind}")
+
+    return NativeModel(layout, inputs, outputs, in_mean, in_scale, out_mean, out_scale, layers)
+
+
+def check(native, keras_model, nsamples=16, seed=0):
+    """Max relative difference between the native network and the keras model"""
+    rng = np.random.default_rng(seed)
+    x = native.in_mean + native.in_scale * rng.standard_normal((nsamples, native.in_mean.size))
+    offsets = np.cumsum([0] + [size for _, size in native.inputs])
+    keras_in = [x[:, offsets[i]:offsets[i + 1]] for i in range(len(native.inputs))]
+    keras_out = keras_model.predict(keras_in, verbose=0)
+    if not isinstance(keras_out, (list, tuple)):
+        keras_out = [keras_out]
+    expected = np.concatenate([np.reshape(y, (nsamples, -1)) for y in keras_out], axis=1)
+    actual = native.predict(x)
+    return np.max(np.abs(actual - expected)) / max(np.max(np.abs(expected)), 1e-300)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("model_path", help="path of the fv3fit model, as given to the python backend")
+    parser.add_argument("out_file", help="name of the EAMXXMLP file to write")
+    parser.add_argument("--layout", choices=list(LAYOUTS), default="dense",
+                        help="sample layout of the model (default: dense)")
+    parser.add_argument("--check", action="store_true",
+                        help="compare the exported network to the keras model")
+    args = parser.parse_args()
+
+    import fv3fit
+
+    predictor = fv3fit.load(args.model_path)
+    keras_model = getattr(predictor, "model", None)
+    if keras_model is None:
+        raise ValueError(f"{args.model_path} is not a keras-based fv3fit model")
+    native = from_keras(keras_model, predictor.input_variables, predictor.output_variables, args.layout)
+    native.write(args.out_file)
+    if args.check:
+        diff = check(native, keras_model)
+        print(f"max relative difference to the keras model: {diff:.3e}")
+        if diff > 1e-5:
+            raise SystemExit("The exported model does not match the keras model")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,336 @@
+#include "ml_correction_native.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace scream {
+namespace ml {
+
+namespace {
+
+// Small helper to parse the model file content (already in memory)
+struct BufferReader {
+  BufferReader (const std::vector<char>& buf, const std::string& fname)
+   : m_buf(buf), m_fname(fname) {}
+
+  template<typename T>
+  void read (T* dst, const int n) {
+    const size_t nbytes = sizeof(T)*n;
+    EKAT_REQUIRE_MSG (m_pos+nbytes<=m_buf.size(),
+        "Error! Unexpected end of file while reading ML model.\n"
+        "  - file name: " + m_fname + "\n");
+    std::memcpy(dst,m_buf.data()+m_pos,nbytes);
+    m_pos += nbytes;
+  }
+
+  template<typename T>
+  T read () {
+    T val;
+    read(&val,1);
+    return val;
+  }
+
+  std::string read_string () {
+    const auto len = read<std::int32_t>();
+    EKAT_REQUIRE_MSG (len>0 && len<1024,
+        "Error! Invalid string length in ML model file.\n"
+        "  - file name: " + m_fname + "\n"
+        "  - length   : " + std::to_string(len) + "\n");
+    std::string s(len,' ');
+    read(&s[0],len);
+    return s;
+  }
+
+  bool at_end () const { return m_pos==m_buf.size(); }
+
+private:
+  const std::vector<char>& m_buf;
+  const std::string&       m_fname;
+  size_t                   m_pos = 0;
+};
+
+} // anonymous namespace
+
+void NativeMLModel::
+load (const std::string& filename, const ekat::Comm& comm)
+{
+  m_filename = filename;
+
+  // Only the root rank touches the file system; everybody else gets the bytes via broadcast
+  std::vector<char> buf;
+  int nbytes = 0;
+  if (comm.am_i_root()) {
+    std::ifstream in(filename, std::ios::binary);
+    EKAT_REQUIRE_MSG (in.good(),
+        "Error! Could not open ML model file.\n"
+        "  - file name: " + filename + "\n");
+    buf.assign(std::istreambuf_iterator<char>(in),std::istreambuf_iterator<char>());
+    nbytes = buf.size();
+  }
+  comm.broadcast(&nbytes,1,comm.root_rank());
+  buf.resize(nbytes);
+  comm.broadcast(buf.data(),nbytes,comm.root_rank());
+
+  BufferReader reader(buf,filename);
+
+  char magic[8];
+  reader.read(magic,8);
+  EKAT_REQUIRE_MSG (std::strncmp(magic,"EAMXXMLP",8)==0,
+      "Error! File does not appear to be an EAMxx native ML model.\n"
+      "  - file name: " + filename + "\n");
+  const auto version = reader.read<std::int32_t>();
+  EKAT_REQUIRE_MSG (version==1,
+      "Error! Unsupported ML model file version.\n"
+      "  - file name: " + filename + "\n"
+      "  - version  : " + std::to_string(version) + "\n");
+  const auto layout = reader.read<std::int32_t>();
+  EKAT_REQUIRE_MSG (layout==0 || layout==1,
+      "Error! Invalid sample layout in ML model file.\n"
+      "  - file name: " + filename + "\n"
+      "  - layout   : " + std::to_string(layout) + "\n");
+  m_layout = static_cast<SampleLayout>(layout);
+
+  auto read_features = [&](std::vector<Feature>& features) {
+    features.resize(reader.read<std::int32_t>());
+    int offset = 0;
+    for (auto& f : features) {
+      f.name   = reader.read_string();
+      f.size   = reader.read<std::int32_t>();
+      f.offset = offset;
+      EKAT_REQUIRE_MSG (f.size>0,
+          "Error! Invalid feature size in ML model file.\n"
+          "  - file name: " + filename + "\n"
+          "  - feature  : " + f.name + "\n");
+      EKAT_REQUIRE_MSG (m_layout==SampleLayout::Dense || f.size==1,
+          "Error! Features of ColumnWise ML models must have size 1.\n"
+          "  - file name: " + filename + "\n"
+          "  - feature  : " + f.name + "\n");
+      offset += f.size;
+    }
+    return offset;
+  };
+  m_num_in  = read_features(m_inputs);
+  m_num_out = read_features(m_outputs);
+
+  auto read_to_dev = [&](view_1d<Real>& v, const std::string& name, const int n) {
+    std::vector<double> tmp(n);
+    reader.read(tmp.data(),n);
+    v = view_1d<Real>(name,n);
+    auto v_h = Kokkos::create_mirror_view(v);
+    for (int i=0; i<n; ++i) {
+      v_h(i) = tmp[i];
+    }
+    Kokkos::deep_copy(v,v_h);
+  };
+  read_to_dev(m_in_mean,  "in_mean",  m_num_in);
+  read_to_dev(m_in_scale, "in_scale", m_num_in);
+  read_to_dev(m_out_mean, "out_mean", m_num_out);
+  read_to_dev(m_out_scale,"out_scale",m_num_out);
+
+  m_layers.resize(reader.read<std::int32_t>());
+  EKAT_REQUIRE_MSG (m_layers.size()>0,
+      "Error! ML model file contains no layers.\n"
+      "  - file name: " + filename + "\n");
+  m_max_width = m_num_in;
+  int prev_out = m_num_in;
+  for (size_t i=0; i<m_layers.size(); ++i) {
+    auto& l = m_layers[i];
+    l.n_in  = reader.read<std::int32_t>();
+    l.n_out = reader.read<std::int32_t>();
+    const auto act = reader.read<std::int32_t>();
+    EKAT_REQUIRE_MSG (act>=0 && act<=3,
+        "Error! Invalid activation in ML model file.\n"
+        "  - file name : " + filename + "\n"
+        "  - layer     : " + std::to_string(i) + "\n"
+        "  - activation: " + std::to_string(act) + "\n");
+    l.act = static_cast<Activation>(act);
+    EKAT_REQUIRE_MSG (l.n_in==prev_out,
+        "Error! Inconsistent layer sizes in ML model file.\n"
+        "  - file name      : " + filename + "\n"
+        "  - layer          : " + std::to_string(i) + "\n"
+        "  - layer n_in     : " + std::to_string(l.n_in) + "\n"
+        "  - expected n_in  : " + std::to_string(prev_out) + "\n");
+    prev_out = l.n_out;
+    m_max_width = std::max(m_max_width,l.n_out);
+
+    std::vector<double> w(l.n_in*l.n_out), b(l.n_out);
+    reader.read(w.data(),w.size());
+    reader.read(b.data(),b.size());
+    l.W = view_2d<Real>("W",l.n_out,l.n_in);
+    l.b = view_1d<Real>("b",l.n_out);
+    auto W_h = Kokkos::create_mirror_view(l.W);
+    auto b_h = Kokkos::create_mirror_view(l.b);
+    for (int j=0; j<l.n_out; ++j) {
+      b_h(j) = b[j];
+      for (int k=0; k<l.n_in; ++k) {
+        W_h(j,k) = w[j*l.n_in+k];
+      }
+    }
+    Kokkos::deep_copy(l.W,W_h);
+    Kokkos::deep_copy(l.b,b_h);
+  }
+  EKAT_REQUIRE_MSG (prev_out==m_num_out,
+      "Error! Last layer size does not match the outputs size in ML model file.\n"
+      "  - file name    : " + filename + "\n"
+      "  - last n_out   : " + std::to_string(prev_out) + "\n"
+      "  - outputs size : " + std::to_string(m_num_out) + "\n");
+  EKAT_REQUIRE_MSG (reader.at_end(),
+      "Error! Trailing bytes found in ML model file.\n"
+      "  - file name: " + filename + "\n");
+}
+
+void NativeMLModel::setup (const int ncols, const int nlevs)
+{
+  EKAT_REQUIRE_MSG (is_loaded(),
+      "Error! Cannot setup a native ML model before loading it.\n");
+
+  if (m_layout==SampleLayout::Dense) {
+    auto check = [&](const Feature& f) {
+      EKAT_REQUIRE_MSG (f.size==1 || f.size==nlevs,
+          "Error! ML model feature size is incompatible with the grid.\n"
+          "  - file name: " + m_filename + "\n"
+          "  - feature  : " + f.name + "\n"
+          "  - size     : " + std::to_string(f.size) + "\n"
+          "  - num levs : " + std::to_string(nlevs) + "\n");
+    };
+    for (const auto& f : m_inputs)  check(f);
+    for (const auto& f : m_outputs) check(f);
+    m_num_samples = ncols;
+  } else {
+    m_num_samples = ncols*nlevs;
+  }
+
+  m_x     = view_2d<Real>("ml_x",m_num_samples,m_num_in);
+  m_y     = view_2d<Real>("ml_y",m_num_samples,m_num_out);
+  m_buf_a = view_2d<Real>("ml_buf_a",m_num_samples,m_max_width);
+  m_buf_b = view_2d<Real>("ml_buf_b",m_num_samples,m_max_width);
+}
+
+bool NativeMLModel::has_input (const std::string& name) const {
+  for (const auto& f : m_inputs) {
+    if (f.name==name) return true;
+  }
+  return false;
+}
+
+bool NativeMLModel::has_output (const std::string& name) const {
+  for (const auto& f : m_outputs) {
+    if (f.name==name) return true;
+  }
+  return false;
+}
+
+auto NativeMLModel::get_input (const std::string& name) const -> const Feature&
+{
+  for (const auto& f : m_inputs) {
+    if (f.name==name) return f;
+  }
+  EKAT_ERROR_MSG ("Error! ML model has no input named '" + name + "'.\n"
+                  "  - file name: " + m_filename + "\n");
+}
+
+auto NativeMLModel::get_output (const std::string& name) const -> const Feature&
+{
+  for (const auto& f : m_outputs) {
+    if (f.name==name) return f;
+  }
+  EKAT_ERROR_MSG ("Error! ML model has no output named '" + name + "'.\n"
+                  "  - file name: " + m_filename + "\n");
+}
+
+void NativeMLModel::
+apply_layer (const Layer& layer,
+             const view_2d<const Real>& x,
+             const view_2d<Real>& y) const
+{
+  using MT  = typename KT::MemberType;
+  using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+
+  const int n_in  = layer.n_in;
+  const int n_out = layer.n_out;
+  const auto act  = layer.act;
+  const auto W = layer.W;
+  const auto b = layer.b;
+
+  // One team per sample, threads over the outputs, vector lanes reduce over the inputs.
+  const auto policy = ESU::get_default_team_policy(m_num_samples,n_out);
+  Kokkos::parallel_for("NativeMLModel::apply_layer",policy,
+                       KOKKOS_LAMBDA(const MT& team) {
+    const int s = team.league_rank();
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(team,n_out),
+                         [&](const int j) {
+      Real z = 0;
+      Kokkos::parallel_reduce(Kokkos::ThreadVectorRange(team,n_in),
+                              [&](const int k, Real& lsum) {
+        lsum += W(j,k)*x(s,k);
+      },z);
+      z += b(j);
+      switch (act) {
+        case Activation::ReLU:    z = z>0 ? z : 0;       break;
+        case Activation::Tanh:    z = tanh(z);           break;
+        case Activation::Sigmoid: z = 1/(1+exp(-z));     break;
+        default:                                         break;
+      }
+      Kokkos::single(Kokkos::PerThread(team),[&]{
+        y(s,j) = z;
+      });
+    });
+  });
+}
+
+void NativeMLModel::predict () const
+{
+  using RangePolicy = Kokkos::RangePolicy<typename KT::ExeSpace>;
+
+  EKAT_REQUIRE_MSG (m_num_samples>0,
+      "Error! Native ML model was not setup.\n"
+      "  - file name: " + m_filename + "\n");
+
+  const int ns = m_num_samples;
+
+  // Normalize the inputs
+  {
+    const auto x = m_x;
+    const auto buf = m_buf_a;
+    const auto mean = m_in_mean;
+    const auto scale = m_in_scale;
+    const int n_in = m_num_in;
+    Kokkos::parallel_for("NativeMLModel::normalize",RangePolicy(0,ns*n_in),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int s = idx / n_in;
+      const int k = idx % n_in;
+      buf(s,k) = (x(s,k)-mean(k))/scale(k);
+    });
+  }
+
+  // Run the layers, ping-ponging between the two buffers
+  auto in  = m_buf_a;
+  auto out = m_buf_b;
+  for (const auto& l : m_layers) {
+    apply_layer(l,in,out);
+    std::swap(in,out);
+  }
+
+  // De-normalize the outputs
+  {
+    const auto y = m_y;
+    const auto buf = in;
+    const auto mean = m_out_mean;
+    const auto scale = m_out_scale;
+    const int n_out = m_num_out;
+    Kokkos::parallel_for("NativeMLModel::denormalize",RangePolicy(0,ns*n_out),
+                         KOKKOS_LAMBDA(const int idx) {
+      const int s = idx / n_out;
+      const int j = idx % n_out;
+      y(s,j) = buf(s,j)*scale(j) + mean(j);
+    });
+  }
+}
+
+} // namespace ml
+} // namespace scream
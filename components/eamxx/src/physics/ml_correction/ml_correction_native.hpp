@@ -0,0 +1,178 @@
+#ifndef SCREAM_ML_CORRECTION_NATIVE_HPP
+#define SCREAM_ML_CORRECTION_NATIVE_HPP
+
+#include "share/scream_types.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+namespace ml {
+
+/*
+ * A feed-forward neural network evaluated in-process with Kokkos.
+ *
+ * This is the native counterpart of the python models used by MLCorrection.
+ * The network is a stack of dense layers, and it is evaluated for all the
+ * samples at once: each layer is a batched GEMM (samples x n_in) * (n_in x n_out),
+ * running on the device. Two sample layouts are supported:
+ *  - Dense: one sample per column; per-level inputs/outputs contribute nlev
+ *           entries to the feature vector, per-column ones contribute 1 entry.
+ *  - ColumnWise: one sample per (column,level); every input/output contributes
+ *           exactly 1 entry, with per-column inputs broadcast to all levels.
+ *
+ * The model file is a flat binary file (native endianness) with the following content:
+ *
+ *   char[8]  "EAMXXMLP"
+ *   int32    version (must be 1)
+ *   int32    layout (0=Dense, 1=ColumnWise)
+ *   int32    num_inputs
+ *     for each input : int32 name_len, char[name_len] name, int32 size
+ *   int32    num_outputs
+ *     for each output: int32 name_len, char[name_len] name, int32 size
+ *   double[n_in]   input mean,  double[n_in]  input scale
+ *   double[n_out]  output mean, double[n_out] output scale
+ *   int32    num_layers
+ *     for each layer : int32 n_in, int32 n_out, int32 activation,
+ *                      double[n_out*n_in] weights (row-major), double[n_out] bias
+ *
+ * Here, n_in/n_out are the sums of the input/output sizes. A feature size is either
+ * 1 (a per-column quantity) or the number of levels (a per-level quantity), and must
+ * always be 1 for ColumnWise models. Inputs are normalized as (x-mean)/scale before
+ * the first layer, while outputs are de-normalized as y*scale+mean after the last one.
+ *
+ * ml_correction_export.py writes this file from the keras-based models of the python backend.
+ */
+
+enum class Activation : int {
+  Identity = 0,
+  ReLU     = 1,
+  Tanh     = 2,
+  Sigmoid  = 3
+};
+
+enum class SampleLayout : int {
+  Dense      = 0,
+  ColumnWise = 1
+};
+
+class NativeMLModel {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  struct Feature {
+    std::string name;
+    int         size;
+    int         offset;   // Offset of this feature in the input/output vector
+  };
+
+  NativeMLModel () = default;
+
+  // Read the model on the root rank, and broadcast it to all other ranks
+  void load (const std::string& filename, const ekat::Comm& comm);
+
+  // Allocate the activation buffers for a given number of columns/levels
+  void setup (const int ncols, const int nlevs);
+
+  bool is_loaded () const { return m_layers.size()>0; }
+
+  SampleLayout layout () const { return m_layout; }
+  int num_samples () const { return m_num_samples; }
+
+  const std::vector<Feature>& inputs  () const { return m_inputs;  }
+  const std::vector<Feature>& outputs () const { return m_outputs; }
+
+  bool has_input  (const std::string& name) const;
+  bool has_output (const std::string& name) const;
+  const Feature& get_input  (const std::string& name) const;
+  const Feature& get_output (const std::string& name) const;
+
+  // The (num_samples, n_in) matrix that callers fill before calling predict.
+  const view_2d<Real>& get_input_matrix () const { return m_x; }
+
+  // The (num_samples, n_out) matrix that holds the (de-normalized) result of predict.
+  const view_2d<const Real> get_output_matrix () const { return m_y; }
+
+  // Normalize inputs, run all dense layers, and de-normalize the outputs
+  void predict () const;
+
+protected:
+
+  struct Layer {
+    int n_in;
+    int n_out;
+    Activation act;
+    view_2d<Real> W;  // (n_out,n_in)
+    view_1d<Real> b;  // (n_out)
+  };
+
+  // Apply y = act(W*x+b) to all samples
+  void apply_layer (const Layer& layer,
+                    const view_2d<const Real>& x,
+                    const view_2d<Real>& y) const;
+
+  std::string           m_filename;
+  SampleLayout          m_layout = SampleLayout::Dense;
+  std::vector<Feature>  m_inputs;
+  std::vector<Feature>  m_outputs;
+  int                   m_num_in  = 0;
+  int                   m_num_out = 0;
+  int                   m_max_width = 0;
+
+  view_1d<Real>   m_in_mean;
+  view_1d<Real>   m_in_scale;
+  view_1d<Real>   m_out_mean;
+  view_1d<Real>   m_out_scale;
+
+  std::vector<Layer>    m_layers;
+
+  // Activation buffers. Layers ping-pong between m_buf_a and m_buf_b
+  int             m_num_samples = 0;
+  view_2d<Real>   m_x;
+  view_2d<Real>   m_y;
+  view_2d<Real>   m_buf_a;
+  view_2d<Real>   m_buf_b;
+};
+
+// Cosine of the solar zenith angle, given the number of days since
+// J2000 (2000-01-01 12:00:00 UTC) and lat/lon (in degrees).
+// Follows the low-precision formulas of the Astronomical Almanac,
+// which is the same approach used by the python models.
+KOKKOS_INLINE_FUNCTION
+Real cos_zenith_angle (const double days_since_j2000, const Real lat, const Real lon)
+{
+  constexpr double pi = 3.14159265358979323846;
+  constexpr double deg2rad = pi/180;
+  const double d = days_since_j2000;
+
+  // Mean longitude and mean anomaly of the sun [deg]
+  const double L = 280.460 + 0.9856474*d;
+  const double g = (357.528 + 0.9856003*d)*deg2rad;
+
+  // Ecliptic longitude and obliquity of the ecliptic [rad]
+  const double lambda = (L + 1.915*sin(g) + 0.020*sin(2*g))*deg2rad;
+  const double eps = (23.439 - 4.0e-7*d)*deg2rad;
+
+  // Right ascension and declination
+  const double alpha = atan2(cos(eps)*sin(lambda),cos(lambda));
+  const double delta = asin(sin(eps)*sin(lambda));
+
+  // Greenwich mean sidereal time [rad], and local hour angle
+  const double gmst = (280.46061837 + 360.98564736629*d)*deg2rad;
+  const double h = gmst + lon*deg2rad - alpha;
+
+  const double phi = lat*deg2rad;
+  return sin(phi)*sin(delta) + cos(phi)*cos(delta)*cos(h);
+}
+
+} // namespace ml
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_NATIVE_HPP
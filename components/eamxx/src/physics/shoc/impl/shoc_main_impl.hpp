@@ -134,11 +134,38 @@ void Functions<S,D>::shoc_main_internal(
   const uview_1d<Spack>&       w3,
   const uview_1d<Spack>&       wqls_sec,
   const uview_1d<Spack>&       brunt,
-  const uview_1d<Spack>&       isotropy)
+  const uview_1d<Spack>&       isotropy
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+  , const bool                 use_team_scratch
+#endif
+  )
 {
 
   // Define temporary variables
   uview_1d<Spack> rho_zt, shoc_qv, shoc_tabs, dz_zt, dz_zi;
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+  // These are accessed by (almost) every routine in the nadv loop. If the column
+  // fits in team scratch, keep them there (L1/shared memory on GPU), rather than
+  // doing a round trip to global memory (where the workspace lives) at every access.
+  if (use_team_scratch) {
+    const Int nlevi_pack = ekat::npack<Spack>(nlevi);
+    uview_1d<Spack>* tmps[5] = {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi};
+    for (auto v : tmps) {
+      *v = uview_1d<Spack>(reinterpret_cast<Spack*>(
+                             team.team_scratch(0).get_shmem_aligned(nlevi_pack*sizeof(Spack),
+                                                                    alignof(Spack))),
+                           nlevi_pack);
+    }
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlevi_pack), [&] (const Int& k) {
+      rho_zt(k)    = 0;
+      shoc_qv(k)   = 0;
+      shoc_tabs(k) = 0;
+      dz_zt(k)     = 0;
+      dz_zi(k)     = 0;
+    });
+    team.team_barrier();
+  } else
+#endif
   workspace.template take_many_and_reset<5>(
     {"rho_zt", "shoc_qv", "shoc_tabs", "dz_zt", "dz_zi"},
     {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi});
@@ -163,6 +190,10 @@ void Functions<S,D>::shoc_main_internal(
   for (Int t=0; t<nadv; ++t) {
     // Check TKE to make sure values lie within acceptable
     // bounds after host model performs horizontal advection
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+    // check_tke is idempotent, and it is the last thing done in the previous iteration
+    if (t==0)
+#endif
     check_tke(team,nlev, // Input
               tke);      // Input/Output
 
@@ -176,6 +207,19 @@ void Functions<S,D>::shoc_main_internal(
     // Compute the planetary boundary layer height, which is an
     // input needed for the length scale calculation.
 
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+    // Same as compute_shoc_vapor followed by compute_shoc_temperature,
+    // but fused in a single pass over the column
+    {
+      const Scalar lcond_cp = C::LatVap/C::CP;
+      const Int nlev_pack = ekat::npack<Spack>(nlev);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev_pack), [&] (const Int& k) {
+        const auto ql = shoc_ql(k);
+        shoc_qv(k)   = qw(k) - ql;
+        shoc_tabs(k) = thetal(k)/inv_exner(k)+lcond_cp*ql;
+      });
+    }
+#else
     // Update SHOC water vapor,
     // to be used by the next two routines
     compute_shoc_vapor(team,nlev,qw,shoc_ql, // Input
@@ -185,6 +229,7 @@ void Functions<S,D>::shoc_main_internal(
     compute_shoc_temperature(team,nlev,thetal,  // Input
                              shoc_ql,inv_exner, // Input
                              shoc_tabs);        // Output
+#endif
 
     team.team_barrier();
     shoc_diag_obklen(uw_sfc,vw_sfc,     // Input
@@ -312,9 +357,22 @@ void Functions<S,D>::shoc_main_internal(
           pblh);                          // Output
 
   // Release temporary variables from the workspace
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+  if (not use_team_scratch)
+#endif
   workspace.template release_many_contiguous<5>(
     {&rho_zt, &shoc_qv, &shoc_tabs, &dz_zt, &dz_zi});
 }
+
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+template<typename S, typename D>
+size_t Functions<S,D>::shoc_main_scratch_bytes(const Int& nlevi)
+{
+  // Five arrays of nlevi_pack packs. Add some slack for alignment of each allocation.
+  const Int nlevi_pack = ekat::npack<Spack>(nlevi);
+  return 5*(nlevi_pack*sizeof(Spack) + 128);
+}
+#endif
 #else
 template<typename S, typename D>
 void Functions<S,D>::shoc_main_internal(
@@ -611,7 +669,15 @@ Int Functions<S,D>::shoc_main(
 
   // SHOC main loop
   const auto nlev_packs = ekat::npack<Spack>(nlev);
-  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+  auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(shcol, nlev_packs);
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+  // Only use team scratch if the column fits, otherwise fall back to the workspace
+  const size_t scratch_bytes = shoc_main_scratch_bytes(nlevi);
+  const bool use_team_scratch = scratch_bytes <= static_cast<size_t>(policy.scratch_size_max(0));
+  if (use_team_scratch) {
+    policy.set_scratch_size(0, Kokkos::PerTeam(scratch_bytes));
+  }
+#endif
   Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
     const Int i = team.league_rank();
 
@@ -679,7 +745,11 @@ Int Functions<S,D>::shoc_main(
                        pblh_s, shoc_ql2_s, tkh_s,                             // Output
                        shoc_mix_s, w_sec_s, thl_sec_s, qw_sec_s, qwthl_sec_s, // Diagnostic Output Variables
                        wthl_sec_s, wqw_sec_s, wtke_sec_s, uw_sec_s, vw_sec_s, // Diagnostic Output Variables
-                       w3_s, wqls_sec_s, brunt_s, isotropy_s);                // Diagnostic Output Variables
+                       w3_s, wqls_sec_s, brunt_s, isotropy_s                  // Diagnostic Output Variables
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+                       , use_team_scratch
+#endif
+                       );
 
     shoc_output.pblh(i) = pblh_s;
   });
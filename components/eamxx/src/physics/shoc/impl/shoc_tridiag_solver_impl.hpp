@@ -83,10 +83,28 @@ void Functions<S,D>::vd_shoc_solve(
   const uview_1d<Scalar>& d,
   const uview_2d<Spack>&  var)
 {
+#if defined(SCREAM_SHOC_BATCHED_TRIDIAG) && !defined(EKAT_DEFAULT_BFB)
+  vd_shoc_factor(team, du, dl, d);
+  team.team_barrier();
+  vd_shoc_solve_factored(team, du, dl, d, var);
+#else
+  vd_shoc_solve_ekat(team, du, dl, d, var);
+#endif
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_ekat(
+  const MemberType&      team,
+  const uview_1d<Scalar>& du,
+  const uview_1d<Scalar>& dl,
+  const uview_1d<Scalar>& d,
+  const uview_2d<Spack>&  var)
+{
 #ifdef EKAT_DEFAULT_BFB
   ekat::tridiag::bfb(team, dl, d, du, var);
 #else
-#ifdef EAMXX_ENABLE_GPU
+#if defined(EAMXX_ENABLE_GPU)
   ekat::tridiag::cr(team, dl, d, du, ekat::scalarize(var));
 #else
   const auto f = [&] () { ekat::tridiag::thomas(dl, d, du, var); };
@@ -95,6 +113,54 @@ void Functions<S,D>::vd_shoc_solve(
 #endif
 }
 
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_factor(
+  const MemberType&       team,
+  const uview_1d<Scalar>& du,
+  const uview_1d<Scalar>& dl,
+  const uview_1d<Scalar>& d)
+{
+  // LU factorization without pivoting (the diffusion matrix is diagonally dominant).
+  // On output, dl contains the multipliers of L, and d the inverse of the diagonal
+  // of U, so that the solve phase has no divisions. du is unchanged.
+  const Int nlev = d.extent(0);
+  const auto f = [&] () {
+    d(0) = 1/d(0);
+    for (Int k=1; k<nlev; ++k) {
+      dl(k) *= d(k-1);
+      d(k) = 1/(d(k) - dl(k)*du(k-1));
+    }
+  };
+  Kokkos::single(Kokkos::PerTeam(team), f);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::vd_shoc_solve_factored(
+  const MemberType&             team,
+  const uview_1d<const Scalar>& du,
+  const uview_1d<const Scalar>& dl,
+  const uview_1d<const Scalar>& d,
+  const uview_2d<Spack>&        var)
+{
+  // Each rhs is independent, so parallelize over them. Each thread/vector lane
+  // handles one pack of rhs's, and sweeps the column twice.
+  const Int nlev = d.extent(0);
+  const Int nrhs_pack = var.extent(1);
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nrhs_pack), [&] (const Int& j) {
+    // Forward substitution (L has unit diagonal)
+    for (Int k=1; k<nlev; ++k) {
+      var(k,j) -= dl(k)*var(k-1,j);
+    }
+    // Backward substitution
+    var(nlev-1,j) *= d(nlev-1);
+    for (Int k=nlev-2; k>=0; --k) {
+      var(k,j) = (var(k,j) - du(k)*var(k+1,j))*d(k);
+    }
+  });
+}
+
 } // namespace shoc
 } // namespace scream
 
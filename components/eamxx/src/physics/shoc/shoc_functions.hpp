@@ -905,7 +905,16 @@ struct Functions
     const uview_1d<Spack>&       w3,
     const uview_1d<Spack>&       wqls_sec,
     const uview_1d<Spack>&       brunt,
-    const uview_1d<Spack>&       isotropy);
+    const uview_1d<Spack>&       isotropy
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+    , const bool                 use_team_scratch  // Stage local column arrays in team scratch
+#endif
+    );
+
+#ifdef SCREAM_SHOC_TEAM_SCRATCH
+  // Bytes of team scratch needed by shoc_main_internal for its local column arrays
+  static size_t shoc_main_scratch_bytes(const Int& nlevi);
+#endif
 #else
   static void shoc_main_internal(
     const Int&                   shcol,        // Number of columns
@@ -1055,6 +1064,35 @@ struct Functions
     const uview_1d<Scalar>& d,
     const uview_2d<Spack>&  var);
 
+  // The ekat tridiagonal solvers, used by vd_shoc_solve unless
+  // SCREAM_SHOC_BATCHED_TRIDIAG is ON in a non-BFB build. As in vd_shoc_solve,
+  // all the rhs's (columns of var) are solved in one call.
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_ekat(
+    const MemberType&      team,
+    const uview_1d<Scalar>& du,
+    const uview_1d<Scalar>& dl,
+    const uview_1d<Scalar>& d,
+    const uview_2d<Spack>&  var);
+
+  // Batched multi-rhs version of vd_shoc_solve: factor the matrix once, then
+  // back-substitute all the rhs's (columns of var) at once, in parallel.
+  // On output, du/dl/d are overwritten by the factorization.
+  KOKKOS_FUNCTION
+  static void vd_shoc_factor(
+    const MemberType&       team,
+    const uview_1d<Scalar>& du,
+    const uview_1d<Scalar>& dl,
+    const uview_1d<Scalar>& d);
+
+  KOKKOS_FUNCTION
+  static void vd_shoc_solve_factored(
+    const MemberType&             team,
+    const uview_1d<const Scalar>& du,
+    const uview_1d<const Scalar>& dl,
+    const uview_1d<const Scalar>& d,
+    const uview_2d<Spack>&        var);
+
   KOKKOS_FUNCTION
   static void pblintd_surf_temp(const Int& nlev, const Int& nlevi, const Int& npbl,
       const uview_1d<const Spack>& z, const Scalar& ustar,
@@ -0,0 +1,142 @@
+#include "catch2/catch.hpp"
+
+#include "shoc_functions.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+namespace {
+
+/*
+ * Micro-benchmark of the tridiagonal solves done in SHOC's implicit diffusion.
+ * Compares the ekat solvers (vd_shoc_solve_ekat, which SHOC uses by default,
+ * with all rhs's in one multi-rhs call, as in shoc_update_prognostics_implicit)
+ * against the batched approach (vd_shoc_factor once per column, then
+ * vd_shoc_solve_factored for all rhs's). Both legs are called explicitly, so
+ * the comparison does not depend on SCREAM_SHOC_BATCHED_TRIDIAG.
+ * Besides timing both, it checks that they give the same answer.
+ */
+TEST_CASE("shoc_tridiag_bench", "[shoc]")
+{
+  using SHF        = scream::shoc::Functions<scream::Real, scream::DefaultDevice>;
+  using Scalar     = typename SHF::Scalar;
+  using Spack      = typename SHF::Spack;
+  using KT         = typename SHF::KT;
+  using ExeSpace   = typename KT::ExeSpace;
+  using MemberType = typename SHF::MemberType;
+  using view_2d    = typename SHF::view_2d<Scalar>;
+  using view_3d    = typename SHF::view_3d<Spack>;
+  using uview_1d   = typename SHF::uview_1d<Scalar>;
+
+  const int ncol = 256;
+  const int nlev = 128;
+  const int nrhs = 43;  // 40 tracers, plus thetal, qw, tke
+  const int nrhs_pack = ekat::npack<Spack>(nrhs);
+  const int nreps = 10;
+
+  // Random diffusion-like (diagonally dominant) matrices, and random rhs's
+  view_2d du("du",ncol,nlev), dl("dl",ncol,nlev), d("d",ncol,nlev);
+  view_2d du_w("du_w",ncol,nlev), dl_w("dl_w",ncol,nlev), d_w("d_w",ncol,nlev);
+  view_3d rhs("rhs",ncol,nlev,nrhs_pack);
+  view_3d x_batched("x_batched",ncol,nlev,nrhs_pack);
+  view_3d x_ekat("x_ekat",ncol,nlev,nrhs_pack);
+
+  auto du_h  = Kokkos::create_mirror_view(du);
+  auto dl_h  = Kokkos::create_mirror_view(dl);
+  auto d_h   = Kokkos::create_mirror_view(d);
+  auto rhs_h = Kokkos::create_mirror_view(rhs);
+  std::mt19937_64 engine(1234);
+  std::uniform_real_distribution<Scalar> pdf(0.1,1);
+  for (int i=0; i<ncol; ++i) {
+    for (int k=0; k<nlev; ++k) {
+      du_h(i,k) = k==nlev-1 ? 0 : -pdf(engine);
+      dl_h(i,k) = k==0      ? 0 : -pdf(engine);
+      d_h(i,k)  = 1 - du_h(i,k) - dl_h(i,k);
+      for (int q=0; q<nrhs; ++q) {
+        rhs_h(i,k,q/Spack::n)[q%Spack::n] = pdf(engine);
+      }
+    }
+  }
+  Kokkos::deep_copy(du,du_h);
+  Kokkos::deep_copy(dl,dl_h);
+  Kokkos::deep_copy(d,d_h);
+  Kokkos::deep_copy(rhs,rhs_h);
+
+  const auto policy = ekat::ExeSpaceUtils<ExeSpace>::get_default_team_policy(ncol, nlev);
+
+  // The solvers overwrite the matrix, so restore it before each solve
+  auto reset_matrix = KOKKOS_LAMBDA (const MemberType& team, const int i) {
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team, nlev), [&] (const int k) {
+      du_w(i,k) = du(i,k);
+      dl_w(i,k) = dl(i,k);
+      d_w(i,k)  = d(i,k);
+    });
+    team.team_barrier();
+  };
+
+  Kokkos::Timer timer;
+  double t_ekat = 0, t_batched = 0;
+  for (int r=0; r<nreps; ++r) {
+    // Multi-rhs ekat solve
+    Kokkos::deep_copy(x_ekat,rhs);
+    Kokkos::fence();
+    timer.reset();
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int i = team.league_rank();
+      const uview_1d du_s = ekat::subview(du_w,i);
+      const uview_1d dl_s = ekat::subview(dl_w,i);
+      const uview_1d d_s  = ekat::subview(d_w,i);
+      reset_matrix(team,i);
+      SHF::vd_shoc_solve_ekat(team, du_s, dl_s, d_s, ekat::subview(x_ekat,i));
+    });
+    Kokkos::fence();
+    t_ekat += timer.seconds();
+
+    // Batched solve
+    Kokkos::deep_copy(x_batched,rhs);
+    Kokkos::fence();
+    timer.reset();
+    Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const MemberType& team) {
+      const int i = team.league_rank();
+      const uview_1d du_s = ekat::subview(du_w,i);
+      const uview_1d dl_s = ekat::subview(dl_w,i);
+      const uview_1d d_s  = ekat::subview(d_w,i);
+      reset_matrix(team,i);
+      SHF::vd_shoc_factor(team, du_s, dl_s, d_s);
+      team.team_barrier();
+      SHF::vd_shoc_solve_factored(team, du_s, dl_s, d_s, ekat::subview(x_batched,i));
+    });
+    Kokkos::fence();
+    t_batched += timer.seconds();
+  }
+
+  std::cout << std::setprecision(4)
+            << "shoc tridiag solve (ncol=" << ncol << ", nlev=" << nlev << ", nrhs=" << nrhs << "):\n"
+            << "  ekat    : " << t_ekat/nreps*1e3 << " ms\n"
+            << "  batched : " << t_batched/nreps*1e3 << " ms\n";
+
+  // Both approaches must give the same answer (up to roundoff)
+  auto xe_h = Kokkos::create_mirror_view(x_ekat);
+  auto xb_h = Kokkos::create_mirror_view(x_batched);
+  Kokkos::deep_copy(xe_h,x_ekat);
+  Kokkos::deep_copy(xb_h,x_batched);
+  const Scalar tol = std::is_same<Scalar,double>::value ? 1e-12 : 1e-5;
+  for (int i=0; i<ncol; ++i) {
+    for (int k=0; k<nlev; ++k) {
+      for (int q=0; q<nrhs; ++q) {
+        const Scalar xe = xe_h(i,k,q/Spack::n)[q%Spack::n];
+        const Scalar xb = xb_h(i,k,q/Spack::n)[q%Spack::n];
+        REQUIRE (std::abs(xe-xb) <= tol*std::max(Scalar(1),std::abs(xe)));
+      }
+    }
+  }
+}
+
+} // empty namespace
@@ -18,6 +18,12 @@ SPA::SPA (const ekat::Comm& comm, const ekat::ParameterList& params)
 {
   EKAT_REQUIRE_MSG(m_params.isParameter("spa_data_file"),
       "ERROR: spa_data_file is missing from SPA parameter list.");
+
+  m_cache_monthly_data     = m_params.get<bool>("spa_cache_monthly_data",false);
+  m_vert_interp_setup_freq = m_params.get<int>("spa_vert_interp_setup_freq",1);
+  EKAT_REQUIRE_MSG(m_vert_interp_setup_freq>0,
+      "Error! Invalid value for spa_vert_interp_setup_freq (must be positive).\n"
+      "  - spa_vert_interp_setup_freq: " + std::to_string(m_vert_interp_setup_freq) + "\n");
 }
 
 // =========================================================================================
@@ -124,6 +130,16 @@ void SPA::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
     Kokkos::deep_copy(spa_hybm,spa_hybm_h);
   }
 
+  // In cached mode, each month gets its own storage, sharing the (padded) hybrid coords
+  if (m_cache_monthly_data) {
+    SPAClimatology.resize(12);
+    for (auto& data : SPAClimatology) {
+      data = SPAFunc::SPAInput(m_num_cols, m_num_src_levs+2, m_nswbands, m_nlwbands);
+      data.hyam = SPAData_start.hyam;
+      data.hybm = SPAData_start.hybm;
+    }
+  }
+
   // 4. Create reader for spa data. The reader is either an
   //    AtmosphereInput object (for reading into standard
   //    grids) or a SpaFunctions::IOPReader (for reading into
@@ -224,7 +240,15 @@ void SPA::initialize_impl (const RunType /* run_type */)
   // Note: At the first time step, the data will be moved into spa_beg,
   //       and spa_end will be reloaded from file with the new month.
   const int curr_month = timestamp().get_month()-1; // 0-based
-  SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),curr_month,*SPAHorizInterp,SPAData_end);
+  if (m_cache_monthly_data) {
+    SPAFunc::load_spa_climatology(SPADataReader,SPAIOPDataReader,timestamp(),*SPAHorizInterp,SPAClimatology);
+    SPAData_end = SPAClimatology[curr_month];
+  } else {
+    SPAFunc::update_spa_data_from_file(SPADataReader,SPAIOPDataReader,timestamp(),curr_month,*SPAHorizInterp,SPAData_end);
+  }
+
+  // Create the vertical interpolation object once, since its setup can be reused across steps
+  m_vert_interp = std::make_shared<SPAFunc::LIV>(m_num_cols,m_num_src_levs+2,m_num_levs);
 
   // 6. Set property checks for fields in this process
   using Interval = FieldWithinIntervalCheck;
@@ -246,12 +270,21 @@ void SPA::run_impl (const double dt)
   /* Update the SPATimeState to reflect the current time, note the addition of dt */
   SPATimeState.t_now = ts.frac_of_year_in_days();
   /* Update time state and if the month has changed, update the data.*/
+  if (m_cache_monthly_data) {
+    SPAFunc::update_spa_timestate(SPAClimatology,ts,SPATimeState,SPAData_start,SPAData_end);
+  } else {
     SPAFunc::update_spa_timestate(SPADataReader,SPAIOPDataReader,ts,*SPAHorizInterp,SPATimeState,SPAData_start,SPAData_end);
+  }
 
   // Call the main SPA routine to get interpolated aerosol forcings.
+  // Note: with spa_vert_interp_setup_freq>1, the interpolation indices are only
+  //       recomputed every few steps, which is not BFB with the default.
+  const bool setup_vert_interp = (m_num_steps % m_vert_interp_setup_freq)==0;
   const auto& pmid_tgt = get_field_in("p_mid").get_view<const Spack**>();
   SPAFunc::spa_main(SPATimeState, pmid_tgt, m_buffer.p_mid_src,
-                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out);
+                    SPAData_start,SPAData_end,m_buffer.spa_temp,SPAData_out,
+                    *m_vert_interp,setup_vert_interp);
+  ++m_num_steps;
 }
 
 // =========================================================================================
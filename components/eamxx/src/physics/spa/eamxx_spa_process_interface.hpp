@@ -90,6 +90,16 @@ protected:
   SPAFunc::SPAInput         SPAData_end;
   SPAFunc::SPAOutput        SPAData_out;
 
+  // If spa_cache_monthly_data=true, all 12 months are read and remapped at init,
+  // and kept resident, so that no file read/remap happens at month boundaries.
+  bool                      m_cache_monthly_data = false;
+  SPAFunc::SPAClimatology   SPAClimatology;
+
+  // Vertical interpolation object, with its setup redone every m_vert_interp_setup_freq steps
+  std::shared_ptr<SPAFunc::LIV> m_vert_interp;
+  int                       m_vert_interp_setup_freq = 1;
+  int                       m_num_steps = 0;
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 }; // class SPA
 
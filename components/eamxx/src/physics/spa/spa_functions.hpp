@@ -9,6 +9,7 @@
 #include "share/scream_types.hpp"
 
 #include <ekat/ekat_pack_utils.hpp>
+#include <ekat/util/ekat_lin_interp.hpp>
 
 namespace scream {
 namespace spa {
@@ -25,6 +26,8 @@ struct SPAFunctions
 
   using Spack = ekat::Pack<Scalar,SCREAM_PACK_SIZE>;
 
+  using LIV = ekat::LinInterp<Real,Spack::n>;
+
   using KT = KokkosTypes<Device>;
   using MemberType = typename KT::MemberType;
 
@@ -158,6 +161,10 @@ struct SPAFunctions
   // help to see a SPAOutput along a SPAInput in functions signatures
   using SPAOutput = SPAData;
 
+  // All 12 months of SPA data, already remapped on the model grid.
+  // Entry m holds month m (0-based).
+  using SPAClimatology = std::vector<SPAInput>;
+
   /* ------------------------------------------------------------------------------------------- */
   // SPA routines
 
@@ -188,6 +195,20 @@ struct SPAFunctions
     const SPAInput&   data_tmp,         // Temporary
     const SPAOutput&  data_out);
 
+  // Same as above, but using a persistent vertical interpolation object.
+  // If setup_vert_interp=false, the interpolation indices computed at the
+  // last setup are reused (the interpolation itself uses the current p_src/p_tgt).
+  static void spa_main(
+    const SPATimeState& time_state,
+    const view_2d<const Spack>& p_tgt,
+    const view_2d<      Spack>& p_src,  // Temporary
+    const SPAInput&   data_beg,
+    const SPAInput&   data_end,
+    const SPAInput&   data_tmp,         // Temporary
+    const SPAOutput&  data_out,
+    const LIV&        vert_interp,
+    const bool        setup_vert_interp);
+
   static void update_spa_data_from_file(
     std::shared_ptr<AtmosphereInput>& scorpio_reader,
     std::shared_ptr<IOPReader>&       iop_reader,
@@ -205,6 +226,25 @@ struct SPAFunctions
     SPAInput&                         spa_beg,
     SPAInput&                         spa_end);
 
+  // Read and horizontally remap all 12 months of data. Each entry of
+  // climatology must already be inited (with its hybrid coordinates set).
+  static void load_spa_climatology(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    AbstractRemapper&                 spa_horiz_interp,
+    SPAClimatology&                   climatology);
+
+  // Same as above, but the new month is taken from the (resident) climatology,
+  // with no file read nor remap. spa_beg/spa_end become shallow copies of the
+  // climatology entries, so they must not be written to.
+  static void update_spa_timestate(
+    const SPAClimatology&             climatology,
+    const util::TimeStamp&            ts,
+    SPATimeState&                     time_state,
+    SPAInput&                         spa_beg,
+    SPAInput&                         spa_end);
+
   // The following three are called during spa_main
   static void perform_time_interpolation (
       const SPATimeState& time_state,
@@ -224,6 +264,14 @@ struct SPAFunctions
       const SPAData&  data_in,
       const SPAData&  data_out);
 
+  static void perform_vertical_interpolation (
+      const view_2d<const Spack>& p_src,
+      const view_2d<const Spack>& p_tgt,
+      const SPAData&  data_in,
+      const SPAData&  data_out,
+      const LIV&      vert_interp,
+      const bool      do_setup);
+
   // Return the subcolumn of the proper variable, where ivar
   // is a condensed idx for var and possibly band. In particular:
   //  - ivar=0: return CCN
@@ -203,6 +203,23 @@ void SPAFunctions<S,D>
   const SPAInput&   data_end,
   const SPAInput&   data_tmp,
   const SPAOutput&  data_out)
+{
+  LIV vert_interp(data_out.ncols,data_tmp.data.nlevs,data_out.nlevs);
+  spa_main(time_state,p_tgt,p_src,data_beg,data_end,data_tmp,data_out,vert_interp,true);
+}
+
+template <typename S, typename D>
+void SPAFunctions<S,D>
+::spa_main(
+  const SPATimeState& time_state,
+  const view_2d<const Spack>& p_tgt,
+  const view_2d<      Spack>& p_src,
+  const SPAInput&   data_beg,
+  const SPAInput&   data_end,
+  const SPAInput&   data_tmp,
+  const SPAOutput&  data_out,
+  const LIV&        vert_interp,
+  const bool        setup_vert_interp)
 {
   // Beg/End/Tmp month must have all sizes matching
   EKAT_REQUIRE_MSG (
@@ -239,7 +256,7 @@ void SPAFunctions<S,D>
   compute_source_pressure_levels(data_tmp.PS, p_src, data_beg.hyam, data_beg.hybm);
 
   // Step 3. Perform vertical interpolation
-  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out);
+  perform_vertical_interpolation(p_src, p_tgt, data_tmp.data, data_out, vert_interp, setup_vert_interp);
 }
 
 /*-----------------------------------------------------------------*/
@@ -347,10 +364,23 @@ perform_vertical_interpolation(
   const view_2d<const Spack>& p_tgt,
   const SPAData& input,
   const SPAData& output)
+{
+  LIV vert_interp(input.ncols,input.nlevs,output.nlevs);
+  perform_vertical_interpolation(p_src,p_tgt,input,output,vert_interp,true);
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>::
+perform_vertical_interpolation(
+  const view_2d<const Spack>& p_src,
+  const view_2d<const Spack>& p_tgt,
+  const SPAData& input,
+  const SPAData& output,
+  const LIV&     vert_interp,
+  const bool     do_setup)
 {
   using ExeSpace = typename KT::ExeSpace;
   using ESU = ekat::ExeSpaceUtils<ExeSpace>;
-  using LIV = ekat::LinInterp<Real,Spack::n>;
 
   // Makes no sense to have different number of bands
   EKAT_REQUIRE(input.nswbands==output.nswbands);
@@ -363,24 +393,24 @@ perform_vertical_interpolation(
   const int nlevs_src = input.nlevs;
   const int nlevs_tgt = output.nlevs;
 
-  LIV vert_interp(ncols,nlevs_src,nlevs_tgt);
-
   // We can ||ize over columns as well as over variables and bands
   const int num_vars = 1+input.nswbands*3+input.nlwbands;
   const int num_vert_packs = ekat::PackInfo<Spack::n>::num_packs(nlevs_tgt);
-  const auto policy_setup = ESU::get_default_team_policy(ncols, num_vert_packs);
 
   // Setup the linear interpolation object
-  Kokkos::parallel_for("spa_vert_interp_setup_loop", policy_setup,
-    KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
+  if (do_setup) {
+    const auto policy_setup = ESU::get_default_team_policy(ncols, num_vert_packs);
+    Kokkos::parallel_for("spa_vert_interp_setup_loop", policy_setup,
+      KOKKOS_LAMBDA(typename LIV::MemberType const& team) {
 
-    const int icol = team.league_rank();
+      const int icol = team.league_rank();
 
-    // Setup
-    vert_interp.setup(team, ekat::subview(p_src,icol),
-                            ekat::subview(p_tgt,icol));
-  });
-  Kokkos::fence();
+      // Setup
+      vert_interp.setup(team, ekat::subview(p_src,icol),
+                              ekat::subview(p_tgt,icol));
+    });
+    Kokkos::fence();
+  }
 
   // Now use the interpolation object in || over all variables.
   const int outer_iters = ncols*num_vars;
@@ -585,6 +615,48 @@ void SPAFunctions<S,D>
 
 } // END updata_spa_timestate
 
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::load_spa_climatology(
+    std::shared_ptr<AtmosphereInput>& scorpio_reader,
+    std::shared_ptr<IOPReader>&       iop_reader,
+    const util::TimeStamp&            ts,
+    AbstractRemapper&                 spa_horiz_interp,
+    SPAClimatology&                   climatology)
+{
+  EKAT_REQUIRE_MSG (climatology.size()==12,
+      "Error! SPA climatology must store exactly 12 months.\n"
+      "  - num months: " + std::to_string(climatology.size()) + "\n");
+
+  start_timer("EAMxx::SPA::load_spa_climatology");
+  for (int month=0; month<12; ++month) {
+    update_spa_data_from_file(scorpio_reader,iop_reader,ts,month,spa_horiz_interp,climatology[month]);
+  }
+  stop_timer("EAMxx::SPA::load_spa_climatology");
+}
+
+template<typename S, typename D>
+void SPAFunctions<S,D>
+::update_spa_timestate(
+    const SPAClimatology&             climatology,
+    const util::TimeStamp&            ts,
+    SPATimeState&                     time_state,
+    SPAInput&                         spa_beg,
+    SPAInput&                         spa_end)
+{
+  // Same as the version reading from file, except that the data for
+  // the new month is already resident, so we only need to point to it.
+  const auto month = ts.get_month() - 1; // Make it 0-based
+  if (month != time_state.current_month) {
+    time_state.current_month = month;
+    time_state.t_beg_month = util::TimeStamp({ts.get_year(),month+1,1}, {0,0,0}).frac_of_year_in_days();
+    time_state.days_this_month = util::days_in_month(ts.get_year(),month+1);
+
+    spa_beg = climatology[month];
+    spa_end = climatology[(month + 1) % 12];
+  }
+}
+
 template<typename S,typename D>
 KOKKOS_INLINE_FUNCTION
 auto SPAFunctions<S,D>::
@@ -346,7 +346,50 @@ TEST_CASE("spa_main")
       check_bounds (sv(data_beg_h.aer_tau_lw,i,n),sv(data_out_h.aer_tau_lw,i,n));
     }
   }
-  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n\n";
+  std::cout << "  -> vert interp, p_tgt!=p_src and extrapolation needed ... OK!\n";
+
+  // 3. A persistent interpolation object must give the same answer, whether
+  //    its setup is redone or reused (p_src/p_tgt did not change)
+  SPAFunc::LIV vert_interp(ncols,nlevs+2,nlevs);
+  SPADataHost data_persistent_h(spa_out);
+  for (bool do_setup : {true, false}) {
+    SPAFunc::perform_vertical_interpolation(p_src,p_tgt,spa_beg.data,spa_out,vert_interp,do_setup);
+    data_persistent_h.copy_from_dev(spa_out);
+    for (int i=0; i<ncols; ++i) {
+      for (int k=0; k<nlevs; ++k) {
+        REQUIRE (data_persistent_h.ccn3(i,k) == data_out_h.ccn3(i,k));
+        for (int n=0; n<nswbands; ++n) {
+          REQUIRE (data_persistent_h.aer_g_sw(i,n,k) == data_out_h.aer_g_sw(i,n,k));
+          REQUIRE (data_persistent_h.aer_ssa_sw(i,n,k) == data_out_h.aer_ssa_sw(i,n,k));
+          REQUIRE (data_persistent_h.aer_tau_sw(i,n,k) == data_out_h.aer_tau_sw(i,n,k));
+        }
+        for (int n=0; n<nlwbands; ++n) {
+          REQUIRE (data_persistent_h.aer_tau_lw(i,n,k) == data_out_h.aer_tau_lw(i,n,k));
+        }
+      }
+    }
+  }
+  std::cout << "  -> vert interp, persistent interpolation object ......... OK!\n";
+
+  // 4. With a resident climatology, beg/end must point to the current/next month
+  SPAFunc::SPAClimatology climatology(12);
+  for (int m=0; m<12; ++m) {
+    climatology[m] = SPAFunc::SPAInput(ncols, nlevs+2, nswbands, nlwbands);
+    Kokkos::deep_copy(climatology[m].PS,Real(m));
+  }
+  SPAFunc::SPATimeState clim_time_state;
+  SPAFunc::SPAInput clim_beg, clim_end;
+  auto ps_h = Kokkos::create_mirror_view(spa_beg.PS);
+  for (int month : {3, 12}) {
+    util::TimeStamp ts(1900,month,15,0,0,0);
+    SPAFunc::update_spa_timestate(climatology,ts,clim_time_state,clim_beg,clim_end);
+    REQUIRE (clim_time_state.current_month==month-1);
+    Kokkos::deep_copy(ps_h,clim_beg.PS);
+    REQUIRE (ps_h(0)==month-1);
+    Kokkos::deep_copy(ps_h,clim_end.PS);
+    REQUIRE (ps_h(0)==month%12);
+  }
+  std::cout << "  -> monthly update from resident climatology ............. OK!\n\n";
 }
 
 // Compute min/max of input over [start,end) indices
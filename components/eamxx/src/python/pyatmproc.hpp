@@ -13,6 +13,8 @@
 
 #include <ekat/io/ekat_yaml.hpp>
 
+#include <algorithm>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -25,11 +27,21 @@ struct PyAtmProc {
   util::TimeStamp t0;
   util::TimeStamp time;
   ATMBufferManager buffer;
+  int pack_size;
 
   std::shared_ptr<OutputManager> output_mgr;
 
   PyAtmProc (const PyParamList& params, const PyGrid& phys_grid_in)
+   : PyAtmProc(params,phys_grid_in,1)
+  {}
+
+  // The fields are allocated so that they can be viewed with packs of size
+  // pack_size, on top of the pack size requested by the atm proc. This only
+  // changes the padding of the fields: the pack size used in the atm proc
+  // kernels is set at compile time (SCREAM_PACK_SIZE).
+  PyAtmProc (const PyParamList& params, const PyGrid& phys_grid_in, const int pack_size_in)
    : phys_grid(phys_grid_in)
+   , pack_size(pack_size_in)
   {
     // Get the comm
     const auto& comm = phys_grid.grid->get_comm();
@@ -47,6 +59,7 @@ struct PyAtmProc {
 
     // Create the fields
     ap->set_grids(gm);
+    ap->set_state_capture_grids(gm);
     create_fields();
   }
 
@@ -57,12 +70,12 @@ struct PyAtmProc {
     // Create  fields that are input/output to the atm proc
     for (const auto& req : ap->get_required_field_requests()) {
       const auto& fn = req.fid.name();
-      auto it_bool = fields.emplace(fn,PyField(req.fid,req.pack_size));
+      auto it_bool = fields.emplace(fn,PyField(req.fid,std::max(req.pack_size,pack_size)));
       ap->set_required_field(it_bool.first->second.f.get_const());
     }
     for (const auto& req : ap->get_computed_field_requests()) {
       const auto& fn = req.fid.name();
-      auto it_bool = fields.emplace(fn,PyField(req.fid,req.pack_size));
+      auto it_bool = fields.emplace(fn,PyField(req.fid,std::max(req.pack_size,pack_size)));
       ap->set_computed_field(it_bool.first->second.f);
     }
   }
@@ -82,6 +95,18 @@ struct PyAtmProc {
     return it->second;
   }
 
+  std::string name () const {
+    return ap->name();
+  }
+
+  std::vector<std::string> get_field_names () const {
+    std::vector<std::string> names;
+    for (const auto& it : fields) {
+      names.push_back(it.first);
+    }
+    return names;
+  }
+
   // If running as part of a process group, call the second function, after
   // manually creating/setting the fields
   void initialize (const std::string& t0_str) {
@@ -162,7 +187,10 @@ inline void pybind_pyatmproc(pybind11::module& m)
 {
   pybind11::class_<PyAtmProc>(m,"AtmProc")
     .def(pybind11::init<const PyParamList&, const PyGrid&>())
+    .def(pybind11::init<const PyParamList&, const PyGrid&, int>())
+    .def("name",&PyAtmProc::name)
     .def("get_field",&PyAtmProc::get_field)
+    .def("get_field_names",&PyAtmProc::get_field_names)
     .def("initialize",&PyAtmProc::initialize)
     .def("setup_output",&PyAtmProc::setup_output)
     .def("run",&PyAtmProc::run)
@@ -0,0 +1,76 @@
+#ifndef PYDLPACK_HPP
+#define PYDLPACK_HPP
+
+#include <Kokkos_Core.hpp>
+
+#include <cstdint>
+#include <type_traits>
+
+namespace scream {
+namespace dlpack {
+
+// The subset of the DLPack ABI (https://dmlc.github.io/dlpack, v0.8) needed
+// to export field views to python. These structs are passed as-is to other
+// libraries (CuPy, PyTorch, ...), so they must NOT be changed.
+
+enum DLDeviceType : std::int32_t {
+  kDLCPU    = 1,
+  kDLCUDA   = 2,
+  kDLROCM   = 10,
+  kDLOneAPI = 14
+};
+
+enum DLDataTypeCode : std::uint8_t {
+  kDLInt   = 0,
+  kDLFloat = 2
+};
+
+struct DLDevice {
+  DLDeviceType device_type;
+  std::int32_t device_id;
+};
+
+struct DLDataType {
+  std::uint8_t  code;
+  std::uint8_t  bits;
+  std::uint16_t lanes;
+};
+
+struct DLTensor {
+  void*         data;
+  DLDevice      device;
+  std::int32_t  ndim;
+  DLDataType    dtype;
+  std::int64_t* shape;
+  std::int64_t* strides;
+  std::uint64_t byte_offset;
+};
+
+struct DLManagedTensor {
+  DLTensor dl_tensor;
+  void*    manager_ctx;
+  void (*deleter)(DLManagedTensor* self);
+};
+
+// The device where the views of fields on the Device memory space live
+inline DLDevice get_device () {
+#if defined(KOKKOS_ENABLE_CUDA)
+  if (std::is_same<Kokkos::DefaultExecutionSpace,Kokkos::Cuda>::value) {
+    return DLDevice{kDLCUDA,Kokkos::Cuda().cuda_device()};
+  }
+#elif defined(KOKKOS_ENABLE_HIP)
+  if (std::is_same<Kokkos::DefaultExecutionSpace,Kokkos::HIP>::value) {
+    return DLDevice{kDLROCM,Kokkos::HIP().hip_device()};
+  }
+#elif defined(KOKKOS_ENABLE_SYCL)
+  if (std::is_same<Kokkos::DefaultExecutionSpace,Kokkos::Experimental::SYCL>::value) {
+    return DLDevice{kDLOneAPI,0};
+  }
+#endif
+  return DLDevice{kDLCPU,0};
+}
+
+} // namespace dlpack
+} // namespace scream
+
+#endif // PYDLPACK_HPP
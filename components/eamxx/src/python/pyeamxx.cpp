@@ -1,4 +1,5 @@
 #include <share/scream_session.hpp>
+#include <share/util/scream_timing.hpp>
 #include "pyfield.hpp"
 #include "pygrid.hpp"
 #include "pyatmproc.hpp"
@@ -15,10 +16,14 @@ namespace py = pybind11;
 
 namespace scream {
 
+// Whether GPTL was already initialized when we called init
+bool gptl_externally_handled = false;
+
 void initialize (MPI_Comm mpi_comm) {
   ekat::Comm comm(mpi_comm);
   initialize_scream_session(comm.am_i_root());
   scorpio::init_subsystem(comm);
+  init_gptl(gptl_externally_handled);
 }
 
 void initialize () {
@@ -28,6 +33,9 @@ void initialize (pybind11::object py_comm) {
   initialize(get_c_comm(py_comm));
 }
 void finalize () {
+  if (not gptl_externally_handled) {
+    finalize_gptl();
+  }
   scorpio::finalize_subsystem();
   finalize_scream_session();
 }
@@ -41,6 +49,12 @@ PYBIND11_MODULE (pyeamxx,m) {
   m.def("init",py::overload_cast<pybind11::object>(&initialize));
   m.def("finalize",&finalize);
 
+  // Timers (GPTL) and device synchronization, for python-driven benchmarks
+  m.def("start_timer",&start_timer);
+  m.def("stop_timer",&stop_timer);
+  m.def("get_timer_wallclock",&get_timer_wallclock);
+  m.def("fence",[]() { Kokkos::fence(); });
+
   // Call all other headers' registration routines
   pybind_pyparamlist(m);
   pybind_pyfield(m);
@@ -10,6 +10,7 @@ from libpyeamxx.libpyeamxx_ext import init
 from libpyeamxx.libpyeamxx_ext import Field
 from libpyeamxx.libpyeamxx_ext import P3
 from libpyeamxx.libpyeamxx_ext import finalize
+from libpyeamxx.libpyeamxx_ext import fence
 
 
 __all__ = [
@@ -20,4 +21,5 @@ __all__ = [
     'ParameterList',
     'Field',
     'P3',
+    'fence',
 ]
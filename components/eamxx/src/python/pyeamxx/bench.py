@@ -0,0 +1,109 @@
+"""
+    Python-driven benchmarks of single atmosphere processes.
+
+    The process is built standalone, on a synthetic point grid, and run
+    for a number of steps. Each call to run is timed with a GPTL timer,
+    with a fence after the call, so that the time includes the device work.
+
+    Example:
+
+        import pyeamxx
+        from pyeamxx import bench
+
+        pyeamxx.init()
+        params = {"Type": "p3", "max_total_ni": 740.0e3}
+        results = bench.sweep(params, ncols=[128,1024], nlevs=[72,128],
+                              ic_file="screami_unit_tests_ne2np4L72_20220822.nc")
+        bench.print_results(results)
+        pyeamxx.finalize()
+
+    Fields that are not found in the IC file (or if no IC file is given) are
+    left to zero, unless the user sets them via the init_fields callback, which
+    is called with the AtmProc object after reading the IC file. Since synthetic
+    data may violate the process property checks, these are disabled by default.
+
+    NOTE: the pack size used by the process kernels is set at compile time
+          (SCREAM_PACK_SIZE). The pack_sizes sweep only changes the padding
+          of the fields allocation.
+"""
+
+import itertools
+
+from libpyeamxx.libpyeamxx_ext import AtmProc
+from libpyeamxx.libpyeamxx_ext import Grid
+from libpyeamxx.libpyeamxx_ext import ParameterList
+from libpyeamxx.libpyeamxx_ext import start_timer
+from libpyeamxx.libpyeamxx_ext import stop_timer
+from libpyeamxx.libpyeamxx_ext import get_timer_wallclock
+from libpyeamxx.libpyeamxx_ext import fence
+
+# Timers already used by run_process. GPTL accumulates the time of each timer,
+# and errors out if we query a timer that was never started.
+_started_timers = set()
+
+###############################################################################
+def run_process(params, ncol, nlev, pack_size=1, nsteps=10, nwarmup=1, dt=300.0,
+                t0="2021-10-12-45000", ic_file=None, init_fields=None, comm=None):
+###############################################################################
+    """
+    Build the process described by the params dict on a grid with ncol columns
+    and nlev levels, and return the average time (in seconds) of each call to run.
+    """
+
+    params = dict(params)
+    params.setdefault("enable_precondition_checks", False)
+    params.setdefault("enable_postcondition_checks", False)
+
+    grid = Grid("Physics", ncol, nlev) if comm is None else Grid("Physics", ncol, nlev, comm)
+    proc = AtmProc(ParameterList(params), grid, pack_size)
+
+    if ic_file is not None:
+        proc.read_ic(str(ic_file))
+    if init_fields is not None:
+        init_fields(proc)
+    proc.initialize(t0)
+
+    for _ in range(nwarmup):
+        proc.run(dt)
+    fence()
+
+    # Different timer for each configuration. If the same configuration was
+    # already timed, subtract the time accumulated so far.
+    timer = f"pyeamxx::bench::{proc.name()}::ncol={ncol}::nlev={nlev}::pack={pack_size}"
+    wc0 = get_timer_wallclock(timer) if timer in _started_timers else 0.0
+    _started_timers.add(timer)
+    for _ in range(nsteps):
+        start_timer(timer)
+        proc.run(dt)
+        fence()
+        stop_timer(timer)
+
+    return (get_timer_wallclock(timer) - wc0) / nsteps
+
+###############################################################################
+def sweep(params, ncols, nlevs, pack_sizes=(1,), **kwargs):
+###############################################################################
+    """
+    Run the process for all combinations of ncols, nlevs, and pack_sizes.
+    Additional keyword arguments are forwarded to run_process.
+    Returns a list of dicts, one per configuration.
+    """
+
+    results = []
+    for ncol, nlev, pack_size in itertools.product(ncols, nlevs, pack_sizes):
+        t = run_process(params, ncol, nlev, pack_size=pack_size, **kwargs)
+        results.append({"ncol"         : ncol,
+                        "nlev"         : nlev,
+                        "pack_size"    : pack_size,
+                        "time_per_call": t,
+                        "time_per_col" : t / ncol})
+    return results
+
+###############################################################################
+def print_results(results):
+###############################################################################
+
+    print (f"{'ncol':>8} {'nlev':>6} {'pack':>6} {'time/call [s]':>14} {'time/col [s]':>14}")
+    for r in results:
+        print (f"{r['ncol']:>8} {r['nlev']:>6} {r['pack_size']:>6} "
+               f"{r['time_per_call']:>14.6e} {r['time_per_col']:>14.6e}")
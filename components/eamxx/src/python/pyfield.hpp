@@ -4,10 +4,14 @@
 #include "share/field/field.hpp"
 #include "share/field/field_utils.hpp"
 
+#include "pydlpack.hpp"
+
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 #include <pybind11/stl.h>
 
+#include <memory>
+
 namespace scream {
 
 struct PyField {
@@ -25,15 +29,9 @@ struct PyField {
   }
 
   pybind11::array get () const {
-    const auto& fh  = f.get_header();
-    const auto& fid = fh.get_identifier();
+    const auto& fid = f.get_header().get_identifier();
 
-    // Can this actually happen? For now, no, since we only create fields from identifiers, so each PyField
-    // holds separate memory. However, this may change if we allow subfields.
-    EKAT_REQUIRE_MSG (f.get_header().get_parent().lock()==nullptr,
-        "Error! Cannot get the array for a field that is a subfield of another. Please, get array of parent field.\n"
-        "  - field name : " + fid.name() + "\n"
-        "  - parent name: " + fh.get_parent().lock()->get_identifier().name() + "\n");
+    check_not_subfield();
 
     // Get array shape and strides.
     // NOTE: since the field may be padded, the strides do not necessarily
@@ -69,32 +67,127 @@ struct PyField {
   void sync_to_dev () {
     f.sync_to_dev();
   }
+  // Enqueue the copy, and return without waiting for it. Call pyeamxx.fence()
+  // before using the data on the other memory space.
+  void sync_to_host_async () {
+    f.sync_to_host_async();
+  }
+  void sync_to_dev_async () {
+    f.sync_to_dev_async();
+  }
+
+  // DLPack protocol, which allows other python libraries (e.g., CuPy, PyTorch)
+  // to use the device view of the field without copies. E.g., cupy.from_dlpack(f).
+  // The field memory is kept alive until the consumer releases the tensor.
+  pybind11::capsule dlpack (const pybind11::object& /* stream */) const {
+    const auto& fid = f.get_header().get_identifier();
+
+    check_not_subfield();
+
+    // The consumer may use the data on a different stream, so make sure
+    // all pending work on the field is done
+    Kokkos::fence();
+
+    struct Context {
+      Field f;
+      std::vector<std::int64_t> shape, strides;
+      dlpack::DLManagedTensor tensor;
+    };
+    auto ctx = std::make_unique<Context>();
+    ctx->f = f;
+
+    std::vector<ssize_t> strides;
+    dlpack::DLDataType dt;
+    switch (fid.data_type()) {
+      case DataType::IntType:
+        get_dt_and_set_strides<int,Device>(strides);
+        dt = {dlpack::kDLInt,32,1};
+        break;
+      case DataType::FloatType:
+        get_dt_and_set_strides<float,Device>(strides);
+        dt = {dlpack::kDLFloat,32,1};
+        break;
+      case DataType::DoubleType:
+        get_dt_and_set_strides<double,Device>(strides);
+        dt = {dlpack::kDLFloat,64,1};
+        break;
+      default:
+        EKAT_ERROR_MSG ("Unrecognized/unsupported data type.\n");
+    }
+
+    // DLPack strides are in number of elements, not bytes
+    const auto& dims = fid.get_layout().dims();
+    const int elem_size = dt.bits/8;
+    for (int i=0; i<f.rank(); ++i) {
+      ctx->shape.push_back(dims[i]);
+      ctx->strides.push_back(strides[i]/elem_size);
+    }
+
+    auto& t = ctx->tensor.dl_tensor;
+    t.data        = f.get_internal_view_data_unsafe<void,Device>();
+    t.device      = dlpack::get_device();
+    t.ndim        = f.rank();
+    t.dtype       = dt;
+    t.shape       = ctx->shape.data();
+    t.strides     = ctx->strides.data();
+    t.byte_offset = 0;
+    ctx->tensor.manager_ctx = ctx.get();
+    ctx->tensor.deleter = [](dlpack::DLManagedTensor* self) {
+      delete static_cast<Context*>(self->manager_ctx);
+    };
+
+    // If the consumer takes the tensor, it renames the capsule, and becomes
+    // responsible for calling the deleter.
+    auto tensor = &ctx.release()->tensor;
+    return pybind11::capsule(tensor,"dltensor",[](PyObject* capsule) {
+      if (PyCapsule_IsValid(capsule,"dltensor")) {
+        auto t = static_cast<dlpack::DLManagedTensor*>(PyCapsule_GetPointer(capsule,"dltensor"));
+        t->deleter(t);
+      }
+    });
+  }
+
+  pybind11::tuple dlpack_device () const {
+    const auto dev = dlpack::get_device();
+    return pybind11::make_tuple(static_cast<int>(dev.device_type),dev.device_id);
+  }
+
   void print() const {
     print_field_hyperslab(f);
   }
 private:
 
-  template<typename T>
+  void check_not_subfield () const {
+    // Can this actually happen? For now, no, since we only create fields from identifiers, so each PyField
+    // holds separate memory. However, this may change if we allow subfields.
+    const auto& fh = f.get_header();
+    EKAT_REQUIRE_MSG (fh.get_parent().lock()==nullptr,
+        "Error! Cannot get the array for a field that is a subfield of another. Please, get array of parent field.\n"
+        "  - field name : " + fh.get_identifier().name() + "\n"
+        "  - parent name: " + fh.get_parent().lock()->get_identifier().name() + "\n");
+  }
+
+  template<typename T, HostOrDevice HD = Host>
   pybind11::dtype get_dt_and_set_strides (std::vector<ssize_t>& strides) const
   {
     strides.resize(f.rank());
     switch (f.rank()) {
       case 1:
       {
-        auto v = f.get_view<const T*,Host>();
+        auto v = f.get_view<const T*,HD>();
         strides[0] = v.stride(0)*sizeof(T);
         break;
       }
       case 2:
       {
-        auto v = f.get_view<const T**,Host>();
+        auto v = f.get_view<const T**,HD>();
         strides[0] = v.stride(0)*sizeof(T);
         strides[1] = v.stride(1)*sizeof(T);
         break;
       }
       case 3:
       {
-        auto v = f.get_view<const T***,Host>();
+        auto v = f.get_view<const T***,HD>();
         strides[0] = v.stride(0)*sizeof(T);
         strides[1] = v.stride(1)*sizeof(T);
         strides[2] = v.stride(2)*sizeof(T);
@@ -102,7 +195,7 @@ private:
       }
       case 4:
       {
-        auto v = f.get_view<const T****,Host>();
+        auto v = f.get_view<const T****,HD>();
         strides[0] = v.stride(0)*sizeof(T);
         strides[1] = v.stride(1)*sizeof(T);
         strides[2] = v.stride(2)*sizeof(T);
@@ -111,7 +204,7 @@ private:
       }
       case 5:
       {
-        auto v = f.get_view<const T*****,Host>();
+        auto v = f.get_view<const T*****,HD>();
         strides[0] = v.stride(0)*sizeof(T);
         strides[1] = v.stride(1)*sizeof(T);
         strides[2] = v.stride(2)*sizeof(T);
@@ -137,6 +230,12 @@ inline void pybind_pyfield (pybind11::module& m) {
     .def("get",&PyField::get)
     .def("sync_to_host",&PyField::sync_to_host)
     .def("sync_to_dev",&PyField::sync_to_dev)
+    .def("sync_to_host_async",&PyField::sync_to_host_async)
+    .def("sync_to_dev_async",&PyField::sync_to_dev_async)
+    .def("__dlpack__",[](const PyField& self, const pybind11::object& stream, const pybind11::kwargs&) {
+          return self.dlpack(stream);
+        }, pybind11::arg("stream")=pybind11::none())
+    .def("__dlpack_device__",&PyField::dlpack_device)
     .def("print",&PyField::print);
 }
 
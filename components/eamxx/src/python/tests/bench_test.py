@@ -0,0 +1,50 @@
+# Checks pyeamxx.bench on a CldFraction atm proc.
+from mpi4py import MPI  # Initializes MPI
+import numpy as np
+import pyeamxx
+from pyeamxx import bench
+
+#########################################
+def init_fields (proc):
+#########################################
+    # Half of the cells have ice
+    qi = proc.get_field("qi")
+    v = qi.get()
+    v[:] = np.where(np.arange(v.size).reshape(v.shape) % 2 == 0, 1e-3, 0.0)
+    qi.sync_to_dev()
+    init_fields.ncalls += 1
+
+init_fields.ncalls = 0
+
+#########################################
+def main ():
+#########################################
+
+    params = {"Type" : "CldFraction"}
+
+    # The first call to run_process must not query a timer that does not exist yet
+    t1 = bench.run_process(params, 8, 10, nsteps=3, init_fields=init_fields)
+    assert init_fields.ncalls==1
+    assert t1>0
+
+    # The same configuration again, with the timer already started
+    t2 = bench.run_process(params, 8, 10, nsteps=3, init_fields=init_fields)
+    assert init_fields.ncalls==2
+    assert t2>0
+
+    results = bench.sweep(params, ncols=[4,8], nlevs=[10], pack_sizes=[1,4], nsteps=2)
+    assert len(results)==4
+    for r in results:
+        assert r["time_per_call"]>0
+        assert r["time_per_col"]==r["time_per_call"]/r["ncol"]
+    bench.print_results(results)
+
+    print ("bench_test: PASS")
+
+####################################
+if  __name__  == "__main__":
+    # This level of indirection ensures all pybind structs are destroyed
+    # before we finalize eamxx (and hence kokkos)
+    pyeamxx.init()
+    main ()
+    pyeamxx.finalize()
@@ -0,0 +1,94 @@
+# Checks the DLPack export and the async syncs of pyeamxx fields, using the
+# fields of a CldFraction atm proc. The device data is read via numpy on
+# host-only builds, and via cupy (if available) on GPU builds.
+import gc
+
+from mpi4py import MPI  # Initializes MPI
+import numpy as np
+import pyeamxx
+
+kDLCPU = 1
+
+#########################################
+def get_consumer (field):
+#########################################
+    dev_type, _ = field.__dlpack_device__()
+    if dev_type==kDLCPU:
+        return np.from_dlpack, lambda a: a
+    try:
+        import cupy
+    except ImportError:
+        return None, None
+    return cupy.from_dlpack, cupy.asnumpy
+
+#########################################
+def main ():
+#########################################
+
+    # With pack_size=16 (the max SCREAM_PACK_SIZE), the fields are padded to 16 levels
+    ncols, nlevs, pack_size = 5, 7, 16
+    grid = pyeamxx.Grid("Physics",ncols,nlevs)
+    params = pyeamxx.ParameterList({"Type" : "CldFraction"})
+    proc = pyeamxx.AtmProc(params,grid,pack_size)
+
+    qi  = proc.get_field("qi")
+    liq = proc.get_field("cldfrac_liq")
+    tot = proc.get_field("cldfrac_tot")
+
+    from_dlpack, to_numpy = get_consumer(qi)
+    if from_dlpack is None:
+        print ("WARNING! No DLPack consumer for the device memory (cupy). Skipping device checks.")
+
+    # Set the inputs on host, and copy them to device asynchronously
+    rng = np.random.default_rng(seed=1234)
+    qi_vals  = np.where(rng.random((ncols,nlevs))>0.5, 1e-3, 0.0)
+    liq_vals = rng.random((ncols,nlevs))
+    qi.get()[:]  = qi_vals
+    liq.get()[:] = liq_vals
+    qi.sync_to_dev_async()
+    liq.sync_to_dev_async()
+    pyeamxx.fence()
+
+    if from_dlpack is not None:
+        # Shape and strides of the padded device view
+        host = qi.get()
+        itemsize = host.itemsize
+        assert host.strides==(pack_size*itemsize,itemsize)
+        dev = from_dlpack(qi)
+        assert dev.shape==(ncols,nlevs)
+        assert dev.strides==host.strides
+        assert np.array_equal(to_numpy(dev),qi_vals)
+        assert np.array_equal(to_numpy(from_dlpack(liq)),liq_vals)
+
+    # Run, and copy the output to host asynchronously
+    proc.initialize("2021-10-12-45000")
+    proc.run(300)
+    tot.sync_to_host_async()
+    pyeamxx.fence()
+    expected = np.maximum(np.where(qi_vals>1e-12, 1.0, 0.0),liq_vals)
+    assert np.array_equal(tot.get(),expected)
+
+    if from_dlpack is not None:
+        # An unconsumed capsule frees the tensor when it is garbage collected
+        cap = tot.__dlpack__()
+        del cap
+        gc.collect()
+
+        # A consumed tensor keeps the field memory alive after the field and
+        # the atm proc are gone, until the consumer releases it
+        dev = from_dlpack(tot)
+        del qi, liq, tot, proc
+        gc.collect()
+        assert np.array_equal(to_numpy(dev),expected)
+        del dev
+        gc.collect()
+
+    print ("dlpack_test: PASS")
+
+####################################
+if  __name__  == "__main__":
+    # This level of indirection ensures all pybind structs are destroyed
+    # before we finalize eamxx (and hence kokkos)
+    pyeamxx.init()
+    main ()
+    pyeamxx.finalize()
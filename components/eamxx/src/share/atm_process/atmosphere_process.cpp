@@ -2,6 +2,7 @@
 #include "share/util/scream_timing.hpp"
 #include "share/property_checks/mass_and_energy_column_conservation_check.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/util/scream_universal_constants.hpp"
 
 #include "ekat/ekat_assert.hpp"
 
@@ -12,6 +13,86 @@
 namespace scream
 {
 
+namespace {
+
+template<int N>
+void lightweight_tendency_update_impl (const Field& f, const Field& snap,
+                                       const Field& tend, const bool store)
+{
+  using ExeSpace    = KokkosTypes<DefaultDevice>::ExeSpace;
+  using RangePolicy = Kokkos::RangePolicy<ExeSpace>;
+  using real_data_t = typename ekat::DataND<Real,N>::type;
+  using snap_data_t = typename ekat::DataND<float,N>::type;
+  using const_real_data_t = typename ekat::DataND<const Real,N>::type;
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  Kokkos::Array<int,Field::MaxRank> ext;
+  for (int i=0; i<Field::MaxRank; ++i) {
+    ext[i] = i<N ? fl.dim(i) : 1;
+  }
+
+  // As in Field::update, entries equal to the fill value stay filled
+  Real fill_val = constants::DefaultFillValue<Real>().value;
+  if (f.get_header().has_extra_data("mask_value")) {
+    fill_val = f.get_header().get_extra_data<Real>("mask_value");
+  }
+  const float snap_fill_val = fill_val;
+
+  auto fv = f.get_strided_view<const_real_data_t>();
+  auto sv = snap.get_strided_view<snap_data_t>();
+  auto policy = RangePolicy(0,fl.size());
+  if (store) {
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+      int i[Field::MaxRank];
+      for (int n=Field::MaxRank-1, r=idx; n>=0; --n) {
+        i[n] = r % ext[n];
+        r /= ext[n];
+      }
+      sv.access(i[0],i[1],i[2],i[3],i[4],i[5]) = fv.access(i[0],i[1],i[2],i[3],i[4],i[5]);
+    });
+  } else {
+    auto tv = tend.get_strided_view<real_data_t>();
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const int idx) {
+      int i[Field::MaxRank];
+      for (int n=Field::MaxRank-1, r=idx; n>=0; --n) {
+        i[n] = r % ext[n];
+        r /= ext[n];
+      }
+      const float s = sv.access(i[0],i[1],i[2],i[3],i[4],i[5]);
+      const Real  v = fv.access(i[0],i[1],i[2],i[3],i[4],i[5]);
+      auto& t = tv.access(i[0],i[1],i[2],i[3],i[4],i[5]);
+      if (t==fill_val || v==fill_val || s==snap_fill_val) {
+        t = fill_val;
+      } else {
+        t += v - s;
+      }
+    });
+  }
+  Kokkos::fence();
+}
+
+// Field::deep_copy and Field::update require all fields to have the same data
+// type, so we need ad-hoc kernels for the single precision snapshots. If store=true,
+// copy f into snap, otherwise accumulate f-snap into tend (in one pass).
+void lightweight_tendency_update (const Field& f, const Field& snap,
+                                  const Field& tend, const bool store)
+{
+  switch (f.rank()) {
+    case 0: lightweight_tendency_update_impl<0>(f,snap,tend,store); break;
+    case 1: lightweight_tendency_update_impl<1>(f,snap,tend,store); break;
+    case 2: lightweight_tendency_update_impl<2>(f,snap,tend,store); break;
+    case 3: lightweight_tendency_update_impl<3>(f,snap,tend,store); break;
+    case 4: lightweight_tendency_update_impl<4>(f,snap,tend,store); break;
+    case 5: lightweight_tendency_update_impl<5>(f,snap,tend,store); break;
+    case 6: lightweight_tendency_update_impl<6>(f,snap,tend,store); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Rank not supported in lightweight_tendency_update.\n"
+          " - field name: " + f.name() + "\n");
+  }
+}
+
+} // anonymous namespace
+
 ekat::logger::LogLevel str2LogLevel (const std::string& s) {
   using namespace ekat::logger;
 
@@ -64,6 +145,12 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
       m_params.get<bool>("enable_column_conservation_checks", false);
 
   m_internal_diagnostics_level = m_params.get<int>("internal_diagnostics_level", 0);
+  m_state_fingerprint_file = m_params.get<std::string>("state_fingerprint_file", "");
+  m_state_capture_file  = m_params.get<std::string>("state_capture_file", "");
+  m_state_capture_step  = m_params.get<int>("state_capture_step", 0);
+  m_state_capture_ncols = m_params.get<int>("state_capture_ncols", 0);
+
+  m_lightweight_tendencies = m_params.get<bool>("lightweight_tendencies", false);
 }
 
 void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type) {
@@ -78,7 +165,21 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
   for (const auto& it : m_proc_tendencies) {
     const auto& tname = it.first;
     const auto& fname = m_tend_to_field.at(tname);
-    m_start_of_step_fields[fname] = get_field_out(fname).clone();
+    const auto& f = get_field_out(fname);
+    if (m_lightweight_tendencies) {
+      // Store the snapshot in single precision. No need to init it, since
+      // init_step_tendencies overwrites it at the beginning of each step
+      const auto& fid = f.get_header().get_identifier();
+      FieldIdentifier snap_fid (fname,fid.get_layout(),fid.get_units(),
+                                fid.get_grid_name(),DataType::FloatType);
+      Field snap (snap_fid);
+      snap.get_header().get_alloc_properties().request_allocation(
+          f.get_header().get_alloc_properties().get_largest_pack_size());
+      snap.allocate_view();
+      m_start_of_step_fields[fname] = snap;
+    } else {
+      m_start_of_step_fields[fname] = f.clone();
+    }
   }
 
   if (this->type()!=AtmosphereProcessType::Group) {
@@ -94,6 +195,10 @@ void AtmosphereProcess::run (const double dt) {
     run_precondition_checks();
   }
 
+  if (m_state_capture_file!="" && timestamp().get_num_steps()==m_state_capture_step) {
+    capture_state(dt);
+  }
+
   // Let the derived class do the actual run
   auto dt_sub = dt / m_num_subcycles;
 
@@ -120,6 +225,9 @@ void AtmosphereProcess::run (const double dt) {
       print_global_state_hash(name() + "-pst-sc-" + std::to_string(m_subcycle_iter),
                               true, true, true);
 
+    if (m_state_fingerprint_file!="")
+      record_state_fingerprint();
+
     if (has_column_conservation_check()) {
       // Run the column local mass and energy conservation checks
       run_column_conservation_check();
@@ -499,7 +607,11 @@ void AtmosphereProcess::init_step_tendencies () {
       const auto& fname = it.first;
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
-      f_beg.deep_copy(f);
+      if (m_lightweight_tendencies) {
+        lightweight_tendency_update(f,f_beg,Field(),true);
+      } else {
+        f_beg.deep_copy(f);
+      }
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
@@ -519,8 +631,12 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
             auto& tend  = it.second;
 
       // Compute tend from this atm proc step, then sum into overall atm timestep tendency
-      f_beg.update(f,1,-1);
-      tend.update(f_beg,1,1);
+      if (m_lightweight_tendencies) {
+        lightweight_tendency_update(f,f_beg,tend,false);
+      } else {
+        f_beg.update(f,1,-1);
+        tend.update(f_beg,1,1);
+      }
     }
     stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
   }
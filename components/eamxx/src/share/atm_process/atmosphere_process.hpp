@@ -28,6 +28,10 @@
 
 namespace scream
 {
+
+// Defined in atmosphere_process_hash.cpp
+struct StateFingerprint;
+
 /*
  *  The abstract interface of a process of the atmosphere (AP)
  *
@@ -277,6 +281,17 @@ public:
                                const bool out = true, const bool internal = true) const;
   // For BFB tracking in production simulations.
   void print_fast_global_state_hash(const std::string& label) const;
+  // Appends the global hash of each field of this process to the binary
+  // state fingerprint log (see scripts/compare-fingerprints).
+  void record_state_fingerprint();
+  // Dumps the fields of this process (on a subset of the columns) to the
+  // state capture file, to be replayed offline (see eamxx-replay).
+  void capture_state(const double dt);
+  // Capturing the state requires the process grid (for the geometry data).
+  // This is set by the AtmosphereProcessGroup, right after calling set_grids.
+  void set_state_capture_grids (const std::shared_ptr<const GridsManager>& gm) {
+    m_state_capture_grids = gm;
+  }
 
   // Set IOP object
   virtual void set_iop(const iop_ptr& iop) {
@@ -581,12 +596,26 @@ private:
   // Whether this atm proc should compute tendencies for any of its updated fields
   bool m_compute_proc_tendencies = false;
 
+  // If true, start-of-step snapshots are stored in single precision, and the
+  // tendency is accumulated with a single fused pass over the fields
+  bool m_lightweight_tendencies = false;
+
   // Log level for when property checks perform a repair
   ekat::logger::LogLevel  m_repair_log_level;
 
   // Controls global hashing output for debugging non-BFBness.
   int m_internal_diagnostics_level;
 
+  // If not empty, per-field hashes are recorded in this file after each subcycle
+  std::string m_state_fingerprint_file;
+  std::shared_ptr<StateFingerprint> m_state_fingerprint;
+
+  // If not empty, the state is captured in this file at the beginning of the given step
+  std::string m_state_capture_file;
+  int m_state_capture_step;
+  int m_state_capture_ncols;
+  std::shared_ptr<const GridsManager> m_state_capture_grids;
+
 protected:
 
   // IOP object
@@ -0,0 +1,343 @@
+#include "share/atm_process/atmosphere_process_capture.hpp"
+#include "share/atm_process/atmosphere_process.hpp"
+
+#include "ekat/ekat_assert.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <set>
+
+namespace scream {
+
+namespace {
+
+// The format of a capture file is (all integers are int32):
+//  - header: "EXXSC1\n\0", sizeof(Real)
+//  - proc name, grid name, ncols, nlevs
+//  - t0 (year, month, day, hours, minutes, seconds, num_steps), dt (double)
+//  - number of entries, followed by the entries. Each entry is:
+//    kind ('F' for fields, 'G' for geometry data), name, rank,
+//    and, for each dim, tag, extent, and dim name, followed by the data
+// Strings are stored as their length followed by the characters.
+constexpr char capture_header[] = "EXXSC1\n";
+
+template<typename T>
+void write (std::FILE* f, const T& v) {
+  std::fwrite(&v, sizeof(T), 1, f);
+}
+
+void write (std::FILE* f, const std::string& s) {
+  write(f, static_cast<std::int32_t>(s.size()));
+  std::fwrite(s.data(), 1, s.size(), f);
+}
+
+template<typename T>
+void read (std::FILE* f, T& v, const std::string& file_name) {
+  EKAT_REQUIRE_MSG (std::fread(&v, sizeof(T), 1, f)==1,
+      "Error! Unexpected end of state capture file.\n"
+      " - file name: " + file_name + "\n");
+}
+
+void read (std::FILE* f, std::string& s, const std::string& file_name) {
+  std::int32_t n;
+  read(f, n, file_name);
+  s.resize(n);
+  EKAT_REQUIRE_MSG (n==0 || std::fread(&s[0], 1, n, f)==static_cast<size_t>(n),
+      "Error! Unexpected end of state capture file.\n"
+      " - file name: " + file_name + "\n");
+}
+
+template<int N, bool ToField>
+void copy_field_data_impl (const Field& f, Real* buf, const std::vector<int>& cols)
+{
+  using value_t = std::conditional_t<ToField,Real,const Real>;
+  using data_t  = typename ekat::DataND<value_t,N>::type;
+
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  const bool by_col = N>0 && fl.tag(0)==FieldTag::Column;
+  int ext[Field::MaxRank];
+  long long size = 1;
+  for (int i=0; i<Field::MaxRank; ++i) {
+    ext[i] = i<N ? fl.dim(i) : 1;
+    if (i==0 && by_col) {
+      ext[i] = cols.size();
+    }
+    size *= ext[i];
+  }
+
+  if constexpr (not ToField) {
+    f.sync_to_host();
+  }
+  auto v = f.get_strided_view<data_t,Host>();
+  for (long long idx=0; idx<size; ++idx) {
+    int i[Field::MaxRank];
+    for (int n=Field::MaxRank-1, r=idx; n>=0; --n) {
+      i[n] = r % ext[n];
+      r /= ext[n];
+    }
+    if (by_col) {
+      i[0] = cols[i[0]];
+    }
+    if constexpr (ToField) {
+      v.access(i[0],i[1],i[2],i[3],i[4],i[5]) = buf[idx];
+    } else {
+      buf[idx] = v.access(i[0],i[1],i[2],i[3],i[4],i[5]);
+    }
+  }
+  if constexpr (ToField) {
+    f.sync_to_dev();
+  }
+}
+
+template<bool ToField>
+void copy_field_data (const Field& f, Real* buf, const std::vector<int>& cols)
+{
+  switch (f.rank()) {
+    case 0: copy_field_data_impl<0,ToField>(f,buf,cols); break;
+    case 1: copy_field_data_impl<1,ToField>(f,buf,cols); break;
+    case 2: copy_field_data_impl<2,ToField>(f,buf,cols); break;
+    case 3: copy_field_data_impl<3,ToField>(f,buf,cols); break;
+    case 4: copy_field_data_impl<4,ToField>(f,buf,cols); break;
+    case 5: copy_field_data_impl<5,ToField>(f,buf,cols); break;
+    case 6: copy_field_data_impl<6,ToField>(f,buf,cols); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Rank not supported in copy_field_data.\n"
+          " - field name: " + f.name() + "\n");
+  }
+}
+
+bool has_col_dim (const FieldLayout& fl) {
+  return fl.rank()>0 && fl.tag(0)==FieldTag::Column;
+}
+
+} // anonymous namespace
+
+void copy_field_data (const Field& f, Real* buf,
+                      const std::vector<int>& cols, const bool to_field)
+{
+  if (to_field) {
+    copy_field_data<true>(f,buf,cols);
+  } else {
+    copy_field_data<false>(f,buf,cols);
+  }
+}
+
+StateCapture read_state_capture (const std::string& file_name)
+{
+  auto file = std::fopen(file_name.c_str(),"rb");
+  EKAT_REQUIRE_MSG (file!=nullptr,
+      "Error! Could not open state capture file.\n"
+      " - file name: " + file_name + "\n");
+
+  char header[sizeof(capture_header)];
+  std::int32_t real_size;
+  read(file, header, file_name);
+  read(file, real_size, file_name);
+  EKAT_REQUIRE_MSG (std::strcmp(header,capture_header)==0,
+      "Error! Invalid state capture file.\n"
+      " - file name: " + file_name + "\n");
+  EKAT_REQUIRE_MSG (real_size==sizeof(Real),
+      "Error! State capture file was written with a different precision.\n"
+      " - file name: " + file_name + "\n"
+      " - sizeof(Real) in file: " + std::to_string(real_size) + "\n"
+      " - sizeof(Real) in this build: " + std::to_string(sizeof(Real)) + "\n");
+
+  StateCapture sc;
+  std::int32_t i32;
+  read(file, sc.proc_name, file_name);
+  read(file, sc.grid_name, file_name);
+  read(file, i32, file_name); sc.ncols = i32;
+  read(file, i32, file_name); sc.nlevs = i32;
+
+  std::int32_t ts[7];
+  read(file, ts, file_name);
+  sc.t0 = util::TimeStamp(ts[0],ts[1],ts[2],ts[3],ts[4],ts[5],ts[6]);
+  read(file, sc.dt, file_name);
+
+  std::int32_t nentries;
+  read(file, nentries, file_name);
+  for (int n=0; n<nentries; ++n) {
+    char kind;
+    std::string name;
+    std::int32_t rank;
+    read(file, kind, file_name);
+    read(file, name, file_name);
+    read(file, rank, file_name);
+    std::vector<FieldTag> tags(rank);
+    std::vector<int> dims(rank);
+    std::vector<std::string> dim_names(rank);
+    for (int i=0; i<rank; ++i) {
+      read(file, i32, file_name); tags[i] = static_cast<FieldTag>(i32);
+      read(file, i32, file_name); dims[i] = i32;
+      read(file, dim_names[i], file_name);
+    }
+    StateCapture::Entry e {name, FieldLayout(tags,dims,dim_names), {}};
+    e.data.resize(e.layout.size());
+    EKAT_REQUIRE_MSG (std::fread(e.data.data(), sizeof(Real), e.data.size(), file)==e.data.size(),
+        "Error! Unexpected end of state capture file.\n"
+        " - file name: " + file_name + "\n"
+        " - entry name: " + name + "\n");
+    (kind=='G' ? sc.geometry : sc.fields).push_back(std::move(e));
+  }
+  std::fclose(file);
+
+  return sc;
+}
+
+void AtmosphereProcess::capture_state (const double dt) {
+  EKAT_REQUIRE_MSG (m_state_capture_grids!=nullptr,
+      "Error! Cannot capture the state of an atm process without its grids manager.\n"
+      " - atm proc name: " + name() + "\n");
+
+  // Gather all fields of this process, without repetitions. Output fields are
+  // captured too, since some processes reuse them across steps
+  std::vector<Field> fields;
+  std::set<std::string> added;
+  auto add = [&](const Field& f) {
+    if (f.data_type()==DataType::RealType && added.insert(f.name()).second) {
+      fields.push_back(f);
+    }
+  };
+  for (const auto& f : m_fields_in)  add(f);
+  for (const auto& g : m_groups_in)  for (const auto& e : g.m_fields) add(*e.second);
+  for (const auto& f : m_fields_out) add(f);
+  for (const auto& g : m_groups_out) for (const auto& e : g.m_fields) add(*e.second);
+  for (const auto& f : get_internal_fields()) add(f);
+
+  // All fields with a COL dimension must be on the same grid
+  std::string grid_name;
+  for (const auto& f : fields) {
+    const auto& fid = f.get_header().get_identifier();
+    if (not has_col_dim(fid.get_layout())) {
+      continue;
+    }
+    if (grid_name=="") {
+      grid_name = fid.get_grid_name();
+    }
+    EKAT_REQUIRE_MSG (fid.get_grid_name()==grid_name,
+        "Error! State capture only supports atm procs whose fields are all on one grid.\n"
+        " - atm proc name: " + name() + "\n"
+        " - grids found: " + grid_name + ", " + fid.get_grid_name() + "\n");
+  }
+  EKAT_REQUIRE_MSG (grid_name!="",
+      "Error! State capture requires at least one field with a COL dimension.\n"
+      " - atm proc name: " + name() + "\n");
+  const auto grid = m_state_capture_grids->get_grid(grid_name);
+
+  // Select the columns to capture, evenly spread across the global grid,
+  // with columns ordered by rank
+  const int comm_size = m_comm.size();
+  const int nlocal = grid->get_num_local_dofs();
+  std::vector<int> ncols_per_rank(comm_size,0);
+  ncols_per_rank[m_comm.rank()] = nlocal;
+  m_comm.all_gather(ncols_per_rank.data(),1);
+  int offset = 0, nglobal = 0;
+  for (int pid=0; pid<comm_size; ++pid) {
+    if (pid<m_comm.rank()) offset += ncols_per_rank[pid];
+    nglobal += ncols_per_rank[pid];
+  }
+  const int ncap = m_state_capture_ncols>0 ? std::min(m_state_capture_ncols,nglobal) : nglobal;
+  const int stride = nglobal / ncap;
+  std::vector<int> cols;
+  for (int icol=0; icol<nlocal; ++icol) {
+    const int gcol = offset + icol;
+    if (gcol%stride==0 && gcol/stride<ncap) {
+      cols.push_back(icol);
+    }
+  }
+  std::vector<int> ncap_per_rank(comm_size,0);
+  ncap_per_rank[m_comm.rank()] = cols.size();
+  m_comm.all_gather(ncap_per_rank.data(),1);
+
+  // Gather the captured columns of a field (or geometry data) on the root rank
+  const auto mpi_real_t = ekat::get_mpi_type<Real>();
+  auto gather = [&](const Field& f, std::vector<Real>& data) -> FieldLayout {
+    const auto& fl = f.get_header().get_identifier().get_layout();
+    if (not has_col_dim(fl)) {
+      data.resize(fl.size());
+      copy_field_data(f,data.data(),cols,false);
+      return fl;
+    }
+    const int col_size = fl.size() / fl.dim(0);
+    std::vector<Real> local(cols.size()*col_size);
+    copy_field_data(f,local.data(),cols,false);
+    std::vector<int> counts(comm_size), displs(comm_size,0);
+    for (int pid=0; pid<comm_size; ++pid) {
+      counts[pid] = ncap_per_rank[pid]*col_size;
+      if (pid>0) displs[pid] = displs[pid-1] + counts[pid-1];
+    }
+    data.resize(m_comm.am_i_root() ? ncap*col_size : 0);
+    MPI_Gatherv (local.data(),local.size(),mpi_real_t,
+                 data.data(),counts.data(),displs.data(),mpi_real_t,
+                 m_comm.root_rank(),m_comm.mpi_comm());
+    auto dims = fl.dims();
+    dims[0] = ncap;
+    return FieldLayout(fl.tags(),dims,fl.names());
+  };
+
+  std::FILE* file = nullptr;
+  if (m_comm.am_i_root()) {
+    file = std::fopen(m_state_capture_file.c_str(),"wb");
+    EKAT_REQUIRE_MSG (file!=nullptr,
+        "Error! Could not open state capture file.\n"
+        " - atm proc name: " + name() + "\n"
+        " - file name: " + m_state_capture_file + "\n");
+    std::fwrite(capture_header,1,sizeof(capture_header),file);
+    write(file, static_cast<std::int32_t>(sizeof(Real)));
+    write(file, name());
+    write(file, grid_name);
+    write(file, static_cast<std::int32_t>(ncap));
+    write(file, static_cast<std::int32_t>(grid->get_num_vertical_levels()));
+    const auto& ts = timestamp();
+    const std::int32_t t[7] = {ts.get_year(), ts.get_month(), ts.get_day(),
+                               ts.get_hours(), ts.get_minutes(), ts.get_seconds(),
+                               ts.get_num_steps()};
+    write(file, t);
+    write(file, dt);
+  }
+
+  std::vector<Field> geometry;
+  for (const auto& n : grid->get_geometry_data_names()) {
+    auto g = grid->get_geometry_data(n);
+    if (g.data_type()==DataType::RealType) {
+      geometry.push_back(g);
+    }
+  }
+  if (m_comm.am_i_root()) {
+    write(file, static_cast<std::int32_t>(fields.size()+geometry.size()));
+  }
+
+  std::vector<Real> data;
+  auto write_entry = [&](const Field& f, const char kind) {
+    const auto fl = gather(f,data);
+    if (not m_comm.am_i_root()) {
+      return;
+    }
+    write(file, kind);
+    write(file, f.name());
+    write(file, static_cast<std::int32_t>(fl.rank()));
+    for (int i=0; i<fl.rank(); ++i) {
+      write(file, static_cast<std::int32_t>(fl.tag(i)));
+      write(file, static_cast<std::int32_t>(fl.dim(i)));
+      write(file, fl.names()[i]);
+    }
+    std::fwrite(data.data(), sizeof(Real), data.size(), file);
+  };
+  for (const auto& f : fields) {
+    write_entry(f,'F');
+  }
+  for (const auto& g : geometry) {
+    write_entry(g,'G');
+  }
+
+  if (m_comm.am_i_root()) {
+    std::fclose(file);
+  }
+  log(LogLevel::info, "[EAMxx::" + name() + "] state captured in " + m_state_capture_file +
+      " (" + std::to_string(ncap) + " columns, " + std::to_string(fields.size()) + " fields)");
+}
+
+} // namespace scream
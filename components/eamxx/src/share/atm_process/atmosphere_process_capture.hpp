@@ -0,0 +1,54 @@
+#ifndef SCREAM_ATMOSPHERE_PROCESS_CAPTURE_HPP
+#define SCREAM_ATMOSPHERE_PROCESS_CAPTURE_HPP
+
+#include "share/field/field.hpp"
+#include "share/field/field_layout.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ *  The state of an atm process, captured at the beginning of a step
+ *  (see the state_capture_* parameters of AtmosphereProcess).
+ *
+ *  Fields with a COL dimension are stored only on a subset of the columns,
+ *  which are spread evenly across the global grid. All data is stored
+ *  contiguously (no padding), with the columns in the order they were captured.
+ *  The geometry data of the process grid (lat, lon, area,...) is stored too,
+ *  so that the process can be run on a grid made only of the captured columns.
+ */
+struct StateCapture {
+  struct Entry {
+    std::string       name;
+    FieldLayout       layout;
+    std::vector<Real> data;
+  };
+
+  std::string proc_name;
+  std::string grid_name;
+  int ncols;
+  int nlevs;
+  util::TimeStamp t0;
+  double dt;
+
+  std::vector<Entry> fields;
+  std::vector<Entry> geometry;
+};
+
+// Reads a capture file written by AtmosphereProcess::capture_state
+StateCapture read_state_capture (const std::string& file_name);
+
+// Copies data between field f and the (contiguous) host buffer buf. If f has
+// a COL dimension (first), the j-th column in buf is the column cols[j] of f,
+// otherwise the whole field is copied. If to_field=true, the copy goes from buf
+// to f, and f is synced to device.
+void copy_field_data (const Field& f, Real* buf,
+                      const std::vector<int>& cols, const bool to_field);
+
+} // namespace scream
+
+#endif // SCREAM_ATMOSPHERE_PROCESS_CAPTURE_HPP
@@ -156,6 +156,7 @@ void AtmosphereProcessGroup::set_grids (const std::shared_ptr<const GridsManager
 
   for (auto& atm_proc : m_atm_processes) {
     atm_proc->set_grids(grids_manager);
+    atm_proc->set_state_capture_grids(grids_manager);
 
     // Add inputs/outputs to the list of inputs of the group
     for (const auto& req : atm_proc->get_required_field_requests()) {
@@ -4,111 +4,171 @@
 #include "share/util/scream_bfbhash.hpp"
 #include "ekat/ekat_assert.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <cstdio>
+#include <map>
+#include <set>
+#include <vector>
 
 namespace scream {
+
+// The list of fields hashed by an atm process in record_state_fingerprint,
+// together with the id of the process in the fingerprint log.
+struct StateFingerprint {
+  std::string file_name;
+  int proc_id;
+  std::vector<Field> fields;
+  std::vector<std::string> names;
+};
+
 namespace {
 
 using ExeSpace = KokkosTypes<DefaultDevice>::ExeSpace;
 using bfbhash::HashType;
 
-void hash (const Field::view_dev_t<const Real*>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      bfbhash::hash(v(idx), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);  
+// Location and shape of (a chunk of) a field in device memory. We hash all
+// fields in a single kernel, with one team per chunk, so that large fields
+// are spread over several teams.
+struct HashChunk {
+  static constexpr int MaxRank = Field::MaxRank;
+  static constexpr int ChunkSize = 1 << 16;
+
+  const Real* data;
+  int rank;
+  int dims[MaxRank];
+  int strides[MaxRank];
+  int begin, end;
+};
+
+template<typename ViewT>
+void add_chunks (const ViewT& v, const FieldLayout& lo, std::vector<HashChunk>& chunks) {
+  HashChunk c;
+  c.data = v.data();
+  c.rank = lo.rank();
+  for (int i=0; i<HashChunk::MaxRank; ++i) {
+    c.dims[i]    = i<c.rank ? lo.dim(i) : 1;
+    c.strides[i] = i<c.rank ? v.stride(i) : 0;
+  }
+  const int size = lo.size();
+  for (c.begin=0; c.begin<size; c.begin+=HashChunk::ChunkSize) {
+    c.end = std::min(c.begin+HashChunk::ChunkSize,size);
+    chunks.push_back(c);
+  }
 }
 
-void hash (const Field::view_dev_t<const Real**>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j;
-      unflatten_idx(idx, dims, i, j);
-      bfbhash::hash(v(i,j), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+// Rank-0 and rank-6 fields have never been hashed: keep skipping them, so that
+// the hashes printed by print_global_state_hash do not change.
+bool is_hashable (const Field& f) {
+  const int rank = f.get_header().get_identifier().get_layout().rank();
+  return f.data_type()==DataType::RealType && rank>=1 && rank<=5;
 }
 
-void hash (const Field::view_dev_t<const Real***>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k;
-      unflatten_idx(idx, dims, i, j, k);
-      bfbhash::hash(v(i,j,k), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+// Computes the local hash of each of the input fields, in one fused kernel.
+void hash (const std::vector<Field>& fields, std::vector<HashType>& hashes) {
+  std::vector<HashChunk> chunks;
+  std::vector<int> chunk_field;
+  for (size_t i=0; i<fields.size(); ++i) {
+    const auto& f  = fields[i];
+    const auto& lo = f.get_header().get_identifier().get_layout();
+    switch (lo.rank()) {
+      case 1: add_chunks(f.get_view<const Real*    >(), lo, chunks); break;
+      case 2: add_chunks(f.get_view<const Real**   >(), lo, chunks); break;
+      case 3: add_chunks(f.get_view<const Real***  >(), lo, chunks); break;
+      case 4: add_chunks(f.get_view<const Real**** >(), lo, chunks); break;
+      case 5: add_chunks(f.get_view<const Real*****>(), lo, chunks); break;
+      default:
+        EKAT_ERROR_MSG ("Error! Rank not supported in state hashing.\n"
+            " - field name: " + f.name() + "\n");
+    }
+    chunk_field.resize(chunks.size(),i);
+  }
+
+  hashes.assign(fields.size(),0);
+  const int nchunks = chunks.size();
+  if (nchunks==0) return;
+
+  Kokkos::View<HashChunk*,DefaultDevice> chunks_d ("chunks",nchunks);
+  Kokkos::View<HashType*,DefaultDevice>  hashes_d ("hashes",nchunks);
+  auto chunks_h = Kokkos::create_mirror_view(chunks_d);
+  for (int i=0; i<nchunks; ++i) chunks_h(i) = chunks[i];
+  Kokkos::deep_copy(chunks_d,chunks_h);
+
+  using TeamPolicy = Kokkos::TeamPolicy<ExeSpace>;
+  using MemberType = typename TeamPolicy::member_type;
+  Kokkos::parallel_for(TeamPolicy(nchunks,Kokkos::AUTO),
+    KOKKOS_LAMBDA(const MemberType& team) {
+      const int ic = team.league_rank();
+      const auto& c = chunks_d(ic);
+      HashType accum = 0;
+      Kokkos::parallel_reduce(Kokkos::TeamThreadRange(team,c.begin,c.end),
+        [&](const int idx, HashType& accum) {
+          int offset = 0;
+          for (int r=c.rank-1, q=idx; r>=0; --r) {
+            offset += (q % c.dims[r])*c.strides[r];
+            q /= c.dims[r];
+          }
+          bfbhash::hash(c.data[offset], accum);
+        }, bfbhash::HashReducer<>(accum));
+      Kokkos::single(Kokkos::PerTeam(team),[&]() {
+        hashes_d(ic) = accum;
+      });
+  });
+  auto hashes_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),hashes_d);
+
+  // The hash is commutative, so the result does not depend on the chunking
+  for (int i=0; i<nchunks; ++i) {
+    bfbhash::hash(hashes_h(i), hashes[chunk_field[i]]);
+  }
 }
 
-void hash (const Field::view_dev_t<const Real****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
-  HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m;
-      unflatten_idx(idx, dims, i, j, k, m);
-      bfbhash::hash(v(i,j,k,m), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+void gather (const std::list<Field>& fs, std::vector<Field>& fields) {
+  for (const auto& f : fs)
+    if (is_hashable(f))
+      fields.push_back(f);
 }
 
-void hash (const Field::view_dev_t<const Real*****>& v,
-           const FieldLayout& lo, HashType& accum_out) {
+void gather (const std::list<FieldGroup>& fgs, std::vector<Field>& fields) {
+  for (const auto& g : fgs)
+    for (const auto& e : g.m_fields)
+      if (is_hashable(*e.second))
+        fields.push_back(*e.second);
+}
+
+HashType hash (const std::vector<Field>& fields) {
+  std::vector<HashType> hashes;
+  hash(fields,hashes);
   HashType accum = 0;
-  const auto& dims = lo.extents();
-  Kokkos::parallel_reduce(
-    Kokkos::RangePolicy<ExeSpace>(0, lo.size()),
-    KOKKOS_LAMBDA(const int idx, HashType& accum) {
-      int i, j, k, m, n;
-      unflatten_idx(idx, dims, i, j, k, m, n);
-      bfbhash::hash(v(i,j,k,m,n), accum);
-    }, bfbhash::HashReducer<>(accum));
-  Kokkos::fence();
-  bfbhash::hash(accum, accum_out);
+  for (const auto h : hashes)
+    bfbhash::hash(h, accum);
+  return accum;
 }
 
-void hash (const Field& f, HashType& accum) {
-  const auto& hd = f.get_header();
-  const auto& id = hd.get_identifier();
-  if (id.data_type() != DataType::DoubleType) return;
-  const auto& lo = id.get_layout();
-  const auto rank = lo.rank();
-  switch (rank) {
-  case 1: hash(f.get_view<const Real*    >(), lo, accum); break;
-  case 2: hash(f.get_view<const Real**   >(), lo, accum); break;
-  case 3: hash(f.get_view<const Real***  >(), lo, accum); break;
-  case 4: hash(f.get_view<const Real**** >(), lo, accum); break;
-  case 5: hash(f.get_view<const Real*****>(), lo, accum); break;
-  default: break;
-  }  
+// Binary fingerprint logs. All processes that use the same file name share
+// the file, and only the root rank writes to it. The format is described
+// in scripts/compare_fingerprints.py.
+struct FingerprintLog {
+  std::FILE* file = nullptr;
+  std::map<std::string,int> proc_ids;
+
+  ~FingerprintLog () {
+    if (file) std::fclose(file);
+  }
+};
+
+std::map<std::string,FingerprintLog>& get_fingerprint_logs () {
+  static std::map<std::string,FingerprintLog> logs;
+  return logs;
 }
 
-void hash (const std::list<Field>& fs, HashType& accum) {
-  for (const auto& f : fs)
-    hash(f, accum);
+template<typename T>
+void write (std::FILE* f, const T& v) {
+  std::fwrite(&v, sizeof(T), 1, f);
 }
 
-void hash (const std::list<FieldGroup>& fgs, HashType& accum) {
-  for (const auto& g : fgs)
-    for (const auto& e : g.m_fields)
-      hash(*e.second, accum);
+void write (std::FILE* f, const std::string& s) {
+  write(f, static_cast<std::int32_t>(s.size()));
+  std::fwrite(s.data(), 1, s.size(), f);
 }
 
 } // namespace anon
@@ -117,12 +177,15 @@ void AtmosphereProcess
 ::print_global_state_hash (const std::string& label, const bool in, const bool out,
                            const bool internal) const {
   static constexpr int nslot = 3;
-  HashType laccum[nslot] = {0};
-  hash(m_fields_in, laccum[0]);
-  hash(m_groups_in, laccum[0]);
-  hash(m_fields_out, laccum[1]);
-  hash(m_groups_out, laccum[1]);
-  hash(m_internal_fields, laccum[2]);
+  std::vector<Field> fields[nslot];
+  gather(m_fields_in, fields[0]);
+  gather(m_groups_in, fields[0]);
+  gather(m_fields_out, fields[1]);
+  gather(m_groups_out, fields[1]);
+  gather(m_internal_fields, fields[2]);
+  HashType laccum[nslot];
+  for (int i = 0; i < nslot; ++i)
+    laccum[i] = hash(fields[i]);
   HashType gaccum[nslot];
   bfbhash::all_reduce_HashType(m_comm.mpi_comm(), laccum, gaccum, nslot);
   const bool show[] = {in, out, internal};
@@ -135,8 +198,9 @@ void AtmosphereProcess
 }
 
 void AtmosphereProcess::print_fast_global_state_hash (const std::string& label) const {
-  HashType laccum = 0;
-  hash(m_fields_in, laccum);
+  std::vector<Field> fields;
+  gather(m_fields_in, fields);
+  HashType laccum = hash(fields);
   HashType gaccum;
   bfbhash::all_reduce_HashType(m_comm.mpi_comm(), &laccum, &gaccum, 1);
   if (m_comm.am_i_root())
@@ -144,4 +208,74 @@ void AtmosphereProcess::print_fast_global_state_hash (const std::string& label)
             timestamp().get_num_steps(), (long long int) gaccum, label.c_str());
 }
 
+void AtmosphereProcess::record_state_fingerprint () {
+  auto& logs = get_fingerprint_logs();
+  if (m_state_fingerprint==nullptr) {
+    m_state_fingerprint = std::make_shared<StateFingerprint>();
+    auto& fp = *m_state_fingerprint;
+    fp.file_name = m_state_fingerprint_file;
+
+    // Gather all fields of this process, without repetitions
+    std::vector<Field> all;
+    gather(m_fields_in, all);
+    gather(m_groups_in, all);
+    gather(m_fields_out, all);
+    gather(m_groups_out, all);
+    gather(m_internal_fields, all);
+    std::set<std::string> added;
+    for (const auto& f : all) {
+      const auto& fid = f.get_header().get_identifier();
+      const auto fname = fid.name() + "@" + fid.get_grid_name();
+      if (added.insert(fname).second) {
+        fp.fields.push_back(f);
+        fp.names.push_back(fname);
+      }
+    }
+
+    auto& log = logs[fp.file_name];
+    if (log.proc_ids.count(name())==0) {
+      const int id = log.proc_ids.size();
+      log.proc_ids[name()] = id;
+    }
+    fp.proc_id = log.proc_ids.at(name());
+
+    if (m_comm.am_i_root()) {
+      if (log.file==nullptr) {
+        log.file = std::fopen(fp.file_name.c_str(),"wb");
+        EKAT_REQUIRE_MSG (log.file!=nullptr,
+            "Error! Could not open state fingerprint file.\n"
+            " - atm proc name: " + name() + "\n"
+            " - file name: " + fp.file_name + "\n");
+        std::fwrite("EXXFP1\n",1,8,log.file);
+      }
+      // Process record: the list of fields hashed by this process
+      write(log.file, 'P');
+      write(log.file, static_cast<std::int32_t>(fp.proc_id));
+      write(log.file, name());
+      write(log.file, static_cast<std::int32_t>(fp.names.size()));
+      for (const auto& n : fp.names)
+        write(log.file, n);
+    }
+  }
+  const auto& fp = *m_state_fingerprint;
+
+  const int nfields = fp.fields.size();
+  std::vector<HashType> lhashes, ghashes(nfields);
+  hash(fp.fields, lhashes);
+  if (nfields>0) {
+    bfbhash::all_reduce_HashType(m_comm.mpi_comm(), lhashes.data(), ghashes.data(), nfields);
+  }
+
+  if (m_comm.am_i_root()) {
+    // Hash record: the global hash of each field of the process
+    auto file = logs.at(fp.file_name).file;
+    write(file, 'H');
+    write(file, static_cast<std::int32_t>(fp.proc_id));
+    write(file, static_cast<std::int32_t>(timestamp().get_num_steps()));
+    write(file, static_cast<std::int32_t>(m_subcycle_iter));
+    std::fwrite(ghashes.data(), sizeof(HashType), nfields, file);
+    std::fflush(file);
+  }
+}
+
 } // namespace scream
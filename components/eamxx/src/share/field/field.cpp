@@ -78,6 +78,24 @@ sync_to_dev () const {
   Kokkos::deep_copy(m_data.d_view,m_data.h_view);
 }
 
+void Field::
+sync_to_host_async () const {
+  // Sanity check
+  EKAT_REQUIRE_MSG (is_allocated(),
+      "Error! Input field must be allocated in order to sync host and device views.\n");
+
+  Kokkos::deep_copy(DefaultDevice::execution_space(),m_data.h_view,m_data.d_view);
+}
+
+void Field::
+sync_to_dev_async () const {
+  // Sanity check
+  EKAT_REQUIRE_MSG (is_allocated(),
+      "Error! Input field must be allocated in order to sync host and device views.\n");
+
+  Kokkos::deep_copy(DefaultDevice::execution_space(),m_data.d_view,m_data.h_view);
+}
+
 Field Field::
 subfield (const std::string& sf_name, const ekat::units::Units& sf_units,
           const int idim, const int index, const bool dynamic) const {
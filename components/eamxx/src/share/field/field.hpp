@@ -195,6 +195,10 @@ public:
   //       host views to be seldom used, and even less frequently modified.
   void sync_to_host () const;
   void sync_to_dev () const;
+  // Same as above, but the copy is only enqueued on the default execution space
+  // instance. The caller must fence before using the data on the target side.
+  void sync_to_host_async () const;
+  void sync_to_dev_async () const;
 
   // Set the field to a constant value (on host or device)
   template<typename T, HostOrDevice HD = Device>
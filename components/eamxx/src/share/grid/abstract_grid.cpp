@@ -5,6 +5,7 @@
 #include <ekat/ekat_assert.hpp>
 
 #include <algorithm>
+#include <cstdint>
 #include <cstring>
 #include <string>
 
@@ -402,66 +403,9 @@ AbstractGrid::get_unique_gids () const
 std::vector<int> AbstractGrid::
 get_owners (const gid_view_h& gids) const
 {
-  const auto& comm = get_comm();
-
-  // Init owners to in
-  std::map<gid_type,int> owners;
-  int num_gids_in = gids.size();
-  for (int i=0; i<num_gids_in; ++i) {
-    owners[gids[i]] = -1;
-  }
-  int num_found = 0;
-
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid && num_found<num_gids_in; ++i) {
-      auto it = owners.find(data[i]);
-      if (it!=owners.end()) {
-        EKAT_REQUIRE_MSG (it->second==-1,
-            "Error! Found a GID with multiple owners.\n"
-            "  - owner 1: " + std::to_string(it->second) + "\n"
-            "  - owner 2: " + std::to_string(pid) + "\n");
-        it->second = pid;
-        ++num_found;
-      }
-    }
-  }
-  EKAT_REQUIRE_MSG (num_found==static_cast<int>(owners.size()),
-      "Error! Could not locate the owner of one of the input GIDs.\n"
-      "  - rank: " + std::to_string(comm.rank()) + "\n"
-      "  - num found: " + std::to_string(num_found) + "\n"
-      "  - num gids in: " + std::to_string(num_gids_in) + "\n");
-
-
-  // Now create and fill output view
-  std::vector<int> result(num_gids_in);
-  for (int i=0; i<num_gids_in; ++i) {
-    result[i] = owners.at(gids[i]);
-  }
-
-  return result;
+  std::vector<int> pids, lids;
+  get_remote_pids_and_lids(gids,pids,lids);
+  return pids;
 }
 
 void AbstractGrid::
@@ -472,10 +416,8 @@ get_remote_pids_and_lids (const gid_view_h& gids,
   const auto& comm = get_comm();
   int num_gids_in = gids.size();
 
-  pids.resize(num_gids_in,-1);
-  lids.resize(num_gids_in,-1);
-
-  int num_found = 0;
+  pids.assign(num_gids_in,-1);
+  lids.assign(num_gids_in,-1);
 
   // We may have repeated gids. In that case, we want to update
   // the pids/lids arrays at all indices corresponding to the same gid
@@ -485,44 +427,27 @@ get_remote_pids_and_lids (const gid_view_h& gids,
   }
   int num_unique_gids = gid2idx.size();
 
-  // Let each rank bcast its owned gids, so that other procs can
-  // check against their input list
-  // Note: we can't use a view of const, since the view ptr needs to be passed
-  //       to MPI bcast routines, which expect pointer to nonconst. It's an
-  //       innocuous issue though, since only the send rank will use the ptr
-  //       from the view, and it's not writing in it.
-  auto my_gids_h = m_dofs_gids.get_view<gid_type*,Host>();
-  gid_type* data;
-  std::vector<gid_type> pid_gids;
-  for (int pid=0; pid<comm.size(); ++pid) {
-    // Bcast gids count for this pid
-    int num_gids_pid = my_gids_h.size();
-    comm.broadcast(&num_gids_pid,1,pid);
-
-    // Bcast gids
-    if (pid==comm.rank()) {
-      data = my_gids_h.data();
-    } else {
-      pid_gids.resize(num_gids_pid);
-      data = pid_gids.data();
-    }
-    comm.broadcast(data,num_gids_pid,pid);
-
-    // Checks if any of the input pids is in this list
-    for (int i=0; i<num_gids_pid; ++i) {
-      auto it = gid2idx.find(data[i]);
-      if (it!=gid2idx.end()) {
-        for (auto idx : it->second) {
-          EKAT_REQUIRE_MSG (pids[idx]==-1,
-              "Error! Found a GID with multiple owners.\n"
-              "  - owner 1: " + std::to_string(pids[idx]) + "\n"
-              "  - owner 2: " + std::to_string(pid) + "\n");
-          pids[idx] = pid;
-          lids[idx] = i;
-        }
-        ++num_found;
+  std::vector<gid_type> unique_gids;
+  unique_gids.reserve(num_unique_gids);
+  for (const auto& it : gid2idx) {
+    unique_gids.push_back(it.first);
+  }
+
+  // Ask the home ranks of each gid
+  std::vector<int> unique_pids, unique_lids;
+  query_gid_directory(unique_gids,unique_pids,unique_lids);
+
+  int num_found = 0;
+  int pos = 0;
+  for (const auto& it : gid2idx) {
+    if (unique_pids[pos]>=0) {
+      for (auto idx : it.second) {
+        pids[idx] = unique_pids[pos];
+        lids[idx] = unique_lids[pos];
       }
+      ++num_found;
     }
+    ++pos;
   }
   EKAT_REQUIRE_MSG (num_found==num_unique_gids,
       "Error! Could not locate the owner of one of the input GIDs.\n"
@@ -531,6 +456,171 @@ get_remote_pids_and_lids (const gid_view_h& gids,
       "  - num unique gids in: " + std::to_string(num_unique_gids) + "\n");
 }
 
+int AbstractGrid::
+gid_home_rank (const gid_type gid, const int comm_size)
+{
+  // Mix the bits of the gid (splitmix64 finalizer), so that gids are evenly
+  // distributed across ranks regardless of any pattern in the numbering
+  std::uint64_t h = static_cast<std::uint64_t>(gid);
+  h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+  h = h ^ (h >> 31);
+  return static_cast<int>(h % static_cast<std::uint64_t>(comm_size));
+}
+
+void AbstractGrid::build_gid_directory () const
+{
+  if (m_gid_directory_built) {
+    return;
+  }
+
+  const auto& comm = get_comm();
+  const int nranks = comm.size();
+  const auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
+
+  // Sort local gids by home rank
+  auto my_gids_h = m_dofs_gids.get_view<const gid_type*,Host>();
+  std::vector<int> send_counts(nranks,0), send_offsets(nranks+1,0);
+  for (int i=0; i<m_num_local_dofs; ++i) {
+    ++send_counts[gid_home_rank(my_gids_h[i],nranks)];
+  }
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] = send_offsets[pid] + send_counts[pid];
+  }
+  std::vector<gid_type> send_gids(m_num_local_dofs);
+  std::vector<int> send_lids(m_num_local_dofs);
+  auto pos = send_offsets;
+  for (int i=0; i<m_num_local_dofs; ++i) {
+    const int p = pos[gid_home_rank(my_gids_h[i],nranks)]++;
+    send_gids[p] = my_gids_h[i];
+    send_lids[p] = i;
+  }
+
+  // Exchange counts, then (gid,lid) pairs
+  std::vector<int> recv_counts(nranks), recv_offsets(nranks+1,0);
+  MPI_Alltoall(send_counts.data(),1,MPI_INT,
+               recv_counts.data(),1,MPI_INT,comm.mpi_comm());
+  for (int pid=0; pid<nranks; ++pid) {
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+  const int num_recv = recv_offsets[nranks];
+  std::vector<gid_type> recv_gids(num_recv);
+  std::vector<int> recv_lids(num_recv);
+  MPI_Alltoallv(send_gids.data(),send_counts.data(),send_offsets.data(),mpi_gid_t,
+                recv_gids.data(),recv_counts.data(),recv_offsets.data(),mpi_gid_t,
+                comm.mpi_comm());
+  MPI_Alltoallv(send_lids.data(),send_counts.data(),send_offsets.data(),MPI_INT,
+                recv_lids.data(),recv_counts.data(),recv_offsets.data(),MPI_INT,
+                comm.mpi_comm());
+
+  // Store the portion of the directory we are home for. A duplicate GID is
+  // only detected on its home rank, so record it and fail on all ranks together
+  m_gid_directory.clear();
+  int dup_found = 0;
+  gid_type dup_gid = -1;
+  int dup_owner1 = -1, dup_owner2 = -1;
+  for (int pid=0; pid<nranks; ++pid) {
+    for (int i=recv_offsets[pid]; i<recv_offsets[pid+1]; ++i) {
+      auto it = m_gid_directory.find(recv_gids[i]);
+      if (it!=m_gid_directory.end()) {
+        if (dup_found==0) {
+          dup_found = 1;
+          dup_gid = recv_gids[i];
+          dup_owner1 = it->second.first;
+          dup_owner2 = pid;
+        }
+        continue;
+      }
+      m_gid_directory.emplace(recv_gids[i],std::make_pair(pid,recv_lids[i]));
+    }
+  }
+
+  int any_dup_found;
+  comm.all_reduce(&dup_found,&any_dup_found,1,MPI_MAX);
+  EKAT_REQUIRE_MSG (any_dup_found==0,
+      "Error! Found a GID with multiple owners.\n"
+      "  - grid name: " + this->name() + "\n" +
+      (dup_found==1 ?
+        "  - gid: " + std::to_string(dup_gid) + "\n"
+        "  - owner 1: " + std::to_string(dup_owner1) + "\n"
+        "  - owner 2: " + std::to_string(dup_owner2) + "\n" :
+        "  - the duplicate was found on another rank\n"));
+
+  m_gid_directory_built = true;
+}
+
+void AbstractGrid::
+query_gid_directory (const std::vector<gid_type>& gids,
+                     std::vector<int>& pids,
+                     std::vector<int>& lids) const
+{
+  build_gid_directory();
+
+  const auto& comm = get_comm();
+  const int nranks = comm.size();
+  const int num_gids = gids.size();
+  const auto mpi_gid_t = ekat::get_mpi_type<gid_type>();
+
+  // Sort queried gids by home rank, keeping track of where each one came from
+  std::vector<int> send_counts(nranks,0), send_offsets(nranks+1,0);
+  for (int i=0; i<num_gids; ++i) {
+    ++send_counts[gid_home_rank(gids[i],nranks)];
+  }
+  for (int pid=0; pid<nranks; ++pid) {
+    send_offsets[pid+1] = send_offsets[pid] + send_counts[pid];
+  }
+  std::vector<gid_type> send_gids(num_gids);
+  std::vector<int> send_pos(num_gids);
+  auto pos = send_offsets;
+  for (int i=0; i<num_gids; ++i) {
+    const int p = pos[gid_home_rank(gids[i],nranks)]++;
+    send_gids[p] = gids[i];
+    send_pos[p] = i;
+  }
+
+  // Round 1: send queries to home ranks
+  std::vector<int> recv_counts(nranks), recv_offsets(nranks+1,0);
+  MPI_Alltoall(send_counts.data(),1,MPI_INT,
+               recv_counts.data(),1,MPI_INT,comm.mpi_comm());
+  for (int pid=0; pid<nranks; ++pid) {
+    recv_offsets[pid+1] = recv_offsets[pid] + recv_counts[pid];
+  }
+  const int num_recv = recv_offsets[nranks];
+  std::vector<gid_type> recv_gids(num_recv);
+  MPI_Alltoallv(send_gids.data(),send_counts.data(),send_offsets.data(),mpi_gid_t,
+                recv_gids.data(),recv_counts.data(),recv_offsets.data(),mpi_gid_t,
+                comm.mpi_comm());
+
+  // Look up (pid,lid) of each query. Gids not in the directory get (-1,-1)
+  std::vector<int> answers(2*num_recv,-1);
+  for (int i=0; i<num_recv; ++i) {
+    auto it = m_gid_directory.find(recv_gids[i]);
+    if (it!=m_gid_directory.end()) {
+      answers[2*i]   = it->second.first;
+      answers[2*i+1] = it->second.second;
+    }
+  }
+
+  // Round 2: send answers back (in the same order as the queries)
+  for (int pid=0; pid<nranks; ++pid) {
+    send_counts[pid] *= 2;
+    send_offsets[pid] *= 2;
+    recv_counts[pid] *= 2;
+    recv_offsets[pid] *= 2;
+  }
+  std::vector<int> results(2*num_gids);
+  MPI_Alltoallv(answers.data(),recv_counts.data(),recv_offsets.data(),MPI_INT,
+                results.data(),send_counts.data(),send_offsets.data(),MPI_INT,
+                comm.mpi_comm());
+
+  pids.resize(num_gids);
+  lids.resize(num_gids);
+  for (int p=0; p<num_gids; ++p) {
+    pids[send_pos[p]] = results[2*p];
+    lids[send_pos[p]] = results[2*p+1];
+  }
+}
+
 void AbstractGrid::create_dof_fields (const int scalar2d_layout_rank)
 {
   using namespace ShortFieldTagsNames;
@@ -587,6 +677,8 @@ void AbstractGrid::copy_data (const AbstractGrid& src, const bool shallow)
   m_global_min_dof_gid = src.m_global_min_dof_gid;
   m_is_unique = src.m_is_unique;
   m_is_unique_computed = src.m_is_unique_computed;
+  m_gid_directory = src.m_gid_directory;
+  m_gid_directory_built = src.m_gid_directory_built;
 }
 
 } // namespace scream
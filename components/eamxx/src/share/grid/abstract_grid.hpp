@@ -172,6 +172,9 @@ public:
   std::vector<gid_type> get_unique_gids () const;
 
   // For each entry in the input list of GIDs, retrieve the process id that owns it
+  // NOTE: this method, as well as get_remote_pids_and_lids, is collective, and relies
+  //       on a distributed directory of the grid dofs, built at the first call. Hence,
+  //       the dofs gids must not be changed after either of these methods is called.
   std::vector<int> get_owners (const gid_view_h& gids) const;
   std::vector<int> get_owners (const std::vector<gid_type>& gids) const {
     gid_view_h gids_v(gids.data(),gids.size());
@@ -215,6 +218,16 @@ protected:
   //       since it calls get_2d_scalar_layout.
   void create_dof_fields (const int scalar2d_layout_rank);
 
+  // Distributed directory of dofs gids: each gid is assigned a "home" rank (via a hash
+  // of the gid), which stores the (pid,lid) of the gid owner. Querying the owner of a
+  // list of gids requires one all-to-all exchange with the home ranks, rather than
+  // looping over all ranks in the comm.
+  void build_gid_directory () const;
+  void query_gid_directory (const std::vector<gid_type>& gids,
+                            std::vector<int>& pids,
+                            std::vector<int>& lids) const;
+  static int gid_home_rank (const gid_type gid, const int comm_size);
+
   // The grid name and type
   GridType     m_type;
   std::string  m_name;
@@ -247,6 +260,11 @@ protected:
   mutable bool m_is_unique;
   mutable bool m_is_unique_computed = false;
 
+  // The portion of the gids directory stored on this rank: gid->(owner pid, owner lid).
+  // Lazy init at the first call of get_owners/get_remote_pids_and_lids.
+  mutable std::map<gid_type,std::pair<int,int>> m_gid_directory;
+  mutable bool m_gid_directory_built = false;
+
   // The map lid->idx
   Field     m_lid_to_idx;
 
@@ -0,0 +1,33 @@
+#ifndef SCREAM_SINGLE_GRID_GRIDS_MANAGER_HPP
+#define SCREAM_SINGLE_GRID_GRIDS_MANAGER_HPP
+
+#include "share/grid/grids_manager.hpp"
+
+namespace scream {
+
+// Small grids manager class, to hold a pre-built grid
+// We will use this to build a GM on the fly from a single grid
+class SingleGridGM : public GridsManager
+{
+public:
+  SingleGridGM (const std::shared_ptr<AbstractGrid>& grid)
+  {
+    add_grid(grid);
+  }
+
+  std::string name () const override { return "SingleGridGM"; }
+
+  void build_grids () override {}
+
+protected:
+  remapper_ptr_type
+  do_create_remapper (const grid_ptr_type /* from_grid */,
+                      const grid_ptr_type /* to_grid */) const override
+  {
+    EKAT_ERROR_MSG ("Error! do_create_remapper not implemented for SingleGridGM.\n");
+  }
+};
+
+} // namespace scream
+
+#endif // SCREAM_SINGLE_GRID_GRIDS_MANAGER_HPP
@@ -152,7 +152,6 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr)
   for (auto const& name : m_fields_names) {
     auto f = m_field_mgr->get_field(name);
     const auto& fh  = f.get_header();
-    const auto& fap = fh.get_alloc_properties();
     const auto& fid = fh.get_identifier();
     const auto& fl  = fid.get_layout();
 
@@ -161,8 +160,7 @@ set_field_manager (const std::shared_ptr<const fm_type>& field_mgr)
 
     // If we can alias the field's host view, do it.
     // Otherwise, create a temporary.
-    bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
-    if (can_alias_field_view) {
+    if (can_alias_field_view(f)) {
       auto data = f.get_internal_view_data<Real,Host>();
       m_host_views_1d[name] = view_1d_host(data,fl.size());
     } else {
@@ -203,134 +201,196 @@ set_grid (const std::shared_ptr<const AbstractGrid>& grid)
 //       provided the routine will read input at the last time level set by
 //       running eam_update_timesnap.
 void AtmosphereInput::read_variables (const int time_index)
+{
+  std::vector<ReadRequest> requests;
+  requests.reserve(m_fields_names.size());
+  for (auto const& name : m_fields_names) {
+    requests.push_back(ReadRequest{name,time_index,Field()});
+  }
+  read_variables(requests);
+}
+
+void AtmosphereInput::read_variables (const std::vector<ReadRequest>& requests)
 {
   auto func_start = std::chrono::steady_clock::now();
   if (m_atm_logger) {
+    std::vector<std::string> entries;
+    for (const auto& r : requests) {
+      entries.push_back(r.time_index==-1 ? r.name : r.name + "@" + std::to_string(r.time_index));
+    }
     m_atm_logger->info("[EAMxx::scorpio_input] Reading variables from file");
     m_atm_logger->info("  file name: " + m_filename);
-    m_atm_logger->info("  var names: " + ekat::join(m_fields_names,", "));
-    if (time_index!=-1) {
-      m_atm_logger->info("  time idx : " + std::to_string(time_index));
-    }
+    m_atm_logger->info("  var names: " + ekat::join(entries,", "));
   }
   EKAT_REQUIRE_MSG (m_inited_with_views || m_inited_with_fields,
       "Error! Scorpio structures not inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
+  // Check the requests, and size the staging buffer for the fields that cannot be aliased
+  long long staging_size = 0;
+  for (const auto& r : requests) {
+    EKAT_REQUIRE_MSG (m_layouts.count(r.name)==1,
+        "Error! Requested variable was not set up for reading in this input stream.\n"
+        " - filename: " + m_filename + "\n"
+        " - varname : " + r.name + "\n");
+    if (r.dst.is_allocated()) {
+      const auto& fl = r.dst.get_header().get_identifier().get_layout();
+      EKAT_REQUIRE_MSG (fl==m_layouts.at(r.name),
+          "Error! Layout mismatch between input variable and destination field.\n"
+          " - filename   : " + m_filename + "\n"
+          " - varname    : " + r.name + "\n"
+          " - var layout : " + m_layouts.at(r.name).to_string() + "\n"
+          " - dst layout : " + fl.to_string() + "\n");
+      EKAT_REQUIRE_MSG (r.dst.data_type()==get_data_type<Real>(),
+          "Error! Destination field must have Real data type.\n"
+          " - varname : " + r.name + "\n"
+          " - field   : " + r.dst.name() + "\n");
+      if (not can_alias_field_view(r.dst)) {
+        staging_size = std::max(staging_size,fl.size());
+      }
+    }
+  }
+  if (static_cast<long long>(m_staging.size())<staging_size) {
+    m_staging = view_1d_host("",staging_size);
+  }
 
-    // Read the data
-    auto v1d = m_host_views_1d.at(name);
-    scorpio::read_var(m_filename,name,v1d.data(),time_index);
-
-    // If we have a field manager, make sure the data is correctly
-    // synced to both host and device views of the field.
-    if (m_field_mgr) {
-
-      auto f = m_field_mgr->get_field(name);
-      const auto& fh  = f.get_header();
-      const auto& fl  = fh.get_identifier().get_layout();
-      const auto& fap = fh.get_alloc_properties();
-
-      // Check if the stored 1d view is sharing the data ptr with the field
-      const bool can_alias_field_view = fh.get_parent().expired() && fap.get_padding()==0;
-
-      // If the 1d view is a simple reshape of the field's Host view data,
-      // then we're already done. Otherwise, we need to manually copy.
-      if (not can_alias_field_view) {
-        // Get the host view of the field properly reshaped, and deep copy
-        // from temp_view (properly reshaped as well).
-        auto rank = fl.rank();
-        auto view_1d = m_host_views_1d.at(name);
-        switch (rank) {
-          case 1:
-            {
-              // No reshape needed, simply copy
-              auto dst = f.get_view<Real*,Host>();
-              for (int i=0; i<fl.dim(0); ++i) {
-                dst(i) = view_1d(i);
-              }
-              break;
-            }
-          case 2:
-            {
-              // Reshape temp_view to a 2d view, then copy
-              auto dst = f.get_view<Real**,Host>();
-              auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  dst(i,j) = src(i,j);
-              }}
-              break;
-            }
-          case 3:
-            {
-              // Reshape temp_view to a 3d view, then copy
-              auto dst = f.get_view<Real***,Host>();
-              auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    dst(i,j,k) = src(i,j,k);
-              }}}
-              break;
-            }
-          case 4:
-            {
-              // Reshape temp_view to a 4d view, then copy
-              auto dst = f.get_view<Real****,Host>();
-              auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      dst(i,j,k,l) = src(i,j,k,l);
-              }}}}
-              break;
-            }
-          case 5:
-            {
-              // Reshape temp_view to a 5d view, then copy
-              auto dst = f.get_view<Real*****,Host>();
-              auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        dst(i,j,k,l,m) = src(i,j,k,l,m);
-              }}}}}
-              break;
-            }
-          case 6:
-            {
-              // Reshape temp_view to a 6d view, then copy
-              auto dst = f.get_view<Real******,Host>();
-              auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
-              for (int i=0; i<fl.dim(0); ++i) {
-                for (int j=0; j<fl.dim(1); ++j) {
-                  for (int k=0; k<fl.dim(2); ++k) {
-                    for (int l=0; l<fl.dim(3); ++l) {
-                      for (int m=0; m<fl.dim(4); ++m) {
-                        for (int n=0; n<fl.dim(5); ++n) {
-                          dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
-              }}}}}}
-              break;
-            }
-          default:
-            EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
+  // Read all the data, and collect the fields that need to be synced to device
+  std::vector<Field> to_sync;
+  for (const auto& r : requests) {
+    if (r.dst.is_allocated()) {
+      const auto size = r.dst.get_header().get_identifier().get_layout().size();
+      if (can_alias_field_view(r.dst)) {
+        scorpio::read_var(m_filename,r.name,r.dst.get_internal_view_data<Real,Host>(),r.time_index);
+      } else {
+        auto staged = view_1d_host(m_staging.data(),size);
+        scorpio::read_var(m_filename,r.name,staged.data(),r.time_index);
+        copy_to_field_host(staged,r.dst);
+      }
+      to_sync.push_back(r.dst);
+    } else {
+      // Read the data
+      auto v1d = m_host_views_1d.at(r.name);
+      scorpio::read_var(m_filename,r.name,v1d.data(),r.time_index);
+
+      // If we have a field manager, make sure the data is correctly
+      // synced to both host and device views of the field.
+      if (m_field_mgr) {
+        auto f = m_field_mgr->get_field(r.name);
+
+        // If the 1d view is a simple reshape of the field's Host view data,
+        // then we're already done. Otherwise, we need to manually copy.
+        if (not can_alias_field_view(f)) {
+          copy_to_field_host(v1d,f);
         }
+        to_sync.push_back(f);
       }
-
-      // Sync to device
-      f.sync_to_dev();
     }
   }
+
+  // Sync to device
+  for (const auto& f : to_sync) {
+    f.sync_to_dev();
+  }
+
   auto func_finish = std::chrono::steady_clock::now();
   if (m_atm_logger) {
     auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start)/1000.0;
     m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration.count()) +" seconds");
   }
-} 
+}
+
+/* ---------------------------------------------------------- */
+bool AtmosphereInput::can_alias_field_view (const Field& f)
+{
+  const auto& fh = f.get_header();
+  return fh.get_parent().expired() && fh.get_alloc_properties().get_padding()==0;
+}
+
+/* ---------------------------------------------------------- */
+void AtmosphereInput::copy_to_field_host (const view_1d_host& view_1d, const Field& f)
+{
+  // Get the host view of the field properly reshaped, and deep copy
+  // from view_1d (properly reshaped as well).
+  const auto& fl = f.get_header().get_identifier().get_layout();
+  auto rank = fl.rank();
+  switch (rank) {
+    case 1:
+      {
+        // No reshape needed, simply copy
+        auto dst = f.get_view<Real*,Host>();
+        for (int i=0; i<fl.dim(0); ++i) {
+          dst(i) = view_1d(i);
+        }
+        break;
+      }
+    case 2:
+      {
+        // Reshape temp_view to a 2d view, then copy
+        auto dst = f.get_view<Real**,Host>();
+        auto src = view_Nd_host<2>(view_1d.data(),fl.dim(0),fl.dim(1));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            dst(i,j) = src(i,j);
+        }}
+        break;
+      }
+    case 3:
+      {
+        // Reshape temp_view to a 3d view, then copy
+        auto dst = f.get_view<Real***,Host>();
+        auto src = view_Nd_host<3>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              dst(i,j,k) = src(i,j,k);
+        }}}
+        break;
+      }
+    case 4:
+      {
+        // Reshape temp_view to a 4d view, then copy
+        auto dst = f.get_view<Real****,Host>();
+        auto src = view_Nd_host<4>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                dst(i,j,k,l) = src(i,j,k,l);
+        }}}}
+        break;
+      }
+    case 5:
+      {
+        // Reshape temp_view to a 5d view, then copy
+        auto dst = f.get_view<Real*****,Host>();
+        auto src = view_Nd_host<5>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  dst(i,j,k,l,m) = src(i,j,k,l,m);
+        }}}}}
+        break;
+      }
+    case 6:
+      {
+        // Reshape temp_view to a 6d view, then copy
+        auto dst = f.get_view<Real******,Host>();
+        auto src = view_Nd_host<6>(view_1d.data(),fl.dim(0),fl.dim(1),fl.dim(2),fl.dim(3),fl.dim(4),fl.dim(5));
+        for (int i=0; i<fl.dim(0); ++i) {
+          for (int j=0; j<fl.dim(1); ++j) {
+            for (int k=0; k<fl.dim(2); ++k) {
+              for (int l=0; l<fl.dim(3); ++l) {
+                for (int m=0; m<fl.dim(4); ++m) {
+                  for (int n=0; n<fl.dim(5); ++n) {
+                    dst(i,j,k,l,m,n) = src(i,j,k,l,m,n);
+        }}}}}}
+        break;
+      }
+    default:
+      EKAT_ERROR_MSG ("Error! Unexpected field rank (" + std::to_string(rank) + ").\n");
+  }
+}
 
 /* ---------------------------------------------------------- */
 void AtmosphereInput::finalize() 
@@ -342,6 +402,7 @@ void AtmosphereInput::finalize()
 
   m_host_views_1d.clear();
   m_layouts.clear();
+  m_staging = view_1d_host();
 
   m_inited_with_views = false;
   m_inited_with_fields = false;
@@ -104,9 +104,25 @@ public:
              const std::map<std::string,view_1d_host>& host_views_1d,
              const std::map<std::string,FieldLayout>&  layouts);
 
+  // A variable to read, at a given time slice, and the field to read it into.
+  // If dst is not allocated, the var is read into the field/view that was
+  // passed at init time.
+  struct ReadRequest {
+    std::string name;
+    int         time_index = -1;
+    Field       dst;
+  };
+
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // Read several (var,time slice) pairs in one pass (e.g., two months of data).
+  // The reads are issued back to back. Fields that are contiguous (no padding,
+  // not a subfield) are read directly into their host view (which is the device
+  // view on host-only builds), while the others are staged through one buffer,
+  // shared by all requests. Each field is synced to device once, after all reads.
+  void read_variables (const std::vector<ReadRequest>& requests);
+
   // Cleans up the class
   void finalize();
 
@@ -132,6 +148,12 @@ protected:
 
   std::vector<std::string> get_vec_of_dims (const FieldLayout& layout);
 
+  // Whether the host view of f can be used as a flat 1d buffer for reading
+  static bool can_alias_field_view (const Field& f);
+
+  // Copy a flattened 1d host view into the (possibly padded/strided) host view of f
+  static void copy_to_field_host (const view_1d_host& src, const Field& f);
+
   // Internal variables
   ekat::ParameterList   m_params;
 
@@ -140,6 +162,9 @@ protected:
 
   std::map<std::string, view_1d_host>   m_host_views_1d;
   std::map<std::string, FieldLayout>    m_layouts;
+
+  // Staging buffer for batched reads into fields that cannot be aliased
+  view_1d_host                          m_staging;
   
   std::string               m_filename;
   std::vector<std::string>  m_fields_names;
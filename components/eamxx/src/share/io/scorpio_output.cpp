@@ -113,8 +113,10 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::shared_ptr<const gm_type>& grids_mgr)
+                  const std::shared_ptr<const gm_type>& grids_mgr,
+                  const std::shared_ptr<DiagnosticCache>& diag_cache)
  : m_comm         (comm)
+ , m_diag_cache   (diag_cache)
  , m_add_time_dim (true)
 {
   using vos_t = std::vector<std::string>;
@@ -1215,12 +1217,20 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
   }
 
   m_diag_computed[name] = true;
+  if (m_diag_cache and m_diag_cache->is_up_to_date(diag)) {
+    // Another output stream already computed this diag from the current inputs
+    return;
+  }
+
   if (allow_invalid_fields) {
     // If any input is invalid, fill the diagnostic with invalid data
     for (auto f : diag->get_fields_in()) {
       if (not f.get_header().get_tracking().get_time_stamp().is_valid()) {
         // Fill diag with invalid data and return
         diag->get_diagnostic().deep_copy(m_fill_value);
+        if (m_diag_cache) {
+          m_diag_cache->invalidate(diag);
+        }
         return;
       }
     }
@@ -1228,6 +1238,9 @@ compute_diagnostic(const std::string& name, const bool allow_invalid_fields)
 
   // Either allow_invalid_fields=false, or all inputs are valid. Proceed.
   diag->compute_diagnostic();
+  if (m_diag_cache) {
+    m_diag_cache->mark_computed(diag);
+  }
 
   // The diag may have failed to compute (e.g., t=0 output with a flux-like diag).
   // If we're allowing invalid fields, then we should simply set diag=m_fill_value
@@ -1294,7 +1307,9 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     //  - ${field_name}_at_model_bot
     //  - ${field_name}_at_model_top
     //  - ${field_name}_at_${M}X
-    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m
+    //  - ${field_name}_at_plev${K}
+    // where M/N are numbers (N integer), X=Pa, hPa, mb, or m, and plev${K} is one
+    // of the predefined sets of pressure levels (e.g., plev19)
     auto tokens = ekat::split(diag_field_name,"_at_");
     EKAT_REQUIRE_MSG (tokens.size()==2,
         "Error! Unexpected diagnostic name: " + diag_field_name + "\n");
@@ -1310,6 +1325,7 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     // FieldAtLevel        : var_at_lev_N, var_at_model_top, var_at_model_bot
     // FieldAtPressureLevel: var_at_Nx, with x=mb,Pa,hPa
     // FieldAtHeight       : var_at_Nm_above_Y (Y=sealevel or surface)
+    // FieldAtVerticalLevels: var_at_plevK (K=3,4,8,19)
     if (tokens[1].find_first_of("0123456789.")==0) {
       auto units_start = tokens[1].find_first_not_of("0123456789.");
       auto units = tokens[1].substr(units_start);
@@ -1344,6 +1360,15 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
       } else {
         EKAT_ERROR_MSG ("Error! Invalid units x for 'field_at_Nx' diagnostic.\n");
       }
+    } else if (tokens[1].rfind("plev",0)==0 and tokens[1].size()>4 and
+               tokens[1].find_first_not_of("0123456789",4)==std::string::npos) {
+      // The diag will check that this is a valid set of levels
+      diag_name = "FieldAtVerticalLevels";
+      params.set("vertical_levels", tokens[1]);
+      diag_avg_cnt_name = "_" + tokens[1]; // Set avg_cnt tracking for this specific set of levels
+      // Some levels may be masked, so we need to be tracking the average count,
+      // if m_avg_type is not Instant
+      m_track_avg_cnt = m_track_avg_cnt || m_avg_type!=OutputAvgType::Instant;
     } else {
       diag_name = "FieldAtLevel";
     }
@@ -1399,15 +1424,24 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
     params.set<std::string>("diag_name", diag_name);
   }
 
-  // Create the diagnostic
-  auto diag = diag_factory.create(diag_name,m_comm,params);
-  diag->set_grids(m_grids_manager);
+  // Create the diagnostic, unless an identical one was already created by another stream
+  const auto sim_field_mgr = get_field_manager("sim");
+  std::string cache_key;
+  std::shared_ptr<AtmosphereDiagnostic> diag;
+  if (m_diag_cache) {
+    cache_key = DiagnosticCache::make_key(diag_name,sim_field_mgr->get_grid()->name(),params);
+    diag = m_diag_cache->get(cache_key);
+  }
+  const bool from_cache = diag!=nullptr;
+  if (not from_cache) {
+    diag = diag_factory.create(diag_name,m_comm,params);
+    diag->set_grids(m_grids_manager);
+  }
 
   // Ensure there's an entry in the map for this diag, so .at(diag_name) always works
   auto& deps = m_diag_depends_on_diags[diag->name()];
 
   // Initialize the diagnostic
-  const auto sim_field_mgr = get_field_manager("sim");
   for (const auto& freq : diag->get_required_field_requests()) {
     const auto& fname = freq.fid.name();
     if (!sim_field_mgr->has_field(fname)) {
@@ -1418,9 +1452,16 @@ AtmosphereOutput::create_diagnostic (const std::string& diag_field_name) {
       auto dep = m_diagnostics.at(fname);
       deps.push_back(fname);
     }
-    diag->set_required_field (get_field(fname,"sim"));
+    if (not from_cache) {
+      diag->set_required_field (get_field(fname,"sim"));
+    }
+  }
+  if (not from_cache) {
+    diag->initialize(util::TimeStamp(),RunType::Initial);
+    if (m_diag_cache) {
+      m_diag_cache->add(cache_key,diag);
+    }
   }
-  diag->initialize(util::TimeStamp(),RunType::Initial);
   // If specified, set avg_cnt tracking for this diagnostic.
   if (m_track_avg_cnt) {
     const auto diag_field = diag->get_diagnostic();
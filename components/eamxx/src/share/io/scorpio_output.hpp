@@ -3,6 +3,7 @@
 
 #include "share/io/scream_scorpio_interface.hpp"
 #include "share/io/scream_io_utils.hpp"
+#include "share/io/scream_diagnostic_cache.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
@@ -124,9 +125,12 @@ public:
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
+  // If diag_cache is not null, diagnostics are retrieved from (and added to) the cache,
+  // and are not recomputed if another stream already computed them from the same inputs.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::shared_ptr<const gm_type>& grids_mgr);
+                   const std::shared_ptr<const gm_type>& grids_mgr,
+                   const std::shared_ptr<DiagnosticCache>& diag_cache = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -206,6 +210,7 @@ protected:
   std::map<std::string,std::shared_ptr<atm_diag_type>>  m_diagnostics;
   std::map<std::string,std::vector<std::string>>        m_diag_depends_on_diags;
   std::map<std::string,bool>                            m_diag_computed;
+  std::shared_ptr<DiagnosticCache>                      m_diag_cache;
   LongNames                                             m_longnames;
 
   // Use float, so that if output fp_precision=float, this is a representable value.
@@ -0,0 +1,82 @@
+#include "share/io/scream_diagnostic_cache.hpp"
+
+#include <sstream>
+
+namespace scream
+{
+
+std::string DiagnosticCache::
+make_key (const std::string& diag_name,
+          const std::string& grid_name,
+          const ekat::ParameterList& params)
+{
+  std::stringstream ss;
+  ss << diag_name << "@" << grid_name << "\n";
+  params.print(ss);
+  return ss.str();
+}
+
+DiagnosticCache::diag_ptr_type
+DiagnosticCache::get (const std::string& key) const
+{
+  auto it = m_diags.find(key);
+  return it==m_diags.end() ? nullptr : it->second;
+}
+
+void DiagnosticCache::
+add (const std::string& key, const diag_ptr_type& diag)
+{
+  EKAT_REQUIRE_MSG (diag!=nullptr,
+      "Error! Cannot add a null diagnostic to the diagnostic cache.\n");
+  EKAT_REQUIRE_MSG (m_diags.count(key)==0,
+      "Error! A diagnostic with the same key was already added to the cache.\n"
+      "  - diag name: " + diag->name() + "\n");
+  m_diags[key] = diag;
+}
+
+bool DiagnosticCache::
+is_up_to_date (const diag_ptr_type& diag) const
+{
+  auto it = m_computed_at.find(diag.get());
+  if (it==m_computed_at.end()) {
+    return false;
+  }
+
+  // The diag may have refused to compute (see AtmosphereDiagnostic::compute_diagnostic)
+  const auto& diag_ts = diag->get_diagnostic().get_header().get_tracking().get_time_stamp();
+  if (not diag_ts.is_valid()) {
+    return false;
+  }
+
+  const auto ts = inputs_time_stamp(diag);
+  return ts.is_valid() and ts==it->second;
+}
+
+void DiagnosticCache::
+mark_computed (const diag_ptr_type& diag)
+{
+  m_computed_at[diag.get()] = inputs_time_stamp(diag);
+}
+
+void DiagnosticCache::
+invalidate (const diag_ptr_type& diag)
+{
+  m_computed_at.erase(diag.get());
+}
+
+util::TimeStamp DiagnosticCache::
+inputs_time_stamp (const diag_ptr_type& diag)
+{
+  // Same logic used by AtmosphereDiagnostic to time stamp its output:
+  // the most recent time stamp among the inputs.
+  util::TimeStamp ts;
+  for (const auto& f : diag->get_fields_in()) {
+    const auto& fts = f.get_header().get_tracking().get_time_stamp();
+    if (not ts.is_valid() || ts<fts) {
+      ts = fts;
+    }
+  }
+  return ts;
+}
+
+} // namespace scream
@@ -0,0 +1,73 @@
+#ifndef SCREAM_DIAGNOSTIC_CACHE_HPP
+#define SCREAM_DIAGNOSTIC_CACHE_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/util/scream_time_stamp.hpp"
+
+#include "ekat/ekat_parameter_list.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+
+namespace scream
+{
+
+/*
+ * A model-wide cache of diagnostics, to be shared by all output streams.
+ *
+ * Without this class, each AtmosphereOutput builds its own instance of each
+ * diagnostic it outputs, and computes it every time it runs. If N streams
+ * request the same diagnostic (e.g., T_mid_at_500mb, or z_mid), the same
+ * quantity is stored N times and computed N times at each output step.
+ *
+ * With this class, diagnostics are identified by the diag name, the grid name,
+ * and the parameters used to create them. Streams requesting an identical
+ * diagnostic get the same instance. Before computing a diagnostic, streams can
+ * check whether it is up to date, that is, whether it was already computed
+ * from the current version of its inputs (according to the time stamps of
+ * the inputs tracking), in which case the computation can be skipped.
+ *
+ * The cache is owned by the AtmosphereDriver, and handed to all OutputManager's.
+ */
+
+class DiagnosticCache
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  // Key identifying a diagnostic request
+  static std::string make_key (const std::string& diag_name,
+                               const std::string& grid_name,
+                               const ekat::ParameterList& params);
+
+  // Returns nullptr if no diag was registered with this key
+  diag_ptr_type get (const std::string& key) const;
+
+  void add (const std::string& key, const diag_ptr_type& diag);
+
+  // Whether the diag was computed since any of its inputs was last updated
+  bool is_up_to_date (const diag_ptr_type& diag) const;
+
+  // Record that the diag was just (successfully) computed
+  void mark_computed (const diag_ptr_type& diag);
+
+  // Record that the diag content is no longer the result of its computation
+  // (e.g., a stream filled it with fill values)
+  void invalidate (const diag_ptr_type& diag);
+
+  int size () const { return m_diags.size(); }
+
+protected:
+
+  static util::TimeStamp inputs_time_stamp (const diag_ptr_type& diag);
+
+  std::map<std::string,diag_ptr_type>               m_diags;
+
+  // Time stamp of the inputs at the time the diag was last computed
+  std::map<const AtmosphereDiagnostic*,util::TimeStamp>  m_computed_at;
+};
+
+} // namespace scream
+
+#endif // SCREAM_DIAGNOSTIC_CACHE_HPP
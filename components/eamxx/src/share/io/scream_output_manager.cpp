@@ -74,7 +74,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
 
   // For each grid, create a separate output stream.
   if (field_mgrs.size()==1) {
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr);
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.begin()->second,grids_mgr,m_diag_cache);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
   } else {
@@ -107,7 +107,7 @@ setup (const ekat::Comm& io_comm, const ekat::ParameterList& params,
       EKAT_REQUIRE_MSG (field_mgrs.find(gname)!=field_mgrs.end(),
           "Error! Output requested on grid '" + gname + "', but no field manager is available for such grid.\n");
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgrs.at(gname),grids_mgr,m_diag_cache);
       output->set_logger(m_atm_logger);
       m_output_streams.push_back(output);
     }
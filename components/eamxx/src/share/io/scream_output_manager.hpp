@@ -111,6 +111,10 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // Diagnostics cache shared with other OutputManager's. Must be set before setup.
+  void set_diagnostic_cache(const std::shared_ptr<DiagnosticCache>& diag_cache) {
+      m_diag_cache = diag_cache;
+  }
   void add_global (const std::string& name, const ekat::any& global);
 
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
@@ -184,6 +188,9 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // If not null, diagnostics are shared with all other streams using the same cache
+  std::shared_ptr<DiagnosticCache> m_diag_cache;
+
   // If true, we save grid data in output file
   bool m_save_grid_data;
 };
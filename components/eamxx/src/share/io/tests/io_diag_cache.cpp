@@ -0,0 +1,264 @@
+#include <catch2/catch.hpp>
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+
+#include "share/io/scream_output_manager.hpp"
+#include "share/io/scream_diagnostic_cache.hpp"
+#include "share/io/scorpio_input.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/field/field.hpp"
+#include "share/field/field_manager.hpp"
+
+#include "share/util/scream_setup_random_test.hpp"
+#include "share/util/scream_time_stamp.hpp"
+#include "share/scream_types.hpp"
+
+#include "ekat/util/ekat_units.hpp"
+#include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <memory>
+
+namespace scream {
+
+// A diagnostic computing f+1, which counts how many times it is computed
+class CountingDiag : public AtmosphereDiagnostic
+{
+public:
+  CountingDiag (const ekat::Comm& comm, const ekat::ParameterList&params)
+    : AtmosphereDiagnostic(comm,params)
+  {
+    //Do nothing
+  }
+
+  std::string name() const override { return "CountingDiag"; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) override {
+    using namespace ekat::units;
+
+    const auto grid = gm->get_grid("Point Grid");
+    const auto& grid_name = grid->name();
+    const auto lt = grid->get_3d_scalar_layout(true);
+
+    auto units = Units::nondimensional();
+    add_field<Required>("f",lt,units,grid_name);
+
+    FieldIdentifier fid (name(), lt, units, grid_name);
+    m_diagnostic_output = Field(fid);
+    m_diagnostic_output.allocate_view();
+    m_one = m_diagnostic_output.clone("one");
+    m_one.deep_copy(1.0);
+  }
+
+  static int num_computes;
+
+protected:
+
+  void compute_diagnostic_impl () override {
+    ++num_computes;
+    m_diagnostic_output.deep_copy(get_field_in("f"));
+    m_diagnostic_output.update(m_one,1.0,1.0);
+  }
+
+  void initialize_impl (const RunType /* run_type */ ) override {}
+
+  // Clean up
+  void finalize_impl ( /* inputs */ ) override {}
+
+  Field m_one;
+};
+
+int CountingDiag::num_computes = 0;
+
+util::TimeStamp get_t0 () {
+  return util::TimeStamp({2023,2,17},{0,0,0});
+}
+
+constexpr double get_dt () {
+  return 10;
+};
+
+constexpr int get_num_steps () {
+  return 4;
+};
+
+std::shared_ptr<const GridsManager>
+get_gm (const ekat::Comm& comm)
+{
+  const int nlcols = 3;
+  const int nlevs = 4;
+  const int ngcols = nlcols*comm.size();
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,ngcols);
+  gm->build_grids();
+  return gm;
+}
+
+std::shared_ptr<FieldManager>
+get_fm (const std::shared_ptr<const AbstractGrid>& grid,
+        const util::TimeStamp& t0, const int seed,
+        const bool add_diag_field = false)
+{
+  using FID = FieldIdentifier;
+
+  // Use integers, so we can check answers without risk of non bfb diffs
+  std::mt19937_64 engine(seed);
+  auto my_pdf = [&](std::mt19937_64& engine) -> Real {
+    std::uniform_int_distribution<int> pdf (0,100);
+    Real v = pdf(engine);
+    return v;
+  };
+
+  auto fm = std::make_shared<FieldManager>(grid);
+
+  const auto units = ekat::units::Units::nondimensional();
+  const auto lt = grid->get_3d_scalar_layout(true);
+
+  Field f(FID("f",lt,units,grid->name()));
+  f.allocate_view();
+  randomize (f,engine,my_pdf);
+  f.get_header().get_tracking().update_time_stamp(t0);
+  fm->add_field(f);
+
+  if (add_diag_field) {
+    Field diag(FID("CountingDiag",lt,units,grid->name()));
+    diag.allocate_view();
+    fm->add_field(diag);
+  }
+
+  return fm;
+}
+
+ekat::ParameterList get_om_pl (const std::string& prefix, const int freq)
+{
+  ekat::ParameterList om_pl;
+  om_pl.set("MPI Ranks in Filename",true);
+  om_pl.set("filename_prefix",prefix);
+  om_pl.set("Field Names",std::vector<std::string>{"f","CountingDiag"});
+  om_pl.set("Averaging Type", std::string("INSTANT"));
+  auto& ctrl_pl = om_pl.sublist("output_control");
+  ctrl_pl.set("frequency_units",std::string("nsteps"));
+  ctrl_pl.set("Frequency",freq);
+  ctrl_pl.set("save_grid_data",false);
+  return om_pl;
+}
+
+// Two streams output the same diag, one every step and one every other step
+void write (const int seed, const ekat::Comm& comm)
+{
+  // Create grid
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Time advance parameters
+  auto t0 = get_t0();
+  auto dt = get_dt();
+
+  // Create some fields
+  auto fm = get_fm(grid,t0,seed);
+
+  // Create the output managers, sharing the diagnostics
+  auto diag_cache = std::make_shared<DiagnosticCache>();
+  CountingDiag::num_computes = 0;
+
+  OutputManager om1, om2;
+  om1.set_diagnostic_cache(diag_cache);
+  om2.set_diagnostic_cache(diag_cache);
+  om1.setup(comm,get_om_pl("io_diag_cache_1",1),fm,gm,t0,t0,false);
+  om2.setup(comm,get_om_pl("io_diag_cache_2",2),fm,gm,t0,t0,false);
+
+  // Both streams use the same diag, computed once for the t0 output
+  REQUIRE (diag_cache->size()==1);
+  REQUIRE (CountingDiag::num_computes==1);
+
+  // Run output managers
+  auto f = fm->get_field("f");
+  Field one = f.clone("one");
+  one.deep_copy(1.0);
+  for (int n=1; n<=get_num_steps(); ++n) {
+    const auto t = t0+n*dt;
+    f.get_header().get_tracking().update_time_stamp(t);
+    f.update(one,1.0,1.0);
+
+    om1.init_timestep(t-dt,dt);
+    om2.init_timestep(t-dt,dt);
+    om1.run(t);
+    om2.run(t);
+
+    // Even on the steps where both streams write, the diag is computed once
+    REQUIRE (CountingDiag::num_computes==n+1);
+  }
+
+  // Close file and cleanup
+  om1.finalize();
+  om2.finalize();
+}
+
+void read (const std::string& prefix, const int freq,
+           const int seed, const ekat::Comm& comm)
+{
+  // Time quantities
+  auto t0 = get_t0();
+
+  // Get gm
+  auto gm = get_gm (comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Get initial fields
+  auto fm0 = get_fm(grid,t0,seed);
+  auto fm  = get_fm(grid,t0,seed,true);
+
+  auto f0 = fm0->get_field("f").clone();
+  auto f  = fm->get_field("f");
+  auto d  = fm->get_field("CountingDiag");
+
+  // Create reader pl
+  ekat::ParameterList reader_pl;
+  auto filename = prefix
+    + ".INSTANT.nsteps_x" + std::to_string(freq)
+    + ".np" + std::to_string(comm.size())
+    + "." + t0.to_string()
+    + ".nc";
+  reader_pl.set("Filename",filename);
+  reader_pl.set("Field Names",std::vector<std::string>{"f","CountingDiag"});
+  AtmosphereInput reader(reader_pl,fm);
+
+  // Snapshots at t0, and at every freq steps
+  Field one = f0.clone("one");
+  one.deep_copy(1.0);
+  for (int i=0; i<=get_num_steps()/freq; ++i) {
+    reader.read_variables(i);
+
+    // Check regular field is correct
+    REQUIRE (views_are_equal(f,f0));
+
+    // Check diag field is correct
+    auto d0 = f0.clone();
+    d0.update(one,1.0,1.0);
+    REQUIRE (views_are_equal(d,d0));
+
+    // Update f0
+    f0.update(one,double(freq),1.0);
+  }
+}
+
+TEST_CASE ("io_diag_cache") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  // Make CountingDiag available via diag factory
+  auto& diag_factory = AtmosphereDiagnosticFactory::instance();
+  diag_factory.register_product("CountingDiag",&create_atmosphere_diagnostic<CountingDiag>);
+
+  auto seed = get_random_test_seed(&comm);
+
+  write(seed,comm);
+  read("io_diag_cache_1",1,seed,comm);
+  read("io_diag_cache_2",2,seed,comm);
+  scorpio::finalize_subsystem();
+}
+
+} // namespace scream
@@ -3,6 +3,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
+#include "share/atm_process/atmosphere_process_capture.hpp"
 #include "share/atm_process/atmosphere_diagnostic.hpp"
 
 #include "share/property_checks/field_lower_bound_check.hpp"
@@ -12,12 +13,17 @@
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/grid/remap/inverse_remapper.hpp"
 #include "share/util/scream_time_stamp.hpp"
+#include "share/util/scream_universal_constants.hpp"
+#include "share/util/scream_bfbhash.hpp"
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_parse_yaml_file.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/ekat_scalar_traits.hpp"
 
+#include <fstream>
+#include <random>
+
 namespace scream {
 
 ekat::ParameterList create_test_params ()
@@ -334,6 +340,33 @@ protected:
   }
 };
 
+// Hashes the state of a few fields with different layouts, including a padded
+// one and one spanning several hash chunks
+class Fingerprint : public DummyProcess
+{
+public:
+  Fingerprint (const ekat::Comm& comm,const ekat::ParameterList& params)
+   : DummyProcess(comm,params)
+  {
+    // Nothing to do here
+  }
+
+  // The type of the atm proc
+  AtmosphereProcessType type () const { return AtmosphereProcessType::Physics; }
+
+  void set_grids (const std::shared_ptr<const GridsManager> gm) {
+    using namespace ekat::units;
+    using namespace ShortFieldTagsNames;
+
+    const auto grid = gm->get_grid(m_grid_name);
+    const int ncols = grid->get_num_local_dofs();
+
+    add_field<Updated>("Field A",grid->get_2d_scalar_layout(),K,m_grid_name);
+    add_field<Updated>("Field B",grid->get_3d_scalar_layout(true),K,m_grid_name,16);
+    add_field<Updated>("Field C",FieldLayout({COL,CMP,LEV},{ncols,3,2000}),K,m_grid_name);
+  }
+};
+
 // ================================ TESTS ============================== //
 
 TEST_CASE("process_factory", "") {
@@ -659,4 +692,309 @@ TEST_CASE ("diagnostics") {
   }
 }
 
+TEST_CASE ("state_capture") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0},0);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+  auto grid = gm->get_grid("Point Grid");
+
+  // Capture 4 columns at the first step
+  const int ncap = 4;
+  const std::string file_name = "atm_proc_state_capture_np" + std::to_string(comm.size()) + ".bin";
+  ekat::ParameterList params("AddOne");
+  params.set<std::string>("Grid Name", "Point Grid");
+  params.set<std::string>("state_capture_file", file_name);
+  params.set<int>("state_capture_step", 0);
+  params.set<int>("state_capture_ncols", ncap);
+
+  auto ap = std::make_shared<AddOne>(comm,params);
+  ap->set_grids(gm);
+  ap->set_state_capture_grids(gm);
+
+  // Set the field equal to the dofs gids, which are the global column indices
+  const auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+  for(const auto& req : ap->get_required_field_requests()) {
+    Field f(req.fid);
+    f.allocate_view();
+    auto v = f.get_view<Real*,Host>();
+    for (int i=0; i<v.extent_int(0); ++i) {
+      v(i) = gids(i);
+    }
+    f.sync_to_dev();
+    f.get_header().get_tracking().update_time_stamp(t0);
+    ap->set_required_field(f.get_const());
+    ap->set_computed_field(f);
+  }
+
+  ap->initialize(t0,RunType::Initial);
+  ap->run(5);
+  comm.barrier();
+
+  // The capture contains the state at the beginning of the step, on
+  // columns evenly spread across the global grid
+  const auto sc = read_state_capture(file_name);
+  const int stride = grid->get_num_global_dofs() / ncap;
+  REQUIRE (sc.proc_name==ap->name());
+  REQUIRE (sc.grid_name==grid->name());
+  REQUIRE (sc.ncols==ncap);
+  REQUIRE (sc.nlevs==grid->get_num_vertical_levels());
+  REQUIRE (sc.t0==t0);
+  REQUIRE (sc.dt==5);
+
+  REQUIRE (sc.fields.size()==1);
+  const auto& e = sc.fields.front();
+  REQUIRE (e.name=="Field A");
+  REQUIRE (e.layout.dims()==std::vector<int>{ncap});
+  for (int i=0; i<ncap; ++i) {
+    REQUIRE (e.data[i]==i*stride);
+  }
+
+  // The grid geometry data is captured too
+  REQUIRE (sc.geometry.size()==grid->get_geometry_data_names().size());
+}
+
+TEST_CASE ("lightweight_tendencies") {
+  using namespace scream;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0});
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  const Real fill_val = constants::DefaultFillValue<Real>().value;
+
+  // Create two atm procs computing the tendency of Field A, one of
+  // them storing the start-of-step state in single precision
+  using strvec_t = std::vector<std::string>;
+  ekat::ParameterList params("AddOne");
+  params.set<std::string>("Grid Name", "Point Grid");
+  params.set<strvec_t>("compute_tendencies",{"Field A"});
+  ekat::ParameterList params_lw = params;
+  params_lw.set("lightweight_tendencies",true);
+
+  auto ap    = std::make_shared<AddOne>(comm,params);
+  auto ap_lw = std::make_shared<AddOne>(comm,params_lw);
+
+  // Random values for Field A, with some fill values in both the field
+  // and the tendency, which must stay filled
+  std::mt19937_64 engine(1234+comm.rank());
+  std::uniform_real_distribution<Real> pdf(200,300);
+  auto setup = [&](const std::shared_ptr<AddOne>& proc) {
+    std::mt19937_64 eng = engine;
+    proc->set_grids(gm);
+    proc->setup_tendencies_requests();
+    Field f;
+    for(const auto& req : proc->get_required_field_requests()) {
+      f = Field(req.fid);
+      f.allocate_view();
+      auto v = f.get_view<Real*,Host>();
+      for (int i=0; i<v.extent_int(0); ++i) {
+        v(i) = i%5==1 ? fill_val : pdf(eng);
+      }
+      f.sync_to_dev();
+      f.get_header().get_tracking().update_time_stamp(t0);
+      proc->set_required_field(f.get_const());
+      proc->set_computed_field(f);
+    }
+    Field tend;
+    for(const auto& req : proc->get_computed_field_requests()) {
+      if (req.fid.name()==f.name()) {
+        continue;
+      }
+      tend = Field(req.fid);
+      tend.allocate_view();
+      auto v = tend.get_view<Real*,Host>();
+      for (int i=0; i<v.extent_int(0); ++i) {
+        v(i) = i%5==3 ? fill_val : 0;
+      }
+      tend.sync_to_dev();
+      tend.get_header().get_tracking().update_time_stamp(t0);
+      proc->set_computed_field(tend);
+    }
+    proc->initialize(t0,RunType::Initial);
+    return tend;
+  };
+  auto tend    = setup(ap);
+  auto tend_lw = setup(ap_lw);
+  REQUIRE (tend.name()=="AddOne_Field A_tend");
+
+  // Accumulate the tendency over a few steps
+  for (int n=0; n<3; ++n) {
+    ap->run(1);
+    ap_lw->run(1);
+  }
+
+  tend.sync_to_host();
+  tend_lw.sync_to_host();
+  auto v    = tend.get_view<const Real*,Host>();
+  auto v_lw = tend_lw.get_view<const Real*,Host>();
+  REQUIRE (v.size()==v_lw.size());
+  // The field is O(300), so the single precision snapshot is off by
+  // about 300*eps(float) at each step
+  const Real tol = 3*300*std::numeric_limits<float>::epsilon();
+  for (size_t i=0; i<v.size(); ++i) {
+    if (i%5==1 || i%5==3) {
+      REQUIRE (v(i)==fill_val);
+      REQUIRE (v_lw(i)==fill_val);
+    } else {
+      REQUIRE (v(i)==Approx(3).margin(tol));
+      REQUIRE (v_lw(i)==Approx(v(i)).margin(tol));
+    }
+  }
+}
+
+TEST_CASE ("state_fingerprint") {
+  using namespace scream;
+  using bfbhash::HashType;
+
+  // A world comm
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A time stamp
+  util::TimeStamp t0 ({2022,1,1},{0,0,0},0);
+
+  // Create a grids manager
+  auto gm = create_gm(comm);
+
+  // Run one step with two subcycles, recording the fingerprints in the given
+  // file. Returns the global hash of each field, computed one entry at a time.
+  // The logs are also compared with scripts/compare-fingerprints (see CMakeLists.txt).
+  auto run_proc = [&](const std::string& file_name, const bool perturb) {
+    ekat::ParameterList params("Fingerprint");
+    params.set<std::string>("Grid Name", "Point Grid");
+    params.set<std::string>("state_fingerprint_file", file_name);
+    params.set<int>("number_of_subcycles", 2);
+
+    auto ap = std::make_shared<Fingerprint>(comm,params);
+    ap->set_grids(gm);
+
+    std::mt19937_64 engine(1234+comm.rank());
+    std::uniform_real_distribution<Real> pdf(0,1);
+    std::map<std::string,HashType> hashes;
+    for(const auto& req : ap->get_required_field_requests()) {
+      Field f(req.fid);
+      f.get_header().get_alloc_properties().request_allocation(req.pack_size);
+      f.allocate_view();
+      const auto& lo = req.fid.get_layout();
+      HashType h = 0;
+      if (lo.rank()==1) {
+        auto v = f.get_view<Real*,Host>();
+        for (int i=0; i<lo.dim(0); ++i) {
+          v(i) = pdf(engine);
+          bfbhash::hash(v(i),h);
+        }
+      } else if (lo.rank()==2) {
+        // The padding must not contribute to the hash
+        auto v = f.get_view<Real**,Host>();
+        for (int i=0; i<v.extent_int(0); ++i) {
+          for (int k=0; k<v.extent_int(1); ++k) {
+            v(i,k) = k<lo.dim(1) ? pdf(engine) : 1e10;
+            if (k<lo.dim(1)) bfbhash::hash(v(i,k),h);
+          }
+        }
+      } else {
+        auto v = f.get_view<Real***,Host>();
+        for (int i=0; i<lo.dim(0); ++i) {
+          for (int j=0; j<lo.dim(1); ++j) {
+            for (int k=0; k<lo.dim(2); ++k) {
+              v(i,j,k) = pdf(engine);
+              if (perturb && i==0 && j==1 && k==2 && comm.am_i_root()) {
+                v(i,j,k) += 1;
+              }
+              bfbhash::hash(v(i,j,k),h);
+            }
+          }
+        }
+      }
+      f.sync_to_dev();
+      f.get_header().get_tracking().update_time_stamp(t0);
+      ap->set_required_field(f.get_const());
+      ap->set_computed_field(f);
+
+      HashType gh;
+      bfbhash::all_reduce_HashType(comm.mpi_comm(),&h,&gh,1);
+      hashes[f.name() + "@Point Grid"] = gh;
+    }
+
+    ap->initialize(t0,RunType::Initial);
+    ap->run(10);
+    comm.barrier();
+    return hashes;
+  };
+
+  // Read the hash records of the log, for a process with no repeated records
+  using records_t = std::vector<std::map<std::string,HashType>>;
+  auto read_log = [&](const std::string& file_name) {
+    std::ifstream f(file_name, std::ios::binary);
+    REQUIRE (f.good());
+    auto read_int = [&]() {
+      std::int32_t i;
+      f.read(reinterpret_cast<char*>(&i),sizeof(i));
+      return i;
+    };
+    auto read_str = [&]() {
+      std::string str(read_int(),' ');
+      f.read(&str[0],str.size());
+      return str;
+    };
+    char header[8];
+    f.read(header,8);
+    REQUIRE (std::string(header,7)=="EXXFP1\n");
+
+    std::vector<std::string> names;
+    records_t records;
+    char rtype;
+    while (f.read(&rtype,1)) {
+      REQUIRE (read_int()==0);
+      if (rtype=='P') {
+        REQUIRE (read_str()=="Fingerprint");
+        names.resize(read_int());
+        for (auto& n : names) {
+          n = read_str();
+        }
+      } else {
+        REQUIRE (rtype=='H');
+        REQUIRE (read_int()==0);
+        REQUIRE (read_int()==int(records.size()));
+        records.emplace_back();
+        for (const auto& n : names) {
+          HashType h;
+          f.read(reinterpret_cast<char*>(&h),sizeof(h));
+          records.back()[n] = h;
+        }
+      }
+    }
+    return records;
+  };
+
+  const auto ref  = run_proc("atm_proc_fingerprint.bin",false);
+  const auto same = run_proc("atm_proc_fingerprint_same.bin",false);
+  const auto pert = run_proc("atm_proc_fingerprint_pert.bin",true);
+  REQUIRE (ref==same);
+  REQUIRE (ref.at("Field C@Point Grid")!=pert.at("Field C@Point Grid"));
+
+  // The fused hash matches the per-field reference, after each subcycle
+  if (comm.am_i_root()) {
+    for (const auto& it : {std::make_pair("atm_proc_fingerprint.bin",ref),
+                           std::make_pair("atm_proc_fingerprint_pert.bin",pert)}) {
+      const auto records = read_log(it.first);
+      REQUIRE (records.size()==2);
+      for (const auto& r : records) {
+        REQUIRE (r==it.second);
+      }
+    }
+  }
+}
+
 } // empty namespace
@@ -208,6 +208,28 @@ void TimeInterpolation::initialize_data_from_files()
     }
 
   }
+  const bool next_in_same_file = m_triplet_idx+1<static_cast<int>(m_file_data_triplets.size()) &&
+                                 m_file_data_triplets[m_triplet_idx+1].filename==triplet_curr.filename;
+  if (next_in_same_file) {
+    // Read both snaps of data in one pass, directly into the time0/time1 fields
+    ++m_triplet_idx;
+    const auto triplet_next = m_file_data_triplets[m_triplet_idx];
+    std::vector<AtmosphereInput::ReadRequest> requests;
+    for (auto& name : m_field_names) {
+      requests.push_back({name,triplet_curr.time_idx,m_fm_time0->get_field(name)});
+      requests.push_back({name,triplet_next.time_idx,m_fm_time1->get_field(name)});
+    }
+    if (m_logger) {
+      m_logger->info(m_header);
+      m_logger->info("[EAMxx:time_interpolation] Reading data at times " + triplet_curr.timestamp.to_string()
+                     + " and " + triplet_next.timestamp.to_string());
+    }
+    m_file_data_atm_input->read_variables(requests);
+    m_time0 = triplet_curr.timestamp;
+    m_time1 = triplet_next.timestamp;
+    return;
+  }
+
   // Read first snap of data and shift to time0
   read_data();
   shift_data();
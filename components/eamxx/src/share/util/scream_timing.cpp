@@ -24,6 +24,12 @@ void stop_timer (const std::string& name) {
   GPTLstop(name.c_str());
 }
 
+double get_timer_wallclock (const std::string& name) {
+  double value = 0;
+  GPTLget_wallclock(name.c_str(),-1,&value);
+  return value;
+}
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
@@ -15,6 +15,9 @@ void finalize_gptl ();
 void start_timer (const std::string& name);
 void stop_timer (const std::string& name);
 
+// Total wall clock time (in seconds) accumulated so far by a timer
+double get_timer_wallclock (const std::string& name);
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
 } // namespace scream
@@ -0,0 +1,366 @@
+#include <catch2/catch.hpp>
+
+#include "physics/cosp/cosp_native_functions.hpp"
+#include "physics/cosp/cosp_functions.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace scream {
+
+TEST_CASE("cosp_native") {
+  using namespace CospNativeFunc;
+
+  const int ncol = 3;
+  const int nsub = 200;
+  const int nlay = 30;
+
+  view_1d<Real> sunlit("sunlit",ncol), skt("skt",ncol), cldtot("cldtot",ncol);
+  view_2d<Real> T("T",ncol,nlay), pmid("pmid",ncol,nlay), pint("pint",ncol,nlay+1),
+                zmid("zmid",ncol,nlay), qv("qv",ncol,nlay), cf("cf",ncol,nlay),
+                tau067("tau067",ncol,nlay), tau105("tau105",ncol,nlay);
+  view_3d<Real> isccp("isccp",ncol,num_tau_bins,num_prs_bins),
+                modis("modis",ncol,num_tau_bins,num_prs_bins),
+                misr ("misr", ncol,num_tau_bins,num_cth_bins);
+
+  auto sunlit_h = Kokkos::create_mirror_view(sunlit);
+  auto skt_h    = Kokkos::create_mirror_view(skt);
+  auto T_h      = Kokkos::create_mirror_view(T);
+  auto pmid_h   = Kokkos::create_mirror_view(pmid);
+  auto pint_h   = Kokkos::create_mirror_view(pint);
+  auto zmid_h   = Kokkos::create_mirror_view(zmid);
+  auto qv_h     = Kokkos::create_mirror_view(qv);
+  auto cf_h     = Kokkos::create_mirror_view(cf);
+  auto t067_h   = Kokkos::create_mirror_view(tau067);
+  auto t105_h   = Kokkos::create_mirror_view(tau105);
+
+  // Column 0: thick overcast low cloud; column 1: half-covered thick cloud at a
+  // single mid level; column 2: like column 0, but in the dark.
+  const int klow = nlay-4;
+  const int kmid = nlay/2;
+  for (int i=0; i<ncol; ++i) {
+    sunlit_h(i) = i==2 ? 0 : 1;
+    skt_h(i) = 290;
+    for (int k=0; k<=nlay; ++k) {
+      pint_h(i,k) = 100000.0*k/nlay + 500*(i+1);
+    }
+    for (int k=0; k<nlay; ++k) {
+      pmid_h(i,k) = (pint_h(i,k)+pint_h(i,k+1))/2;
+      T_h(i,k)    = 210 + 80*pmid_h(i,k)/100000;
+      zmid_h(i,k) = 16000*(1-pmid_h(i,k)/100000);
+      qv_h(i,k)   = 1e-3*pmid_h(i,k)/100000;
+      cf_h(i,k)   = 0;
+      t067_h(i,k) = 0;
+      t105_h(i,k) = 0;
+    }
+  }
+  for (int i : {0,2}) {
+    cf_h(i,klow) = 1;
+    t067_h(i,klow) = 30;
+    t105_h(i,klow) = 15;
+  }
+  cf_h(1,kmid) = 0.5;
+  t067_h(1,kmid) = 30;
+  t105_h(1,kmid) = 15;
+
+  Kokkos::deep_copy(sunlit,sunlit_h);
+  Kokkos::deep_copy(skt,skt_h);
+  Kokkos::deep_copy(T,T_h);
+  Kokkos::deep_copy(pmid,pmid_h);
+  Kokkos::deep_copy(pint,pint_h);
+  Kokkos::deep_copy(zmid,zmid_h);
+  Kokkos::deep_copy(qv,qv_h);
+  Kokkos::deep_copy(cf,cf_h);
+  Kokkos::deep_copy(tau067,t067_h);
+  Kokkos::deep_copy(tau105,t105_h);
+
+  main(ncol,nsub,nlay,0.99,0,sunlit,skt,T,pmid,pint,zmid,qv,cf,tau067,tau105,
+       cldtot,isccp,modis,misr);
+
+  auto cldtot_h = Kokkos::create_mirror_view(cldtot);
+  auto isccp_h  = Kokkos::create_mirror_view(isccp);
+  auto modis_h  = Kokkos::create_mirror_view(modis);
+  auto misr_h   = Kokkos::create_mirror_view(misr);
+  Kokkos::deep_copy(cldtot_h,cldtot);
+  Kokkos::deep_copy(isccp_h,isccp);
+  Kokkos::deep_copy(modis_h,modis);
+  Kokkos::deep_copy(misr_h,misr);
+
+  auto hist_sum = [&](const decltype(isccp_h)& h, const int i, const int nb) {
+    Real s = 0;
+    for (int t=0; t<num_tau_bins; ++t) {
+      for (int b=0; b<nb; ++b) {
+        s += h(i,t,b);
+      }
+    }
+    return s;
+  };
+
+  const Real tol = 1e-10;
+
+  // Overcast: every subcolumn is cloudy, with tau in the 23-60 bin
+  REQUIRE (std::abs(cldtot_h(0)-100)<tol);
+  REQUIRE (std::abs(hist_sum(isccp_h,0,num_prs_bins)-100)<tol);
+  REQUIRE (std::abs(hist_sum(modis_h,0,num_prs_bins)-100)<tol);
+  REQUIRE (std::abs(hist_sum(misr_h,0,num_cth_bins)-100)<tol);
+  REQUIRE (std::abs(isccp_h(0,tau_bin(30),prs_bin(pmid_h(0,klow)))-100)<tol);
+  REQUIRE (std::abs(modis_h(0,tau_bin(30),prs_bin(pint_h(0,klow)))-100)<tol);
+  REQUIRE (std::abs(misr_h(0,tau_bin(30),cth_bin(zmid_h(0,klow)))-100)<tol);
+
+  // Half covered: SCOPS must give a cloud cover close to the cloud fraction
+  REQUIRE (cldtot_h(1)>35);
+  REQUIRE (cldtot_h(1)<65);
+  REQUIRE (std::abs(hist_sum(isccp_h,1,num_prs_bins)-cldtot_h(1))<tol);
+
+  // Night: nothing is computed
+  REQUIRE (cldtot_h(2)==0);
+  REQUIRE (hist_sum(isccp_h,2,num_prs_bins)==0);
+  REQUIRE (hist_sum(modis_h,2,num_prs_bins)==0);
+  REQUIRE (hist_sum(misr_h,2,num_cth_bins)==0);
+}
+
+TEST_CASE("cosp_native_isccp_top_height") {
+  using namespace CospNativeFunc;
+
+  // One column with a surface inversion, so that the temperature of a thick
+  // cloud in the lowest layer is matched again higher up, above the inversion.
+  // With top_height_direction=2 (as in cosp_c2f), the cloud top is the highest
+  // match, and not the level of the cloud itself.
+  const int ncol = 1;
+  const int nsub = 1;
+  const int nlay = 30;
+
+  view_1d<Real> sunlit("sunlit",ncol), skt("skt",ncol), cldtot("cldtot",ncol);
+  view_2d<Real> T("T",ncol,nlay), pmid("pmid",ncol,nlay), pint("pint",ncol,nlay+1),
+                zmid("zmid",ncol,nlay), qv("qv",ncol,nlay), cf("cf",ncol,nlay),
+                tau067("tau067",ncol,nlay), tau105("tau105",ncol,nlay);
+  view_3d<Real> isccp("isccp",ncol,num_tau_bins,num_prs_bins),
+                modis("modis",ncol,num_tau_bins,num_prs_bins),
+                misr ("misr", ncol,num_tau_bins,num_cth_bins);
+
+  auto T_h    = Kokkos::create_mirror_view(T);
+  auto pmid_h = Kokkos::create_mirror_view(pmid);
+  auto pint_h = Kokkos::create_mirror_view(pint);
+  auto zmid_h = Kokkos::create_mirror_view(zmid);
+  auto cf_h   = Kokkos::create_mirror_view(cf);
+  auto t067_h = Kokkos::create_mirror_view(tau067);
+  auto t105_h = Kokkos::create_mirror_view(tau105);
+
+  // T increases from 250K at the surface to 280K at 850hPa, then decreases
+  // linearly to 190K at the model top. No water vapor, so tb is the cloud T.
+  auto T_of_p = [](const Real p) {
+    return p>=85000 ? 250 + 30*(100000-p)/15000 : 280 - 90*(85000-p)/85000;
+  };
+  for (int k=0; k<=nlay; ++k) {
+    pint_h(0,k) = 100000.0*k/nlay + 500;
+  }
+  for (int k=0; k<nlay; ++k) {
+    pmid_h(0,k) = (pint_h(0,k)+pint_h(0,k+1))/2;
+    T_h(0,k)    = T_of_p(pmid_h(0,k));
+    zmid_h(0,k) = 16000*(1-pmid_h(0,k)/100000);
+    cf_h(0,k)   = 0;
+    t067_h(0,k) = 0;
+    t105_h(0,k) = 0;
+  }
+  const int kc = nlay-1;
+  cf_h(0,kc) = 1;
+  t067_h(0,kc) = 30;
+  t105_h(0,kc) = 15;
+
+  Kokkos::deep_copy(sunlit,1);
+  Kokkos::deep_copy(skt,T_h(0,kc));
+  Kokkos::deep_copy(qv,0);
+  Kokkos::deep_copy(T,T_h);
+  Kokkos::deep_copy(pmid,pmid_h);
+  Kokkos::deep_copy(pint,pint_h);
+  Kokkos::deep_copy(zmid,zmid_h);
+  Kokkos::deep_copy(cf,cf_h);
+  Kokkos::deep_copy(tau067,t067_h);
+  Kokkos::deep_copy(tau105,t105_h);
+
+  main(ncol,nsub,nlay,0.99,0,sunlit,skt,T,pmid,pint,zmid,qv,cf,tau067,tau105,
+       cldtot,isccp,modis,misr);
+
+  auto cldtot_h = Kokkos::create_mirror_view(cldtot);
+  auto isccp_h  = Kokkos::create_mirror_view(isccp);
+  Kokkos::deep_copy(cldtot_h,cldtot);
+  Kokkos::deep_copy(isccp_h,isccp);
+
+  // Where the cloud T is matched above the inversion
+  const Real p_upper = 85000 - (280 - T_h(0,kc))*85000/90;
+  const int b_upper = prs_bin(p_upper);
+  const int b_lower = prs_bin(pmid_h(0,kc));
+  REQUIRE (b_upper!=b_lower);
+
+  const Real tol = 1e-10;
+  REQUIRE (std::abs(cldtot_h(0)-100)<tol);
+  REQUIRE (std::abs(isccp_h(0,tau_bin(30),b_upper)-100)<tol);
+  REQUIRE (isccp_h(0,tau_bin(30),b_lower)==0);
+}
+
+TEST_CASE("cosp_native_vs_f90") {
+  using namespace CospNativeFunc;
+
+  // The subcolumns of the two implementations come from different random number
+  // generators, so the histograms can only agree in a statistical sense. We use
+  // enough subcolumns, and compare the marginals of the joint histograms.
+  // Column 0: one low liquid cloud. Column 1: a high ice cloud, randomly
+  // overlapped with a thick low liquid cloud.
+  const int ncol = 2;
+  const int nsub = 1000;
+  const int nlay = 40;
+  const int klow  = 33;
+  const int khigh = 8;
+  const Real emsfc_lw = 0.99;
+
+  view_1d<Real> sunlit("sunlit",ncol), skt("skt",ncol), cldtot("cldtot",ncol);
+  view_2d<Real> T("T",ncol,nlay), pmid("pmid",ncol,nlay), pint("pint",ncol,nlay+1),
+                zmid("zmid",ncol,nlay), qv("qv",ncol,nlay), cf("cf",ncol,nlay),
+                tau067("tau067",ncol,nlay), tau105("tau105",ncol,nlay);
+  view_3d<Real> isccp("isccp",ncol,num_tau_bins,num_prs_bins),
+                modis("modis",ncol,num_tau_bins,num_prs_bins),
+                misr ("misr", ncol,num_tau_bins,num_cth_bins);
+
+  auto sunlit_h = Kokkos::create_mirror_view(sunlit);
+  auto skt_h    = Kokkos::create_mirror_view(skt);
+  auto T_h      = Kokkos::create_mirror_view(T);
+  auto pmid_h   = Kokkos::create_mirror_view(pmid);
+  auto pint_h   = Kokkos::create_mirror_view(pint);
+  auto zmid_h   = Kokkos::create_mirror_view(zmid);
+  auto qv_h     = Kokkos::create_mirror_view(qv);
+  auto cf_h     = Kokkos::create_mirror_view(cf);
+  auto t067_h   = Kokkos::create_mirror_view(tau067);
+  auto t105_h   = Kokkos::create_mirror_view(tau105);
+
+  // Inputs only needed by the F90 code (MODIS optics)
+  CospFunc::view_2d<Real> qc_h("qc",ncol,nlay), qi_h("qi",ncol,nlay),
+                          reff_qc_h("reff_qc",ncol,nlay), reff_qi_h("reff_qi",ncol,nlay);
+
+  for (int i=0; i<ncol; ++i) {
+    sunlit_h(i) = 1;
+    skt_h(i) = 300;
+    for (int k=0; k<=nlay; ++k) {
+      pint_h(i,k) = 100000.0*k/nlay + 100*i;
+    }
+    for (int k=0; k<nlay; ++k) {
+      pmid_h(i,k) = (pint_h(i,k)+pint_h(i,k+1))/2;
+      zmid_h(i,k) = 7500*std::log(100000/pmid_h(i,k));
+      T_h(i,k)    = std::max(200.0,300-6.5e-3*zmid_h(i,k));
+      qv_h(i,k)   = 1e-2*std::pow(pmid_h(i,k)/100000,3);
+      cf_h(i,k)   = 0;
+      t067_h(i,k) = 0;
+      t105_h(i,k) = 0;
+      qc_h(i,k) = qi_h(i,k) = 0;
+      reff_qc_h(i,k) = 10;
+      reff_qi_h(i,k) = 30;
+    }
+  }
+  auto set_cloud = [&](const int i, const int k, const Real frac, const Real tau, const bool liquid) {
+    cf_h(i,k)   = frac;
+    t067_h(i,k) = tau;
+    t105_h(i,k) = tau/2;
+    if (liquid) {
+      qc_h(i,k) = 1e-4*frac;
+    } else {
+      qi_h(i,k) = 1e-4*frac;
+    }
+  };
+  set_cloud(0,klow, 0.6,12,true);
+  set_cloud(1,khigh,0.4, 4,false);
+  set_cloud(1,klow, 0.5,20,true);
+
+  Kokkos::deep_copy(sunlit,sunlit_h);
+  Kokkos::deep_copy(skt,skt_h);
+  Kokkos::deep_copy(T,T_h);
+  Kokkos::deep_copy(pmid,pmid_h);
+  Kokkos::deep_copy(pint,pint_h);
+  Kokkos::deep_copy(zmid,zmid_h);
+  Kokkos::deep_copy(qv,qv_h);
+  Kokkos::deep_copy(cf,cf_h);
+  Kokkos::deep_copy(tau067,t067_h);
+  Kokkos::deep_copy(tau105,t105_h);
+
+  // Native simulators
+  main(ncol,nsub,nlay,emsfc_lw,0,sunlit,skt,T,pmid,pint,zmid,qv,cf,tau067,tau105,
+       cldtot,isccp,modis,misr);
+
+  auto cldtot_h = Kokkos::create_mirror_view(cldtot);
+  auto isccp_h  = Kokkos::create_mirror_view(isccp);
+  auto modis_h  = Kokkos::create_mirror_view(modis);
+  auto misr_h   = Kokkos::create_mirror_view(misr);
+  Kokkos::deep_copy(cldtot_h,cldtot);
+  Kokkos::deep_copy(isccp_h,isccp);
+  Kokkos::deep_copy(modis_h,modis);
+  Kokkos::deep_copy(misr_h,misr);
+
+  // F90 COSP library
+  CospFunc::view_1d<Real> f90_cldtot("f90_cldtot",ncol);
+  CospFunc::view_3d<Real> f90_isccp("f90_isccp",ncol,num_tau_bins,num_prs_bins),
+                          f90_modis("f90_modis",ncol,num_tau_bins,num_prs_bins),
+                          f90_misr ("f90_misr", ncol,num_tau_bins,num_cth_bins);
+  CospFunc::view_1d<const Real> sunlit_c = sunlit_h, skt_c = skt_h;
+  CospFunc::view_2d<const Real> T_c = T_h, pmid_c = pmid_h, pint_c = pint_h, zmid_c = zmid_h,
+                                qv_c = qv_h, qc_c = qc_h, qi_c = qi_h, cf_c = cf_h,
+                                reff_qc_c = reff_qc_h, reff_qi_c = reff_qi_h,
+                                t067_c = t067_h, t105_c = t105_h;
+  CospFunc::initialize(ncol,nsub,nlay);
+  CospFunc::main(ncol,nsub,nlay,num_tau_bins,num_prs_bins,num_cth_bins,emsfc_lw,
+                 sunlit_c,skt_c,T_c,pmid_c,pint_c,zmid_c,qv_c,qc_c,qi_c,cf_c,
+                 reff_qc_c,reff_qi_c,t067_c,t105_c,
+                 f90_cldtot,f90_isccp,f90_modis,f90_misr);
+  CospFunc::finalize();
+
+  // Two independent estimates of a cloud fraction p (in percent) from nsub
+  // subcolumns should agree within 4 standard deviations, plus some slack for
+  // the differences in the simulators themselves.
+  auto check = [&](const Real native_val, const Real f90_val) {
+    const Real p = std::min(std::max((native_val+f90_val)/200,0.0),1.0);
+    const Real tol = 100*4*std::sqrt(2*p*(1-p)/nsub) + 2;
+    CHECK (std::abs(native_val-f90_val)<=tol);
+  };
+  auto tau_marginal = [&](const auto& h, const int i, const int t, const int nb) {
+    Real s = 0;
+    for (int b=0; b<nb; ++b) {
+      s += h(i,t,b);
+    }
+    return s;
+  };
+  auto top_marginal = [&](const auto& h, const int i, const int b) {
+    Real s = 0;
+    for (int t=0; t<num_tau_bins; ++t) {
+      s += h(i,t,b);
+    }
+    return s;
+  };
+  auto total = [&](const auto& h, const int i, const int nb) {
+    Real s = 0;
+    for (int t=0; t<num_tau_bins; ++t) {
+      s += tau_marginal(h,i,t,nb);
+    }
+    return s;
+  };
+
+  for (int i=0; i<ncol; ++i) {
+    check(cldtot_h(i),f90_cldtot(i));
+
+    // ISCCP: both marginals
+    for (int t=0; t<num_tau_bins; ++t) {
+      check(tau_marginal(isccp_h,i,t,num_prs_bins),tau_marginal(f90_isccp,i,t,num_prs_bins));
+    }
+    for (int b=0; b<num_prs_bins; ++b) {
+      check(top_marginal(isccp_h,i,b),top_marginal(f90_isccp,i,b));
+    }
+
+    // MISR: the cloud top height is simplified in the native code, so only
+    // compare the optical depth marginal
+    for (int t=0; t<num_tau_bins; ++t) {
+      check(tau_marginal(misr_h,i,t,num_cth_bins),tau_marginal(f90_misr,i,t,num_cth_bins));
+    }
+
+    // MODIS is simplified in the native code (no reflectance retrieval, no CO2
+    // slicing), so only the total cloud fraction is comparable
+    check(total(modis_h,i,num_prs_bins),total(f90_modis,i,num_prs_bins));
+  }
+}
+
+} // namespace scream
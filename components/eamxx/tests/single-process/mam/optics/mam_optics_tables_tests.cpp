@@ -0,0 +1,258 @@
+#include <catch2/catch.hpp>
+
+#include "physics/mam/mam_optics_tables.hpp"
+#include "physics/mam/mam_aerosol_optics_read_tables.hpp"
+#include "share/io/scorpio_input.hpp"
+#include "share/io/scream_scorpio_interface.hpp"
+#include "share/grid/point_grid.hpp"
+
+#include "ekat/mpi/ekat_comm.hpp"
+
+#include <utime.h>
+
+#include <cstdio>
+#include <fstream>
+
+namespace scream {
+
+namespace {
+
+using namespace ShortFieldTagsNames;
+using view_1d_host = mam_coupling::view_1d_host;
+using strvec_t     = std::vector<std::string>;
+
+const std::string water_file =
+  SCREAM_DATA_DIR "/mam4xx/physprops/water_refindex_rrtmg_c20240206.nc";
+
+// Host views and layouts for (a subset of) the variables of the water table
+struct WaterTable {
+  WaterTable (const strvec_t& names_in) : names(names_in) {
+    constexpr int nswbands = mam_coupling::nswbands;
+    constexpr int nlwbands = mam_coupling::nlwbands;
+    for (const auto& n : names) {
+      const bool sw = n.find("_sw")!=std::string::npos;
+      const int nbands = sw ? nswbands : nlwbands;
+      views[n] = view_1d_host(n,nbands);
+      layouts.emplace(n,FieldLayout({CMP},{nbands},{sw ? "swband" : "lwband"}));
+    }
+    params.set("Filename", water_file);
+    params.set("Skip_Grid_Checks", true);
+    params.set("Field Names", names);
+  }
+
+  void read (const std::shared_ptr<const AbstractGrid>& grid, const std::string& cache_dir) {
+    for (auto& it : views) {
+      Kokkos::deep_copy(it.second,-1);
+    }
+    mam_coupling::read_optics_table(params,grid,views,layouts,cache_dir);
+  }
+
+  // Collective read through scorpio, used as a reference for the root-only read
+  void read_with_scorpio (const std::shared_ptr<const AbstractGrid>& grid) {
+    AtmosphereInput table(params, grid, views, layouts);
+    table.read_variables();
+    table.finalize();
+  }
+
+  bool same_values (const WaterTable& rhs) const {
+    for (const auto& n : names) {
+      const auto& v = views.at(n);
+      const auto& w = rhs.views.at(n);
+      for (size_t i=0; i<v.size(); ++i) {
+        if (v(i)!=w(i)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+
+  strvec_t names;
+  ekat::ParameterList params;
+  std::map<std::string,view_1d_host> views;
+  std::map<std::string,FieldLayout>  layouts;
+};
+
+bool file_exists (const std::string& fname) {
+  return std::ifstream(fname).good();
+}
+
+// Overwrite an int32 entry of the cache file header
+void patch_header (const std::string& fname, const int offset, const std::int32_t value) {
+  std::fstream f(fname, std::ios::in | std::ios::out | std::ios::binary);
+  f.seekp(offset);
+  f.write(reinterpret_cast<const char*>(&value),sizeof(value));
+}
+
+} // anonymous namespace
+
+TEST_CASE ("mam_optics_tables_cache") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto grid = create_point_grid("Physics",2*comm.size(),1,comm);
+
+  const std::string cache_dir = ".";
+  const strvec_t all = {"refindex_im_water_lw", "refindex_im_water_sw",
+                        "refindex_real_water_lw", "refindex_real_water_sw"};
+  const strvec_t sw  = {"refindex_im_water_sw", "refindex_real_water_sw"};
+  const auto all_cache = mam_coupling::optics_cache_file(water_file,all,cache_dir,comm);
+  const auto sw_cache  = mam_coupling::optics_cache_file(water_file,sw,cache_dir,comm);
+
+  // The cache entry depends on the requested variables
+  REQUIRE (all_cache!=sw_cache);
+  if (comm.am_i_root()) {
+    std::remove(all_cache.c_str());
+    std::remove(sw_cache.c_str());
+  }
+  comm.barrier();
+
+  // Reference values, read from the netcdf file on the root rank only,
+  // must match a collective read of the same file
+  WaterTable ref(all);
+  ref.read(grid,"");
+  {
+    WaterTable collective(all);
+    collective.read_with_scorpio(grid);
+    REQUIRE (ref.same_values(collective));
+  }
+
+  constexpr int header_size = 8 + 3*sizeof(std::int32_t);
+  constexpr int real_size_offset = 8 + sizeof(std::int32_t);
+
+  // Round trip: the first read populates the cache (on the root rank only)...
+  WaterTable t(all);
+  t.read(grid,cache_dir);
+  REQUIRE (t.same_values(ref));
+  if (comm.am_i_root()) {
+    REQUIRE (file_exists(all_cache));
+  }
+  comm.barrier();
+
+  // ...and the second one reads it. To make sure the values do come from the
+  // cache, alter the first entry of the first variable in the cache file.
+  const Real marker = 12345;
+  if (comm.am_i_root()) {
+    const auto& n = all.front();
+    std::fstream f(all_cache, std::ios::in | std::ios::out | std::ios::binary);
+    f.seekp(header_size + sizeof(std::int32_t) + n.size() + sizeof(std::int64_t));
+    f.write(reinterpret_cast<const char*>(&marker),sizeof(Real));
+  }
+  comm.barrier();
+  {
+    WaterTable t2(all);
+    t2.read(grid,cache_dir);
+    auto& v = t2.views.at(all.front());
+    REQUIRE (v(0)==marker);
+    v(0) = ref.views.at(all.front())(0);
+    REQUIRE (t2.same_values(ref));
+  }
+
+  // An entry written with a different Real size (e.g., by a single precision
+  // build) must be rejected, and replaced with a valid one
+  const std::int32_t other_size = sizeof(Real)==8 ? 4 : 8;
+  if (comm.am_i_root()) {
+    patch_header(all_cache,real_size_offset,other_size);
+  }
+  comm.barrier();
+  {
+    WaterTable t2(all);
+    t2.read(grid,cache_dir);
+    REQUIRE (t2.same_values(ref));
+  }
+  if (comm.am_i_root()) {
+    std::ifstream f(all_cache, std::ios::binary);
+    std::int32_t real_size;
+    f.seekg(real_size_offset);
+    f.read(reinterpret_cast<char*>(&real_size),sizeof(real_size));
+    REQUIRE (real_size==sizeof(Real));
+  }
+  comm.barrier();
+
+  // Put the entry with all variables where the sw-only entry would be. The
+  // variables in the file don't match the request, so the entry must be
+  // rejected, and the netcdf file read instead.
+  if (comm.am_i_root()) {
+    REQUIRE (std::rename(all_cache.c_str(),sw_cache.c_str())==0);
+  }
+  comm.barrier();
+  {
+    WaterTable ref_sw(sw);
+    ref_sw.read(grid,"");
+    WaterTable t_sw(sw);
+    t_sw.read(grid,cache_dir);
+    REQUIRE (t_sw.same_values(ref_sw));
+  }
+
+  comm.barrier();
+  if (comm.am_i_root()) {
+    std::remove(all_cache.c_str());
+    std::remove(sw_cache.c_str());
+  }
+  scorpio::finalize_subsystem();
+}
+
+TEST_CASE ("mam_optics_tables_signature") {
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // A local copy of the water table, so we can change its mtime
+  const std::string copy = "mam_optics_tables_signature.nc";
+  if (comm.am_i_root()) {
+    std::ifstream src(water_file, std::ios::binary);
+    std::ofstream dst(copy, std::ios::binary);
+    dst << src.rdbuf();
+  }
+  comm.barrier();
+
+  // Same content, different path
+  const auto h_orig = mam_coupling::table_signature(water_file,comm);
+  const auto h_copy = mam_coupling::table_signature(copy,comm);
+  REQUIRE (h_orig!=h_copy);
+
+  // Same file, not modified
+  REQUIRE (mam_coupling::table_signature(copy,comm)==h_copy);
+
+  // Same file, modified
+  if (comm.am_i_root()) {
+    struct utimbuf times;
+    times.actime = times.modtime = 1000000000;
+    REQUIRE (utime(copy.c_str(),&times)==0);
+  }
+  comm.barrier();
+  REQUIRE (mam_coupling::table_signature(copy,comm)!=h_copy);
+
+  comm.barrier();
+  if (comm.am_i_root()) {
+    std::remove(copy.c_str());
+  }
+}
+
+TEST_CASE ("mam_optics_tables_registry") {
+  using Data = mam_coupling::AerosolOpticsDeviceData;
+
+  const std::string key = "a.nc;b.nc;";
+
+  REQUIRE (mam_coupling::get_shared_optics_data(key)==nullptr);
+
+  auto data = std::make_shared<Data>();
+  mam_coupling::register_shared_optics_data(key,data);
+
+  // All users of the same tables get the same data
+  {
+    auto d1 = mam_coupling::get_shared_optics_data(key);
+    auto d2 = mam_coupling::get_shared_optics_data(key);
+    REQUIRE (d1==data);
+    REQUIRE (d2==data);
+    REQUIRE (mam_coupling::get_shared_optics_data("c.nc;")==nullptr);
+  }
+
+  // The registry does not keep the data alive
+  std::weak_ptr<Data> w = data;
+  data.reset();
+  REQUIRE (w.expired());
+  REQUIRE (mam_coupling::get_shared_optics_data(key)==nullptr);
+
+  REQUIRE_THROWS (mam_coupling::register_shared_optics_data(key,nullptr));
+}
+
+} // namespace scream
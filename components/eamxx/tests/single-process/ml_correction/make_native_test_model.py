@@ -0,0 +1,106 @@
+"""Write the tq model and the expected corrections of the ml_correction_native_process test.
+
+The model is a small keras network (T_mid, qv) -> (dQ1, dQ2), with the structure
+of the fv3fit dense models, exported with ml_correction_export.py. The expected
+corrections are the keras predictions times dt, on the initial state set by
+ml_correction_native_process.cpp (see initial_state). Without tensorflow, the
+network is built directly in numpy and its numpy evaluation is used instead.
+
+Usage:
+    python make_native_test_model.py SRC_DIR NCOLS NLEVS DT MODEL_FILE EXPECTED_FILE
+"""
+import sys
+
+import numpy as np
+
+
+def initial_state(ncols, nlevs):
+    """T_mid and qv of column gid and level ilev, as set by the C++ test"""
+    gid = np.arange(ncols)[:, np.newaxis]
+    ilev = np.arange(nlevs)[np.newaxis, :]
+    T_mid = 220.0 + 70.0 * ilev / (nlevs - 1) + 2.0 * np.sin(gid + 1.0)
+    qv = 1.0e-3 * (1.0 + ilev / nlevs) * (1.0 + 0.1 * np.cos(gid + 1.0))
+    return T_mid, qv
+
+
+def keras_model(nlevs, nhid, weights, scaling):
+    import tensorflow as tf
+
+    class StandardNorm(tf.keras.layers.Layer):
+        def __init__(self, mean, sigma, denorm=False, **kwargs):
+            super().__init__(**kwargs)
+            self.mean = mean.astype(np.float32)
+            self.sigma = sigma.astype(np.float32)
+            self.denorm = denorm
+
+        def call(self, x):
+            return x * self.sigma + self.mean if self.denorm else (x - self.mean) / self.sigma
+
+    (in_mean, in_scale), (out_mean, out_scale) = scaling
+    W1, b1, W2, b2 = weights
+    T_mid = tf.keras.Input(shape=(nlevs,), name="T_mid")
+    qv = tf.keras.Input(shape=(nlevs,), name="qv")
+    x = tf.keras.layers.Concatenate()([
+        StandardNorm(in_mean[:nlevs], in_scale[:nlevs])(T_mid),
+        StandardNorm(in_mean[nlevs:], in_scale[nlevs:])(qv),
+    ])
+    hidden = tf.keras.layers.Dense(nhid, activation="tanh")
+    x = hidden(x)
+    last = tf.keras.layers.Dense(2 * nlevs, activation="linear")
+    x = last(x)
+    hidden.set_weights([W1.T.astype(np.float32), b1.astype(np.float32)])
+    last.set_weights([W2.T.astype(np.float32), b2.astype(np.float32)])
+    dQ1 = StandardNorm(out_mean[:nlevs], out_scale[:nlevs], denorm=True)(x[:, :nlevs])
+    dQ2 = StandardNorm(out_mean[nlevs:], out_scale[nlevs:], denorm=True)(x[:, nlevs:])
+    return tf.keras.Model(inputs=[T_mid, qv], outputs=[dQ1, dQ2])
+
+
+def main():
+    src_dir, ncols, nlevs, dt, model_file, expected_file = sys.argv[1:]
+    ncols, nlevs, dt = int(ncols), int(nlevs), float(dt)
+    sys.path.insert(0, src_dir)
+    import ml_correction_export as export
+
+    nhid = 8
+    rng = np.random.default_rng(1234)
+    weights = (
+        rng.uniform(-1, 1, (nhid, 2 * nlevs)) / np.sqrt(2 * nlevs),
+        rng.uniform(-0.1, 0.1, nhid),
+        rng.uniform(-1, 1, (2 * nlevs, nhid)),
+        rng.uniform(-0.1, 0.1, 2 * nlevs),
+    )
+    # Corrections of about 1e-4 K/s and 1e-8 kg/kg/s
+    scaling = (
+        (np.concatenate([np.full(nlevs, 255.0), np.full(nlevs, 1.5e-3)]),
+         np.concatenate([np.full(nlevs, 20.0), np.full(nlevs, 5.0e-4)])),
+        (np.zeros(2 * nlevs),
+         np.concatenate([np.full(nlevs, 1.0e-4), np.full(nlevs, 1.0e-8)])),
+    )
+
+    T_mid, qv = initial_state(ncols, nlevs)
+    try:
+        model = keras_model(nlevs, nhid, weights, scaling)
+    except ImportError:
+        model = None
+    if model is not None:
+        native = export.from_keras(model, ["T_mid", "qv"], ["dQ1", "dQ2"])
+        dQ1, dQ2 = model.predict([T_mid.astype(np.float32), qv.astype(np.float32)], verbose=0)
+    else:
+        print("tensorflow is not available: using the numpy evaluation of the network")
+        W1, b1, W2, b2 = weights
+        (in_mean, in_scale), (out_mean, out_scale) = scaling
+        native = export.NativeModel(
+            "dense", [("T_mid", nlevs), ("qv", nlevs)], [("dQ1", nlevs), ("dQ2", nlevs)],
+            in_mean, in_scale, out_mean, out_scale, [(W1, b1, "tanh"), (W2, b2, "linear")])
+        y = native.predict(np.concatenate([T_mid, qv], axis=1))
+        dQ1, dQ2 = y[:, :nlevs], y[:, nlevs:]
+
+    native.write(model_file)
+    with open(expected_file, "w") as f:
+        for icol in range(ncols):
+            for ilev in range(nlevs):
+                f.write(f"{dQ1[icol, ilev] * dt:.17e} {dQ2[icol, ilev] * dt:.17e}\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,107 @@
+#include <catch2/catch.hpp>
+
+#include "control/atmosphere_driver.hpp"
+#include "physics/register_physics.hpp"
+#include "share/grid/mesh_free_grids_manager.hpp"
+
+#include <ekat/ekat_parse_yaml_file.hpp>
+
+#include <cmath>
+#include <fstream>
+#include <type_traits>
+
+namespace scream {
+
+// Runs MLCorrection with the native backend on the tq model written by
+// make_native_test_model.py, and checks the corrections of T_mid and qv
+// against the python predictions of that model.
+TEST_CASE("ml_correction-native-process", "") {
+  using namespace scream;
+  using namespace scream::control;
+
+  std::string fname = "input_native.yaml";
+  ekat::ParameterList ad_params("Atmosphere Driver");
+  parse_yaml_file(fname, ad_params);
+
+  const auto& ts     = ad_params.sublist("time_stepping");
+  const auto  dt     = ts.get<int>("time_step");
+  const auto  t0_str = ts.get<std::string>("run_t0");
+  const auto  t0     = util::str_to_time_stamp(t0_str);
+
+  ekat::Comm atm_comm(MPI_COMM_WORLD);
+
+  register_physics();
+  register_mesh_free_grids_manager();
+
+  AtmosphereDriver ad;
+  ad.initialize(atm_comm, ad_params, t0);
+
+  const auto& grid = ad.get_grids_manager()->get_grid("Physics");
+  const auto& field_mgr = *ad.get_field_mgr(grid->name());
+
+  const int num_cols = grid->get_num_local_dofs();
+  const int num_levs = grid->get_num_vertical_levels();
+  const auto gids = grid->get_dofs_gids().get_view<const AbstractGrid::gid_type*,Host>();
+
+  // Same state as initial_state in make_native_test_model.py
+  auto T_mid_field = field_mgr.get_field("T_mid");
+  auto qv_field    = field_mgr.get_field("qv");
+  auto dp_field    = field_mgr.get_field("pseudo_density");
+  const auto T_mid = T_mid_field.get_view<Real**,Host>();
+  const auto qv    = qv_field.get_view<Real**,Host>();
+  const auto dp    = dp_field.get_view<Real**,Host>();
+  for (int icol=0; icol<num_cols; ++icol) {
+    const double g = gids(icol);
+    for (int ilev=0; ilev<num_levs; ++ilev) {
+      T_mid(icol,ilev) = 220.0 + 70.0*ilev/(num_levs-1) + 2.0*std::sin(g+1.0);
+      qv(icol,ilev)    = 1.0e-3*(1.0 + double(ilev)/num_levs)*(1.0 + 0.1*std::cos(g+1.0));
+      dp(icol,ilev)    = 1000.0;
+    }
+  }
+  T_mid_field.sync_to_dev();
+  qv_field.sync_to_dev();
+  dp_field.sync_to_dev();
+  field_mgr.get_field("precip_liq_surf_mass").deep_copy(0);
+  field_mgr.get_field("precip_ice_surf_mass").deep_copy(0);
+
+  auto T_mid_old = T_mid_field.clone();
+  auto qv_old    = qv_field.clone();
+  T_mid_old.sync_to_host();
+  qv_old.sync_to_host();
+
+  ad.run(dt);
+
+  T_mid_field.sync_to_host();
+  qv_field.sync_to_host();
+  const auto T_mid0 = T_mid_old.get_view<const Real**,Host>();
+  const auto qv0    = qv_old.get_view<const Real**,Host>();
+
+  // The expected corrections dQ1*dt and dQ2*dt, for all the global columns
+  const int num_global_cols = grid->get_num_global_dofs();
+  std::vector<double> dT(num_global_cols*num_levs), dq(num_global_cols*num_levs);
+  std::ifstream expected("ml_native_tq_expected.txt");
+  REQUIRE (expected.good());
+  for (int n=0; n<num_global_cols*num_levs; ++n) {
+    expected >> dT[n] >> dq[n];
+  }
+  REQUIRE (expected.good());
+
+  // keras evaluates the model in single precision
+  const double tol = std::is_same<Real,double>::value ? 1e-4 : 1e-3;
+  double dT_max = 0, dq_max = 0;
+  for (int n=0; n<num_global_cols*num_levs; ++n) {
+    dT_max = std::max(dT_max,std::abs(dT[n]));
+    dq_max = std::max(dq_max,std::abs(dq[n]));
+  }
+  for (int icol=0; icol<num_cols; ++icol) {
+    for (int ilev=0; ilev<num_levs; ++ilev) {
+      const int n = gids(icol)*num_levs + ilev;
+      REQUIRE (std::abs((T_mid(icol,ilev)-T_mid0(icol,ilev)) - dT[n]) <= tol*dT_max);
+      REQUIRE (std::abs((qv(icol,ilev)-qv0(icol,ilev)) - dq[n]) <= tol*dq_max);
+    }
+  }
+
+  ad.finalize();
+}
+
+}  // namespace scream
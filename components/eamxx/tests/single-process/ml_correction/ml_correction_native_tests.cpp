@@ -0,0 +1,151 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/ml_correction_native.hpp"
+
+#include "ekat/util/ekat_test_utils.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <random>
+
+namespace scream {
+
+namespace {
+
+struct Layer {
+  int n_in, n_out, act;
+  std::vector<double> W, b;
+};
+
+void write_int (std::ofstream& out, const std::int32_t i) {
+  out.write(reinterpret_cast<const char*>(&i),sizeof(i));
+}
+void write_doubles (std::ofstream& out, const std::vector<double>& v) {
+  out.write(reinterpret_cast<const char*>(v.data()),sizeof(double)*v.size());
+}
+void write_feature (std::ofstream& out, const std::string& name, const int size) {
+  write_int(out,name.size());
+  out.write(name.data(),name.size());
+  write_int(out,size);
+}
+
+} // anonymous namespace
+
+TEST_CASE("ml_correction_native") {
+  using namespace scream::ml;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int ncols = 5;
+  const int nlevs = 8;
+  const int nhid  = 6;
+  const int n_in  = nlevs+1;
+  const int n_out = nlevs;
+
+  std::mt19937_64 engine(1234);
+  std::uniform_real_distribution<double> pdf(-1,1);
+  auto rand_vec = [&](const int n, const double shift) {
+    std::vector<double> v(n);
+    for (auto& x : v) x = pdf(engine)+shift;
+    return v;
+  };
+
+  // A two-layer dense model: (T_mid,lat) -> relu -> identity -> dQ1
+  const auto in_mean   = rand_vec(n_in,0);
+  const auto in_scale  = rand_vec(n_in,2);
+  const auto out_mean  = rand_vec(n_out,0);
+  const auto out_scale = rand_vec(n_out,2);
+  std::vector<Layer> layers = {
+    {n_in, nhid,  static_cast<int>(Activation::ReLU),     rand_vec(nhid*n_in,0),  rand_vec(nhid,0)},
+    {nhid, n_out, static_cast<int>(Activation::Identity), rand_vec(n_out*nhid,0), rand_vec(n_out,0)}
+  };
+
+  const std::string fname = "ml_native_model_np" + std::to_string(comm.size()) + ".bin";
+  if (comm.am_i_root()) {
+    std::ofstream out(fname,std::ios::binary);
+    out.write("EAMXXMLP",8);
+    write_int(out,1);
+    write_int(out,static_cast<int>(SampleLayout::Dense));
+    write_int(out,2);
+    write_feature(out,"T_mid",nlevs);
+    write_feature(out,"lat",1);
+    write_int(out,1);
+    write_feature(out,"dQ1",nlevs);
+    write_doubles(out,in_mean);
+    write_doubles(out,in_scale);
+    write_doubles(out,out_mean);
+    write_doubles(out,out_scale);
+    write_int(out,layers.size());
+    for (const auto& l : layers) {
+      write_int(out,l.n_in);
+      write_int(out,l.n_out);
+      write_int(out,l.act);
+      write_doubles(out,l.W);
+      write_doubles(out,l.b);
+    }
+  }
+  comm.barrier();
+
+  NativeMLModel model;
+  model.load(fname,comm);
+  model.setup(ncols,nlevs);
+
+  REQUIRE (model.layout()==SampleLayout::Dense);
+  REQUIRE (model.num_samples()==ncols);
+  REQUIRE (model.has_input("T_mid"));
+  REQUIRE (model.has_input("lat"));
+  REQUIRE (not model.has_input("qv"));
+  REQUIRE (model.get_input("lat").offset==nlevs);
+  REQUIRE (model.get_output("dQ1").size==nlevs);
+  REQUIRE_THROWS (model.get_output("dQ2"));
+
+  // Fill inputs
+  auto x = model.get_input_matrix();
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int i=0; i<ncols; ++i) {
+    for (int k=0; k<n_in; ++k) {
+      x_h(i,k) = pdf(engine);
+    }
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  model.predict();
+
+  auto y_h = Kokkos::create_mirror_view(model.get_output_matrix());
+  Kokkos::deep_copy(y_h,model.get_output_matrix());
+
+  // Compare against a host evaluation of the same network
+  const double tol = std::is_same<Real,double>::value ? 1e-12 : 1e-5;
+  for (int i=0; i<ncols; ++i) {
+    std::vector<double> a(n_in);
+    for (int k=0; k<n_in; ++k) {
+      a[k] = (x_h(i,k)-in_mean[k])/in_scale[k];
+    }
+    for (const auto& l : layers) {
+      std::vector<double> z(l.n_out);
+      for (int j=0; j<l.n_out; ++j) {
+        z[j] = l.b[j];
+        for (int k=0; k<l.n_in; ++k) {
+          z[j] += l.W[j*l.n_in+k]*a[k];
+        }
+        if (l.act==static_cast<int>(Activation::ReLU)) {
+          z[j] = std::max(z[j],0.0);
+        }
+      }
+      a = z;
+    }
+    for (int j=0; j<n_out; ++j) {
+      const double expected = a[j]*out_scale[j]+out_mean[j];
+      REQUIRE (std::abs(y_h(i,j)-expected) <= tol*std::max(1.0,std::abs(expected)));
+    }
+  }
+
+  // Cosine of zenith angle must be a cosine, and the sun is up at noon on the equator at the equinox
+  REQUIRE (std::abs(cos_zenith_angle(0.0,45,30))<=1);
+  const double equinox = 79.0;   // 2000-03-20 12:00:00
+  REQUIRE (cos_zenith_angle(equinox,0,0)>0.95);
+  REQUIRE (cos_zenith_angle(equinox,0,180)<-0.95);
+}
+
+} // namespace scream
@@ -444,15 +444,31 @@ void test_exports(const FieldManager& fm,
       EKAT_REQUIRE(std::abs(Faxa_lwdn_file - export_data_view(i, export_cpl_indices_view(16)))<test_tol);
     }
   }
+
+  // The cpl fields not exported by scream are set to 0
+  const int num_cpl_exports = export_data_view.extent(1);
+  std::vector<bool> is_scream_export(num_cpl_exports,false);
+  for (size_t f=0; f<export_cpl_indices_view.size(); ++f) {
+    is_scream_export[export_cpl_indices_view(f)] = true;
+  }
+  for (int i=0; i<ncols; ++i) {
+    for (int icpl=0; icpl<num_cpl_exports; ++icpl) {
+      if (not is_scream_export[icpl]) {
+        EKAT_REQUIRE(0 == export_data_view(i, icpl));
+      }
+    }
+  }
 }
 
-TEST_CASE("surface-coupling", "") {
+// Runs the AD for one step, with the given value of the exporter option async_export.
+// Returns the cpl export data after the initialization and after the run.
+std::pair<KokkosTypes<HostDevice>::view_2d<Real>,KokkosTypes<HostDevice>::view_2d<Real>>
+run_surface_coupling (const ekat::Comm& atm_comm, const int seed, const bool async_export)
+{
   using namespace scream;
   using namespace scream::control;
 
-  // Create a comm
-  ekat::Comm atm_comm (MPI_COMM_WORLD);
-  auto engine = setup_random_test(&atm_comm);
+  auto engine = setup_random_test(seed);
 
   // Load ad parameter list
   std::string fname = "input.yaml";
@@ -474,6 +490,7 @@ TEST_CASE("surface-coupling", "") {
 
   auto& ap_params     = ad_params.sublist("atmosphere_processes");
   auto& sc_exp_params = ap_params.sublist("SurfaceCouplingExporter");
+  sc_exp_params.set("async_export",async_export);
   // Set up forcing to a constant value
   const Real Faxa_swndf_const = pdf_real_constant_data(engine);
   const Real Faxa_swvdf_const = pdf_real_constant_data(engine);
@@ -629,6 +646,8 @@ TEST_CASE("surface-coupling", "") {
                import_constant_multiple_view, true);
   test_exports(*fm, export_data_view, export_cpl_indices_view,
                export_constant_multiple_view,  exp_const_params, dt, true);
+  KokkosTypes<HostDevice>::view_2d<Real> exports_init("exports_init",ncols,num_cpl_exports);
+  Kokkos::deep_copy(exports_init,export_data_view);
 
   // Run the AD
   ad.run(dt);
@@ -638,9 +657,41 @@ TEST_CASE("surface-coupling", "") {
                import_constant_multiple_view);
   test_exports(*fm, export_data_view, export_cpl_indices_view,
                export_constant_multiple_view, exp_const_params, dt);
+  KokkosTypes<HostDevice>::view_2d<Real> exports_run("exports_run",ncols,num_cpl_exports);
+  Kokkos::deep_copy(exports_run,export_data_view);
 
   // Finalize  the AD
   ad.finalize();
+
+  return std::make_pair(exports_init,exports_run);
+}
+
+TEST_CASE("surface-coupling", "") {
+  // Create a comm
+  ekat::Comm atm_comm (MPI_COMM_WORLD);
+  const int seed = get_random_test_seed(&atm_comm);
+
+  const auto sync_exports  = run_surface_coupling(atm_comm,seed,false);
+  const auto async_exports = run_surface_coupling(atm_comm,seed,true);
+
+  // Completing the export at the end of the step gives the same cpl data
+  // as the export during the exporter run
+  auto same_exports = [](const KokkosTypes<HostDevice>::view_2d<Real>& a,
+                         const KokkosTypes<HostDevice>::view_2d<Real>& b) {
+    if (a.extent(0)!=b.extent(0) || a.extent(1)!=b.extent(1)) {
+      return false;
+    }
+    for (size_t i=0; i<a.extent(0); ++i) {
+      for (size_t j=0; j<a.extent(1); ++j) {
+        if (a(i,j)!=b(i,j)) {
+          return false;
+        }
+      }
+    }
+    return true;
+  };
+  REQUIRE (same_exports(sync_exports.first,async_exports.first));
+  REQUIRE (same_exports(sync_exports.second,async_exports.second));
 }
 
 } // empty namespace
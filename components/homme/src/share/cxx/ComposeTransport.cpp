@@ -76,9 +76,10 @@ ComposeTransport::run_unit_tests () {
 }
 
 ComposeTransport::TestDepView::HostMirror ComposeTransport::
-test_trajectory (Real t0, Real t1, const bool independent_time_steps) {
+test_trajectory (Real t0, Real t1, const bool independent_time_steps,
+                 const bool overlap_dss) {
   assert(is_setup);
-  return m_compose_impl->test_trajectory(t0, t1, independent_time_steps);
+  return m_compose_impl->test_trajectory(t0, t1, independent_time_steps, overlap_dss);
 }
 
 void ComposeTransport::test_2d (const bool bfb, const int nstep, std::vector<Real>& eval) {
@@ -44,7 +44,8 @@ public:
   std::vector<std::pair<std::string, int> > run_unit_tests();
 
   typedef Kokkos::View<Real*****, Kokkos::LayoutRight> TestDepView;
-  TestDepView::HostMirror test_trajectory(Real t0, Real t1, bool independent_time_steps);
+  TestDepView::HostMirror test_trajectory(Real t0, Real t1, bool independent_time_steps,
+                                          bool overlap_dss = false);
 
   void test_2d(const bool bfb, const int nstep, std::vector<Real>& eval);
 
@@ -59,16 +59,22 @@ struct ComposeTransportImpl {
     int geometry_type; // 0: sphere, 1: plane
     Real nu_q, hv_scaling, dp_tol;
     bool independent_time_steps;
+    // Overlap the velocity DSS in calc_trajectory with the computation of the
+    // midpoint velocity on the elements with no shared connection.
+    bool overlap_trajectory_dss;
 
     Buf1 buf1[3];
     Buf2 buf2[2];
 
     DeparturePoints dep_pts;
 
+    // 1 if the element has a connection shared with another rank, 0 otherwise.
+    ExecViewManaged<int*> elem_shared;
+
     Data ()
       : nelemd(-1), qsize(-1), limiter_option(9), cdr_check(0), hv_q(0),
         hv_subcycle_q(0), geometry_type(0), nu_q(0), hv_scaling(0), dp_tol(-1),
-        independent_time_steps(false)
+        independent_time_steps(false), overlap_trajectory_dss(false)
     {}
   };
 
@@ -116,7 +122,8 @@ struct ComposeTransportImpl {
 
   int run_trajectory_unit_tests();
   ComposeTransport::TestDepView::HostMirror
-  test_trajectory(Real t0, Real t1, const bool independent_time_steps);
+  test_trajectory(Real t0, Real t1, const bool independent_time_steps,
+                  const bool overlap_dss);
 
   // In test code, the bfb flag says to construct manufactured fields on host to
   // avoid non-bfb-ness in, e.g., trig functions.
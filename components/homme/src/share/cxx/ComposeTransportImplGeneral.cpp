@@ -79,6 +79,7 @@ void ComposeTransportImpl::reset (const SimulationParams& params) {
       m_data.dep_pts);
   }
   m_data.independent_time_steps = independent_time_steps;
+  m_data.overlap_trajectory_dss = params.compose_overlap_trajectory_dss;
   if (m_data.nelemd == num_elems && m_data.qsize == params.qsize) return;
 
   m_data.qsize = params.qsize;
@@ -160,6 +161,18 @@ void ComposeTransportImpl::init_boundary_exchanges () {
     be->registration_completed();
   }
 
+  { // Elements with shared connections, to split the velocity DSS.
+    const auto& connectivity = Context::singleton().get<Connectivity>();
+    const auto ucon = connectivity.get_h_ucon();
+    m_data.elem_shared = ExecViewManaged<int*>("elem_shared", m_data.nelemd);
+    const auto elem_shared = Kokkos::create_mirror_view(m_data.elem_shared);
+    Kokkos::deep_copy(elem_shared, 0);
+    for (int iconn = 0; iconn < ucon.extent_int(0); ++iconn)
+      if (ucon(iconn).sharing == etoi(ConnectionSharing::SHARED))
+        elem_shared(ucon(iconn).local.lid) = 1;
+    Kokkos::deep_copy(m_data.elem_shared, elem_shared);
+  }
+
   // For optional HV applied to q.
   if (m_data.hv_q > 0 && m_data.nu_q > 0) {
     for (int i = 0; i < 2; ++i) {
@@ -352,6 +352,11 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
   const auto m_vec_sph2cart = geo.m_vec_sph2cart;
   const auto m_vstar = m_derived.m_vstar;
   const auto tu_ne = m_tu_ne;
+  // In overlap mode, rely on the ordering of the kernels on the device and
+  // fence only before MPI or host work.
+  const bool overlap = m_data.overlap_trajectory_dss;
+  const auto fence = [&] () { if ( ! overlap) Kokkos::fence(); };
+  const auto be = m_v_dss_be[m_data.independent_time_steps ? 1 : 0];
   { // Calculate midpoint velocity.
     const auto buf1a = m_data.buf1[0]; const auto buf1b = m_data.buf1[1];
     const auto buf1c = m_data.buf1[2]; const auto buf2a = m_data.buf2[0];
@@ -377,7 +382,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
           m_vn0(ie,d,i,j,lev) = m_v(ie,np1,d,i,j,lev);
       };
       launch_ie_packlev_ij(copy_v);
-      Kokkos::fence();
+      fence();
       const auto calc_dprecon = KOKKOS_LAMBDA (const MT& team) {
         KernelVariables kv(team, tu_ne);
         const auto ie = kv.ie;
@@ -393,7 +398,7 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
           dprecon);
       };
       Kokkos::parallel_for(m_tp_ne, calc_dprecon);
-      Kokkos::fence();
+      fence();
       remap_v(m_dp3d, np1, m_divdp, m_vn0);
       const auto sphere = KOKKOS_LAMBDA (const MT& team) {
         KernelVariables kv(team, tu_ne);
@@ -406,41 +411,57 @@ void ComposeTransportImpl::calc_trajectory (const int np1, const Real dt) {
         };
         cti::loop_ijk<num_lev_pack>(kv, f);
       };
-      Kokkos::fence();
+      fence();
       Kokkos::parallel_for(m_tp_ne, sphere);
-      Kokkos::fence();
+      fence();
       GPTLstop("compose_3d_levels");
     }
     GPTLstart("compose_v_bexchv");
-    const auto calc_midpoint_velocity = KOKKOS_LAMBDA (const MT& team) {
-      KernelVariables kv(team, tu_ne);
-      const auto ie = kv.ie;
-      const auto vn0 = (independent_time_steps ?
-                        Homme::subview(m_vn0, ie) :
-                        Homme::subview(m_v, ie, np1));
-      const auto vstar = Homme::subview(m_vstar, ie);
-      const auto spheremp = Homme::subview(m_spheremp, ie);
-      const auto rspheremp = Homme::subview(m_rspheremp, ie);
-      const auto ugradv = S2Nlev(Homme::subview(buf2b, kv.team_idx).data());
-      ugradv_sphere(sphere_ops, kv, Homme::subview(m_vec_sph2cart, ie), vn0, vstar,
-                    SNlev(Homme::subview(buf1a, kv.team_idx).data()),
-                    S2Nlev(Homme::subview(buf2a, kv.team_idx).data()),
-                    ugradv);
-      // Write the midpoint velocity to vstar.
-      const auto f = [&] (const int i, const int j, const int k) {
-        for (int d = 0; d < 2; ++d)
-          vstar(d,i,j,k) = (((vn0(d,i,j,k) + vstar(d,i,j,k))/2 - dt*ugradv(d,i,j,k)/2)*
-                            spheremp(i,j)*rspheremp(i,j));
+    const auto elem_shared = m_data.elem_shared;
+    // In overlap mode, compute the elements with shared connections first and
+    // send them while the other elements are computed.
+    const int nphase = overlap ? 2 : 1;
+    for (int phase = 0; phase < nphase; ++phase) {
+      // If shared >= 0, compute only the elements with elem_shared(ie) == shared.
+      const int shared = overlap ? 1 - phase : -1;
+      const auto calc_midpoint_velocity = KOKKOS_LAMBDA (const MT& team) {
+        if (shared >= 0 && elem_shared(team.league_rank()) != shared) return;
+        KernelVariables kv(team, tu_ne);
+        const auto ie = kv.ie;
+        const auto vn0 = (independent_time_steps ?
+                          Homme::subview(m_vn0, ie) :
+                          Homme::subview(m_v, ie, np1));
+        const auto vstar = Homme::subview(m_vstar, ie);
+        const auto spheremp = Homme::subview(m_spheremp, ie);
+        const auto rspheremp = Homme::subview(m_rspheremp, ie);
+        const auto ugradv = S2Nlev(Homme::subview(buf2b, kv.team_idx).data());
+        ugradv_sphere(sphere_ops, kv, Homme::subview(m_vec_sph2cart, ie), vn0, vstar,
+                      SNlev(Homme::subview(buf1a, kv.team_idx).data()),
+                      S2Nlev(Homme::subview(buf2a, kv.team_idx).data()),
+                      ugradv);
+        // Write the midpoint velocity to vstar.
+        const auto f = [&] (const int i, const int j, const int k) {
+          for (int d = 0; d < 2; ++d)
+            vstar(d,i,j,k) = (((vn0(d,i,j,k) + vstar(d,i,j,k))/2 - dt*ugradv(d,i,j,k)/2)*
+                              spheremp(i,j)*rspheremp(i,j));
+        };
+        cti::loop_ijk<num_lev_pack>(kv, f);
       };
-      cti::loop_ijk<num_lev_pack>(kv, f);
-    };
-    Kokkos::parallel_for(m_tp_ne, calc_midpoint_velocity);
+      Kokkos::parallel_for(m_tp_ne, calc_midpoint_velocity);
+      if (overlap) {
+        if (phase == 0) be->pack_and_send_shared();
+        else            be->pack_local();
+      }
+    }
   }
   { // DSS velocity.
-    Kokkos::fence();
-    const auto be = m_v_dss_be[m_data.independent_time_steps ? 1 : 0];
-    be->exchange();
-    Kokkos::fence();
+    if (overlap) {
+      be->recv_and_unpack();
+    } else {
+      Kokkos::fence();
+      be->exchange();
+      Kokkos::fence();
+    }
   }
   GPTLstop("compose_v_bexchv");
   { // Calculate departure point.
@@ -644,12 +665,15 @@ int ComposeTransportImpl::run_trajectory_unit_tests () {
 }
 
 ComposeTransport::TestDepView::HostMirror ComposeTransportImpl::
-test_trajectory (Real t0, Real t1, const bool independent_time_steps) {
+test_trajectory (Real t0, Real t1, const bool independent_time_steps,
+                 const bool overlap_dss) {
   using Kokkos::create_mirror_view;
   using Kokkos::deep_copy;
 
   const bool its_save = m_data.independent_time_steps;
   m_data.independent_time_steps = independent_time_steps;
+  const bool overlap_save = m_data.overlap_trajectory_dss;
+  m_data.overlap_trajectory_dss = overlap_dss;
 
   const auto vstar = create_mirror_view(m_derived.m_vstar);
   const auto vn0 = create_mirror_view(m_derived.m_vn0);
@@ -683,6 +707,7 @@ test_trajectory (Real t0, Real t1, const bool independent_time_steps) {
   Kokkos::fence();
 
   m_data.independent_time_steps = its_save;
+  m_data.overlap_trajectory_dss = overlap_save;
   const auto deph = cti::cmvdc(m_data.dep_pts);
   return deph;
 }
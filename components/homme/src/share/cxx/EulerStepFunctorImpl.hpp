@@ -60,10 +60,18 @@ struct SerialLimiter<HommexxGPU> {
 class EulerStepFunctorImpl {
   struct EulerStepData {
     EulerStepData ()
-      : qsize(-1), limiter_option(0), nu_p(0), nu_q(0), consthv(1)
+      : qsize(-1), block_size(0), q_beg(0), q_num(-1)
+      , limiter_option(0), nu_p(0), nu_q(0), consthv(1)
     {}
 
     int   qsize;
+
+    // Tracers are processed in blocks of block_size (0: all at once). The
+    // tracer kernels only act on tracers [q_beg,q_beg+q_num).
+    int   block_size;
+    int   q_beg;
+    int   q_num;
+
     int   limiter_option;
     Real  rhs_viss;
     Real  rhs_multiplier;
@@ -113,6 +121,11 @@ class EulerStepFunctorImpl {
   std::shared_ptr<BoundaryExchange> m_mm_be, m_mmqb_be;
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, 3*Q_NUM_TIME_LEVELS> m_bes;
 
+  // Per tracer block exchanges, only used if 0<block_size<qsize
+  using be_list = std::vector<std::shared_ptr<BoundaryExchange>>;
+  be_list m_mmqb_block_bes;
+  Kokkos::Array<be_list, 3*Q_NUM_TIME_LEVELS> m_block_bes;
+
   enum { m_mem_per_team = 2 * NP * NP * sizeof(Real) };
 
 public:
@@ -161,6 +174,9 @@ public:
   void reset (const SimulationParams& params) {
     m_data.rhs_viss = 0.0;
     m_data.qsize = params.qsize;
+    m_data.block_size = params.euler_tracer_block_size;
+    m_data.q_beg = 0;
+    m_data.q_num = params.qsize;
     m_data.limiter_option = params.limiter_option;
     m_data.nu_p = params.nu_p;
     m_data.nu_q = params.nu_q;
@@ -271,6 +287,74 @@ public:
       be.register_min_max_fields(m_tracers.qlim, m_data.qsize, 0);
       be.registration_completed();
     }
+
+    // With tracer blocks, each block has its own exchanges. The DSS of the
+    // extra field is done with the first block.
+    m_mmqb_block_bes.clear();
+    for (auto& bes : m_block_bes) {
+      bes.clear();
+    }
+    if (m_data.block_size > 0 && m_data.block_size < m_data.qsize) {
+      for (int ib = 0; ib < num_tracer_blocks(); ++ib) {
+        set_tracer_block(ib);
+        const int q_beg = m_data.q_beg;
+        const int q_num = m_data.q_num;
+        for (int np1_qdp = 0, k = 0; np1_qdp < Q_NUM_TIME_LEVELS; ++np1_qdp) {
+          for (auto dssi : dss_vars) {
+            const bool extra = ib==0;
+            const int num_mid = (extra && dssi!=DSSOption::ETA) ? 1 : 0;
+            const int num_int = (extra && dssi==DSSOption::ETA) ? 1 : 0;
+            auto be = std::make_shared<BoundaryExchange>();
+            be->set_buffers_manager(bm_exchange);
+            be->set_num_fields(0, 0, q_num+num_mid, num_int);
+            be->register_field(m_tracers.qdp, np1_qdp, q_num, q_beg);
+            if (extra) {
+              switch(dssi) {
+                case DSSOption::ETA:
+                  be->register_field(m_derived_state.m_eta_dot_dpdn);
+                  break;
+                case DSSOption::OMEGA:
+                  be->register_field(m_derived_state.m_omega_p);
+                  break;
+                case DSSOption::DIV_VDP_AVE:
+                  be->register_field(m_derived_state.m_divdp_proj);
+                  break;
+              }
+            }
+            be->registration_completed();
+            m_block_bes[k].push_back(be);
+            ++k;
+          }
+        }
+
+        auto be = std::make_shared<BoundaryExchange>();
+        be->set_buffers_manager(bm_exchange);
+        be->set_num_fields(0, 0, q_num);
+        be->register_field(m_tracers.qtens_biharmonic, q_num, q_beg);
+        be->registration_completed();
+        m_mmqb_block_bes.push_back(be);
+      }
+      set_tracer_block(-1);
+    }
+  }
+
+  bool use_tracer_blocks () const {
+    return !m_mmqb_block_bes.empty();
+  }
+
+  int num_tracer_blocks () const {
+    return (m_data.qsize + m_data.block_size - 1) / m_data.block_size;
+  }
+
+  // Restrict the tracer kernels to block ib; ib<0 selects all tracers.
+  void set_tracer_block (const int ib) {
+    if (ib < 0) {
+      m_data.q_beg = 0;
+      m_data.q_num = m_data.qsize;
+    } else {
+      m_data.q_beg = ib*m_data.block_size;
+      m_data.q_num = std::min(m_data.block_size, m_data.qsize - m_data.q_beg);
+    }
   }
 
   static size_t limiter_team_shmem_size (const int team_size) {
@@ -302,11 +386,11 @@ public:
 
     if(m_data.nu_p > 0){
     Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+                           m_geometry.num_elems() * m_data.q_num, m_tpref),
                          *this);
     }else{
     Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPreNoNup>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+                           m_geometry.num_elems() * m_data.q_num, m_tpref),
                          *this);
 
     }
@@ -321,11 +405,11 @@ public:
 
     if(m_data.consthv){
     Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostConstHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+                           m_geometry.num_elems() * m_data.q_num, m_tpref),
                          *this);
     }else{
     Kokkos::parallel_for(Homme::get_default_team_policy<ExecSpace, BIHPostTensorHV>(
-                           m_geometry.num_elems() * m_data.qsize, m_tpref),
+                           m_geometry.num_elems() * m_data.q_num, m_tpref),
                          *this);
     }
     Kokkos::fence();
@@ -335,7 +419,8 @@ public:
 //case when nu_p > 0
   KOKKOS_INLINE_FUNCTION
   void operator() (const BIHPreNup&, const TeamMember& team) const {
-    KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.q_num, m_tu_ne_qsize);
+    kv.iq += m_data.q_beg;
     const auto qtens_biharmonic = Homme::subview(m_tracers.qtens_biharmonic, kv.ie, kv.iq);
     dpdiss_adjustment(kv, team);
     m_sphere_ops.laplace_simple(kv, qtens_biharmonic, qtens_biharmonic);
@@ -344,7 +429,8 @@ public:
 //case when nu_p == 0
   KOKKOS_INLINE_FUNCTION
   void operator() (const BIHPreNoNup&, const TeamMember& team) const {
-    KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.q_num, m_tu_ne_qsize);
+    kv.iq += m_data.q_beg;
     const auto qtens_biharmonic = Homme::subview(m_tracers.qtens_biharmonic, kv.ie, kv.iq);
     m_sphere_ops.laplace_simple(kv, qtens_biharmonic, qtens_biharmonic);
   }
@@ -372,7 +458,8 @@ public:
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const BIHPostConstHV&, const TeamMember& team) const {
-    KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.q_num, m_tu_ne_qsize);
+    kv.iq += m_data.q_beg;
     const auto qtens_biharmonic = Homme::subview(m_tracers.qtens_biharmonic, kv.ie, kv.iq);
     team.team_barrier();
     m_sphere_ops.laplace_simple(kv, qtens_biharmonic, qtens_biharmonic);
@@ -382,7 +469,8 @@ public:
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const BIHPostTensorHV&, const TeamMember& team) const {
-    KernelVariables kv(team,m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.q_num, m_tu_ne_qsize);
+    kv.iq += m_data.q_beg;
     const auto qtens_biharmonic = Homme::subview(m_tracers.qtens_biharmonic, kv.ie, kv.iq);
     const auto tensor = Homme::subview(m_geometry.m_tensorvisc, kv.ie);
     team.team_barrier();
@@ -416,20 +504,34 @@ public:
   struct AALTracerPhase {};
 
   void advect_and_limit() {
+    advect_and_limit_setup();
+    advect_and_limit_tracers();
+  }
+
+  void advect_and_limit_setup() {
     profiling_resume();
     Kokkos::parallel_for(
       Homme::get_default_team_policy<ExecSpace, AALSetupPhase>(
         m_geometry.num_elems(), m_tpref),
       *this);
     Kokkos::fence();
+    profiling_pause();
+  }
+
+  void advect_and_limit_tracers() {
+    profiling_resume();
     m_kernel_will_run_limiters = true;
+    auto& tuner = Context::singleton().create_if_not_there<PolicyTuner>();
+    tuner.start("euler_aal_tracer");
     Kokkos::parallel_for(
       //to play with launch bounds
       //Homme::get_default_team_policy<ExecSpace, AALTracerPhase, Kokkos::LaunchBounds<128,1> >(
-      Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
-        m_geometry.num_elems() * m_data.qsize, m_tpref),
+      tuner.tuned_policy("euler_aal_tracer",
+        Homme::get_default_team_policy<ExecSpace, AALTracerPhase >(
+          m_geometry.num_elems() * m_data.q_num, m_tpref)),
       *this);
     Kokkos::fence();
+    tuner.stop("euler_aal_tracer");
     m_kernel_will_run_limiters = false;
     profiling_pause();
   }
@@ -442,7 +544,8 @@ public:
 
   KOKKOS_INLINE_FUNCTION
   void operator() (const AALTracerPhase&, const TeamMember& team) const {
-    KernelVariables kv(team, m_data.qsize, m_tu_ne_qsize);
+    KernelVariables kv(team, m_data.q_num, m_tu_ne_qsize);
+    kv.iq += m_data.q_beg;
     run_tracer_phase(kv);
   }
 
@@ -589,12 +692,46 @@ public:
 
   void minmax_and_biharmonic() {
     neighbor_minmax_start();
-    compute_biharmonic_pre();
-    m_mmqb_be->exchange(m_geometry.m_rspheremp);
-    compute_biharmonic_post();
+    if (use_tracer_blocks()) {
+      run_tracer_blocks([&](){ compute_biharmonic_pre(); },
+                        m_mmqb_block_bes,
+                        [&](){ compute_biharmonic_post(); });
+    } else {
+      compute_biharmonic_pre();
+      m_mmqb_be->exchange(m_geometry.m_rspheremp);
+      compute_biharmonic_post();
+    }
     neighbor_minmax_finish();
   }
 
+  // Run the tracer kernels one block at a time, so that the exchange of a block
+  // is in flight while the next block is computed. For block ib, the order is
+  //   pre(ib), finish exchange of ib-1, start exchange of ib, post(ib-1).
+  // Only one exchange at a time can use the MPI buffers, hence the
+  // finish-before-start order. Starting an exchange posts its receives before
+  // packing, so that the messages can move while pre(ib+1) runs.
+  template <typename Pre, typename Post>
+  void run_tracer_blocks (const Pre& pre, const be_list& bes, const Post& post) {
+    const ExecViewUnmanaged<const Real * [NP][NP]> rspheremp = m_geometry.m_rspheremp;
+    const int nblocks = bes.size();
+    for (int ib = 0; ib < nblocks; ++ib) {
+      set_tracer_block(ib);
+      pre();
+      if (ib > 0) {
+        bes[ib-1]->recv_and_unpack(rspheremp);
+      }
+      bes[ib]->start_recv_and_pack_and_send();
+      if (ib > 0) {
+        set_tracer_block(ib-1);
+        post();
+      }
+    }
+    bes[nblocks-1]->recv_and_unpack(rspheremp);
+    set_tracer_block(nblocks-1);
+    post();
+    set_tracer_block(-1);
+  }
+
   void neighbor_minmax() {
     assert(m_mm_be->is_registration_completed());
     m_mm_be->exchange_min_max();
@@ -652,8 +789,18 @@ public:
         minmax_and_biharmonic();
       }
     }
-    advect_and_limit();
-    exchange_qdp_dss_var();
+    if (use_tracer_blocks()) {
+      advect_and_limit_setup();
+      GPTLstart("eus_tracer_blocks");
+      const int idx = 3*m_data.np1_qdp + static_cast<int>(m_data.DSSopt);
+      run_tracer_blocks([&](){ advect_and_limit_tracers(); },
+                        m_block_bes[idx],
+                        [](){});
+      GPTLstop("eus_tracer_blocks");
+    } else {
+      advect_and_limit();
+      exchange_qdp_dss_var();
+    }
   }
 
 private:
@@ -6,6 +6,10 @@
 
 #include <cassert>
 
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
 #include <sstream>
 #include <vector>
 
@@ -204,4 +208,160 @@ team_num_threads_vectors (const int num_parallel_iterations,
     num_parallel_iterations, tp);
 }
 
+PolicyTuner::PolicyTuner ()
+ : m_num_reps (0)
+ , m_file_name ("hommexx_autotune.dat")
+ , m_write_file (false)
+{
+  const char* steps = std::getenv("HOMMEXX_AUTOTUNE_STEPS");
+  if (steps) {
+    m_num_reps = std::max(0,std::atoi(steps));
+  }
+  const char* file = std::getenv("HOMMEXX_AUTOTUNE_FILE");
+  if (file) {
+    m_file_name = file;
+  }
+}
+
+void PolicyTuner::
+set_problem (const int nelem, const int nlev, const int qsize,
+             const int nthreads, const bool write_file,
+             const std::function<void(std::vector<double>&)>& reduce_max)
+{
+  std::stringstream ss;
+  ss << nelem << " " << nlev << " " << qsize << " " << nthreads;
+  m_problem = ss.str();
+  m_write_file = write_file;
+  m_reduce_max = reduce_max;
+  m_kernels.clear();
+  read_file();
+}
+
+void PolicyTuner::start (const std::string& kernel)
+{
+  auto it = m_kernels.find(kernel);
+  if (it==m_kernels.end() || it->second.locked) {
+    return;
+  }
+  Kokkos::fence();
+  it->second.t0 = std::chrono::steady_clock::now();
+}
+
+void PolicyTuner::stop (const std::string& kernel)
+{
+  auto it = m_kernels.find(kernel);
+  if (it==m_kernels.end() || it->second.locked) {
+    return;
+  }
+  Kokkos::fence();
+  auto& kt = it->second;
+  const std::chrono::duration<double> dt = std::chrono::steady_clock::now() - kt.t0;
+
+  // The first run of each candidate is a warm up
+  if (kt.irep>0) {
+    kt.times[kt.icand] += dt.count();
+  }
+  if (++kt.irep <= m_num_reps) {
+    return;
+  }
+  kt.irep = 0;
+  if (++kt.icand < static_cast<int>(kt.candidates.size())) {
+    return;
+  }
+
+  // All candidates were timed. Pick the fastest, using the slowest rank's timing.
+  if (m_reduce_max) {
+    m_reduce_max(kt.times);
+  }
+  int ibest = 0;
+  for (int i=1; i<static_cast<int>(kt.times.size()); ++i) {
+    if (kt.times[i]<kt.times[ibest]) {
+      ibest = i;
+    }
+  }
+  kt.best = kt.candidates[ibest];
+  kt.locked = true;
+  m_file_entries[key(kernel)] = kt.best;
+  if (m_write_file) {
+    write_file();
+  }
+}
+
+PolicyTuner::config_type PolicyTuner::
+select (const std::string& kernel, const config_type& default_config, const bool on_gpu)
+{
+  auto it = m_kernels.find(kernel);
+  if (it==m_kernels.end()) {
+    KernelTuning kt;
+    const auto entry = m_file_entries.find(key(kernel));
+    if (entry!=m_file_entries.end()) {
+      kt.locked = true;
+      kt.best = on_gpu ? entry->second : default_config;
+    } else if (m_num_reps>0) {
+      // The default always comes first. The other candidates are the same for
+      // all ranks, so that all ranks time the same number of candidates.
+      kt.candidates.push_back(default_config);
+      if (on_gpu) {
+        for (const int nthreads : {128, 256}) {
+          for (const int nvectors : {4, 8, 16, 32}) {
+            // Team threads are always distributed over the NP*NP gll points.
+            if (nthreads/nvectors <= NP*NP) {
+              kt.candidates.emplace_back(nthreads/nvectors,nvectors);
+            }
+          }
+        }
+      }
+      kt.times.assign(kt.candidates.size(),0);
+    } else {
+      kt.locked = true;
+      kt.best = default_config;
+    }
+    it = m_kernels.emplace(kernel,kt).first;
+  }
+
+  const auto& kt = it->second;
+  return kt.locked ? kt.best : kt.candidates[kt.icand];
+}
+
+std::string PolicyTuner::key (const std::string& kernel) const
+{
+  // The tuning file is whitespace separated
+  std::string name = kernel;
+  std::replace(name.begin(),name.end(),' ','_');
+  return name + " " + m_problem;
+}
+
+void PolicyTuner::read_file ()
+{
+  std::ifstream in(m_file_name);
+  std::string line;
+  while (std::getline(in,line)) {
+    if (line.empty() || line[0]=='#') {
+      continue;
+    }
+    std::stringstream ss(line);
+    std::string kernel;
+    int nelem, nlev, qsize, nthreads, team_size, vector_length;
+    if (ss >> kernel >> nelem >> nlev >> qsize >> nthreads >> team_size >> vector_length) {
+      std::stringstream k;
+      k << kernel << " " << nelem << " " << nlev << " " << qsize << " " << nthreads;
+      m_file_entries[k.str()] = std::make_pair(team_size,vector_length);
+    }
+  }
+}
+
+void PolicyTuner::write_file () const
+{
+  std::ofstream out(m_file_name);
+  if (!out.good()) {
+    // Not fatal: the tuned configurations are still used in this run
+    std::cerr << "WARNING: could not open the autotune file '" << m_file_name << "' for writing.\n";
+    return;
+  }
+  out << "# kernel nelem nlev qsize nthreads team_size vector_length\n";
+  for (const auto& it : m_file_entries) {
+    out << it.first << " " << it.second.first << " " << it.second.second << "\n";
+  }
+}
+
 } // namespace Homme
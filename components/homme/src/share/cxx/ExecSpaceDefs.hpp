@@ -8,6 +8,11 @@
 #define HOMMEXX_EXEC_SPACE_DEFS_HPP
 
 #include <cassert>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
 #ifdef HOMMEXX_BFB_TESTING
 #include <tuple>
 #endif
@@ -177,6 +182,91 @@ get_default_team_policy(const int num_parallel_iterations,
   return policy;
 }
 
+// Opt-in run-time tuning of the (team size, vector length) pair of the main
+// kernels. The heuristics above are good defaults, but the best choice depends
+// on the device and on the problem (e.g., nlev=72 vs nlev=128).
+//   Tuning is enabled by setting the env var HOMMEXX_AUTOTUNE_STEPS=N. For each
+// tuned kernel, every candidate configuration is then run N+1 times (the first
+// run is a warm up), and the fastest (max over ranks) is locked in. Results are
+// stored in the file named by HOMMEXX_AUTOTUNE_FILE (default:
+// hommexx_autotune.dat), keyed by kernel, number of elements, nlev, qsize and
+// number of threads, and reused on later runs, even if N=0.
+//   The candidates only differ from the default on GPU: on CPU the team size is
+// tied to the TeamUtils workspace indexing, and vectorization is done by the
+// compiler, so the tuner always returns the default policy there.
+//   Usage in a functor:
+//     auto& tuner = Context::singleton().create_if_not_there<PolicyTuner>();
+//     const auto policy = tuner.tuned_policy("my kernel",m_policy);
+//     tuner.start("my kernel");
+//     Kokkos::parallel_for(policy,*this);
+//     tuner.stop("my kernel");
+class PolicyTuner {
+public:
+  PolicyTuner ();
+
+  // Set the problem description (used as key in the tuning file), and whether
+  // this rank writes the tuning file. If provided, reduce_max is used to take
+  // the max of the timings over all ranks, so that all ranks pick the same
+  // configuration; it is called collectively by all ranks.
+  void set_problem (const int nelem, const int nlev, const int qsize,
+                    const int nthreads, const bool write_file,
+                    const std::function<void(std::vector<double>&)>& reduce_max = nullptr);
+
+  // Whether this tuner can return anything other than the input policy.
+  bool enabled () const {
+    return !m_problem.empty() && (m_num_reps>0 || !m_file_entries.empty());
+  }
+
+  // Return a policy with the same league size as the input policy, and the
+  // (team size, vector length) pair to be used for this kernel.
+  template <typename ExecSpaceType, typename... Tags>
+  Kokkos::TeamPolicy<ExecSpaceType,Tags...>
+  tuned_policy (const std::string& kernel,
+                const Kokkos::TeamPolicy<ExecSpaceType,Tags...>& policy) {
+    if (!enabled()) {
+      return policy;
+    }
+    const auto tv = select(kernel, std::make_pair(policy.team_size(),policy.impl_vector_length()),
+                           OnGpu<ExecSpaceType>::value);
+    auto tuned = Kokkos::TeamPolicy<ExecSpaceType,Tags...>(policy.league_size(),tv.first,tv.second);
+    tuned.set_chunk_size(1);
+    return tuned;
+  }
+
+  // Time the kernel launch(es) between these calls, if the kernel is being tuned.
+  void start (const std::string& kernel);
+  void stop (const std::string& kernel);
+
+private:
+
+  using config_type = std::pair<int,int>;
+
+  struct KernelTuning {
+    std::vector<config_type> candidates;
+    std::vector<double>      times;
+    int  icand  = 0;
+    int  irep   = 0;
+    bool locked = false;
+    config_type best;
+    std::chrono::steady_clock::time_point t0;
+  };
+
+  config_type select (const std::string& kernel, const config_type& default_config, const bool on_gpu);
+  std::string key (const std::string& kernel) const;
+  void read_file ();
+  void write_file () const;
+
+  int         m_num_reps;
+  std::string m_file_name;
+  std::string m_problem;
+  bool        m_write_file;
+  std::function<void(std::vector<double>&)> m_reduce_max;
+
+  // Entries of the tuning file, for all problems
+  std::map<std::string,config_type>  m_file_entries;
+  std::map<std::string,KernelTuning> m_kernels;
+};
+
 template<typename ExecSpaceType, typename... Tags>
 static
 typename std::enable_if<!OnGpu<ExecSpaceType>::value,int>::type
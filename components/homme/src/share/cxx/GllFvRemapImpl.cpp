@@ -58,6 +58,7 @@ void GllFvRemapImpl::setup () {
 void GllFvRemapImpl::reset (const SimulationParams& params) {
   const auto num_elems = Context::singleton().get<Connectivity>().get_num_local_elements();
 
+  m_data.batch_tracers = params.gfr_batch_tracers;
   if (m_data.nelemd == num_elems and m_data.qsize == params.qsize) return;
 
   m_data.qsize = params.qsize;
@@ -408,10 +409,8 @@ void GllFvRemapImpl
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
 
-  const auto tu_ne = m_tu_ne;
-
-  const auto fe = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, tu_ne);
+  const auto fe = KOKKOS_LAMBDA (const KernelVariables& kv) {
+    const auto& team = kv.team;
     const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
@@ -528,14 +527,10 @@ void GllFvRemapImpl
            evucs_np2_nlev(&omega_g(ie,0,0,0)), evus_np2_nlev(rw1.data()),
            evus2(&omega(ie,0,0), nf2, nlevpk));
   };
-  Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne, fe);
 
   const auto dp_g = m_state.m_dp3d;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+  const auto feq = KOKKOS_LAMBDA (const KernelVariables& kv, const int iq) {
+    const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
@@ -553,7 +548,7 @@ void GllFvRemapImpl
       evus3(&q(ie,0,0,0), q.extent_int(1), q.extent_int(2), q.extent_int(3)));
   };
   Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne_qsize, feq);
+  launch_ne_then_ne_q(qsize, fe, feq);
 #endif
 }
 
@@ -608,10 +603,8 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
   const bool theta_hydrostatic_mode = m_data.theta_hydrostatic_mode;
   EquationOfState eos; eos.init(theta_hydrostatic_mode, hvcoord);
   ElementOps ops; ops.init(hvcoord);
-  const auto tu_ne = m_tu_ne;
-
-  const auto fe = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, tu_ne);
+  const auto fe = KOKKOS_LAMBDA (const KernelVariables& kv) {
+    const auto& team = kv.team;
     const auto ie = kv.ie;
 
     const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
@@ -696,18 +689,14 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
       parallel_for(ttrg, f2);
     }
   };
-  Kokkos::fence();
-  parallel_for(m_tp_ne, fe);
 
   const auto dp_g = m_state.m_dp3d;
   const auto q_g = m_tracers.Q;
   const auto fq = m_tracers.fq;
   const auto qlim = m_tracers.qlim;
-  const auto tu_ne_qsize = m_tu_ne_qsize;
 
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+  const auto feq = KOKKOS_LAMBDA (const KernelVariables& kv, const int iq) {
+    const auto ie = kv.ie;
     const auto ttrf = Kokkos::TeamThreadRange(kv.team, nf2);
     const auto ttrg = Kokkos::TeamThreadRange(kv.team, np2);
     const auto tvr  = Kokkos::ThreadVectorRange(kv.team, nlevpk);
@@ -753,14 +742,13 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
     }
   };
   Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, feq);
+  launch_ne_then_ne_q(qsize, fe, feq);
 
   // Halo exchange extrema data.
   m_extrema_be->exchange_min_max();
 
-  const auto geq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, qsize, tu_ne_qsize);
-    const auto ie = kv.ie, iq = kv.iq;
+  const auto geq = KOKKOS_LAMBDA (const KernelVariables& kv, const int iq) {
+    const auto ie = kv.ie;
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
     // Augment bounds with GLL Q0 bounds. This assures that if the tendency is
@@ -777,7 +765,7 @@ run_fv_phys_to_dyn (const int timeidx, const CPhys2T& Ts, const CPhys3T& uvs,
                          evus_np2_nlev(rw1.data()), fq_ie);
   };
   Kokkos::fence();
-  parallel_for(m_tp_ne_qsize, geq);
+  launch_ne_q(qsize, geq);
 #endif
 }
 
@@ -852,9 +840,8 @@ void GllFvRemapImpl
   ElementOps ops; ops.init(hvcoord);
 
   // dp
-  const auto tu_ne = m_tu_ne;
-  const auto fe = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, tu_ne);
+  const auto fe = KOKKOS_LAMBDA (const KernelVariables& kv) {
+    const auto& team = kv.team;
     const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
@@ -874,16 +861,11 @@ void GllFvRemapImpl
                  dp_fv_ie);
     }
   };
-  Kokkos::fence();
-  Kokkos::parallel_for(m_tp_ne, fe);
 
   // q
   const auto dp_g = m_state.m_dp3d;
-  const auto tp_ne_nq = Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq);
-  const auto tu_ne_nq = TeamUtils<ExecSpace>(tp_ne_nq);
-  const auto feq = KOKKOS_LAMBDA (const MT& team) {
-    KernelVariables kv(team, nq, tu_ne_nq);
-    const auto ie = kv.ie, iq = kv.iq;
+  const auto feq = KOKKOS_LAMBDA (const KernelVariables& kv, const int iq) {
+    const auto ie = kv.ie;
 
     const auto all = Kokkos::ALL();
     const auto rw1 = Kokkos::subview(buf10, kv.team_idx, all, all, all);
@@ -900,7 +882,7 @@ void GllFvRemapImpl
       evus3(&q_fv(ie,0,0,0), q_fv.extent_int(1), q_fv.extent_int(2), q_fv.extent_int(3)));
   };
   Kokkos::fence();
-  Kokkos::parallel_for(tp_ne_nq, feq);
+  launch_ne_then_ne_q(nq, fe, feq);
 #endif  
 }
 
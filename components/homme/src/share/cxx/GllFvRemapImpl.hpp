@@ -61,6 +61,8 @@ struct GllFvRemapImpl {
   struct Data {
     int nelemd, qsize, nf2, n_dss_fld;
     bool use_moisture, theta_hydrostatic_mode;
+    // Remap all the tracers of an element in the team that remaps its state.
+    bool batch_tracers;
 
     static constexpr int nbuf1 = 2, nbuf2 = 1;
     Buf1 buf1[nbuf1];
@@ -76,7 +78,7 @@ struct GllFvRemapImpl {
       D_f, Dinv_f; // (nelemd,nf2,2,2)
 
     Data ()
-      : nelemd(-1), qsize(-1), nf2(-1)
+      : nelemd(-1), qsize(-1), nf2(-1), batch_tracers(false)
     {}
   };
 
@@ -121,6 +123,61 @@ struct GllFvRemapImpl {
   void remap_tracer_dyn_to_fv_phys(const int time_idx, const int nq,
                                    const CPhys3T& q_dyn, const Phys3T& q_fv);
 
+  // Run feq(kv,iq) for each element and tracer iq < nq: with one team per
+  // (element, tracer), or, if batch_tracers, with one team per element that
+  // loops over the tracers.
+  template <typename FEQ>
+  void launch_ne_q (const int nq, const FEQ& feq) const {
+    if (m_data.batch_tracers) {
+      const auto tu_ne = m_tu_ne;
+      const auto f = KOKKOS_LAMBDA (const MT& team) {
+        KernelVariables kv(team, tu_ne);
+        for (int iq = 0; iq < nq; ++iq) {
+          if (iq > 0) kv.team_barrier();
+          feq(kv, iq);
+        }
+      };
+      Kokkos::parallel_for(m_tp_ne, f);
+    } else {
+      const bool all = nq == m_data.qsize;
+      const auto tp = all ? m_tp_ne_qsize :
+        Homme::get_default_team_policy<ExecSpace>(m_data.nelemd * nq);
+      const auto tu = all ? m_tu_ne_qsize : TeamUtils<ExecSpace>(tp);
+      const auto f = KOKKOS_LAMBDA (const MT& team) {
+        KernelVariables kv(team, nq, tu);
+        feq(kv, kv.iq);
+      };
+      Kokkos::parallel_for(tp, f);
+    }
+  }
+
+  // Run fe(kv) for each element, then feq(kv,iq) as in launch_ne_q. If
+  // batch_tracers, fe and the tracer loop run in the same team.
+  template <typename FE, typename FEQ>
+  void launch_ne_then_ne_q (const int nq, const FE& fe, const FEQ& feq) const {
+    if (m_data.batch_tracers) {
+      const auto tu_ne = m_tu_ne;
+      const auto f = KOKKOS_LAMBDA (const MT& team) {
+        KernelVariables kv(team, tu_ne);
+        fe(kv);
+        for (int iq = 0; iq < nq; ++iq) {
+          kv.team_barrier();
+          feq(kv, iq);
+        }
+      };
+      Kokkos::parallel_for(m_tp_ne, f);
+    } else {
+      const auto tu_ne = m_tu_ne;
+      const auto f = KOKKOS_LAMBDA (const MT& team) {
+        KernelVariables kv(team, tu_ne);
+        fe(kv);
+      };
+      Kokkos::parallel_for(m_tp_ne, f);
+      Kokkos::fence();
+      launch_ne_q(nq, feq);
+    }
+  }
+
   /* Compute pressure level increments on the FV grid given ps on the FV grid.
      Directly projecting dp_gll to dp_fv disagrees numerically with the loop in
      this subroutine. This loop is essentially how CAM computes pdel in
@@ -10,6 +10,7 @@
 #include <memory>
 #include <type_traits>
 
+#include "Context.hpp"
 #include "ErrorDefs.hpp"
 
 #include "Elements.hpp"
@@ -567,12 +568,15 @@ private:
 
   template <typename FunctorTag>
   void run_functor(const std::string functor_name, int num_exec) {
-    const auto policy = remap_team_policy<FunctorTag>(num_exec);
+    auto& tuner = Context::singleton().create_if_not_there<PolicyTuner>();
+    const auto policy = tuner.tuned_policy(functor_name,remap_team_policy<FunctorTag>(num_exec));
     // Timers don't work on CUDA, so place them here
     GPTLstart(functor_name.c_str());
     profiling_resume();
+    tuner.start(functor_name);
     Kokkos::parallel_for("vertical remap", policy, *this);
     Kokkos::fence();
+    tuner.stop(functor_name);
     profiling_pause();
     GPTLstop(functor_name.c_str());
   }
@@ -65,6 +65,19 @@ struct SimulationParams
   double    dp3d_thresh;
   double    vtheta_thresh;
 
+  // If >0 (and <qsize), the Eulerian transport processes the tracers in blocks
+  // of this size, overlapping the DSS of one block with the computation of the
+  // next one. Default is 0, all tracers at once.
+  int       euler_tracer_block_size = 0;
+
+  // If true, the SL transport overlaps the velocity DSS of the trajectory
+  // computation with the computation on the elements with no shared connection.
+  bool      compose_overlap_trajectory_dss = false;
+
+  // If true, GllFvRemap remaps all the tracers of an element in the same team
+  // as the element's state, rather than with one team per (element, tracer).
+  bool      gfr_batch_tracers = false;
+
   // Optionally run diagnostics and output information. Default is 0, none. Set
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
@@ -112,6 +125,9 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   laplacian_rigid_factor: " << laplacian_rigid_factor << "\n";
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
+  out << "   euler_tracer_block_size: " << euler_tracer_block_size << "\n";
+  out << "   compose_overlap_trajectory_dss: " << (compose_overlap_trajectory_dss ? "yes" : "no") << "\n";
+  out << "   gfr_batch_tracers: " << (gfr_batch_tracers ? "yes" : "no") << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
   out << "\n**********************************************************\n";
 }
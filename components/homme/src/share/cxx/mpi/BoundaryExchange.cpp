@@ -301,10 +301,7 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
 #endif
 
   // Hey, if some process can already send me stuff while I'm still packing, that's ok
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
-  m_recv_pending = true;
+  start_recv();
 
   // ---- Pack and send ---- //
   pack_and_send ();
@@ -343,10 +340,7 @@ void BoundaryExchange::exchange_min_max ()
 #endif
 
   // Hey, if some process can already send me stuff while I'm still packing, that's ok
-  if ( ! m_recv_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
-  m_recv_pending = true;
+  start_recv();
 
   // ---- Pack and send ---- //
   pack_and_send_min_max ();
@@ -365,15 +359,17 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields, const int sharing) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
+  const bool all = sharing == etoi(ConnectionSharing::ANY);
   Kokkos::parallel_for(
     Kokkos::RangePolicy<ExecSpace>(0, num_2d_fields*nconn),
     KOKKOS_LAMBDA(const int it) {
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      if ( ! all && info.sharing != sharing) return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -391,12 +387,13 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
-      const int num_elems, const int num_3d_fields,
+      const int num_elems, const int num_3d_fields, const int sharing,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
   ExecViewUnmanaged<const int*> nlev_packs;
   if (partial_column) nlev_packs = *nlev_packs_;
+  const bool all = sharing == etoi(ConnectionSharing::ANY);
   if (OnGpu<ExecSpace>::value) {
     const ConnectionHelpers helpers;
     const int nconn = ucon.extent_int(0);
@@ -411,6 +408,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        if ( ! all && info.sharing != sharing) return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +440,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          if ( ! all && info.sharing != sharing) continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -463,52 +462,125 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 
 void BoundaryExchange::pack_and_send ()
 {
-  tstart("be pack_and_send");
-  // The registration MUST be completed by now
-  // Note: this also implies connectivity and buffers manager are valid
-  assert (m_registration_completed);
+  pack_and_send(ConnectionSharing::ANY);
+}
 
-  // Check that this object is setup to perform exchange and not exchange_min_max
+void BoundaryExchange::pack_and_send_shared ()
+{
+  assert (m_registration_completed);
   assert (m_exchange_type==MPI_EXCHANGE);
 
-  // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
   if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
     return;
   }
 
-  // Check that buffers are not locked by someone else, then lock them
-  assert (!m_buffers_manager->are_buffers_busy());
-  m_buffers_manager->lock_buffers();
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  // As in exchange, start receiving before packing, since the local connections
+  // are packed only later.
+  start_recv();
+
+  pack_and_send(ConnectionSharing::SHARED);
+}
+
+void BoundaryExchange::start_recv_and_pack_and_send ()
+{
+  assert (m_registration_completed);
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
 
-  // If this is the first time we call this method, or if the MpiBuffersManager has performed a reallocation
-  // since the last time this method was called, AND we are calling this method manually, without relying
-  // on the exchange method to call it, then we need to rebuild all our internal buffer views
   if (!m_buffer_views_and_requests_built) {
-    tstart("be build_buffer_views_and_requests");
     build_buffer_views_and_requests();
-    tstop("be build_buffer_views_and_requests");
   }
 
-  // ---- Pack ---- //
+  start_recv();
+
+  pack_and_send(ConnectionSharing::ANY);
+}
+
+void BoundaryExchange::start_recv ()
+{
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+}
+
+void BoundaryExchange::pack_local ()
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // The local connections go in the local buffer, which is not involved in
+  // MPI, so they can be packed while the shared ones are in flight. The
+  // buffers were locked by pack_and_send_shared.
+  assert (m_send_pending);
+
+  tstart("be pack_local");
+  pack_fields(ConnectionSharing::LOCAL);
+  tstop("be pack_local");
+}
+
+void BoundaryExchange::pack_fields (const ConnectionSharing sharing)
+{
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
+  const int s = etoi(sharing);
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
     pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
+         m_num_2d_fields, s);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
       pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+                          m_num_elems, m_num_3d_fields, s, &m_3d_nlev_pack_d);
     else
       pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+                    m_num_elems, m_num_3d_fields, s);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
     pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+                    m_num_elems, m_num_3d_int_fields, s);
+}
+
+void BoundaryExchange::pack_and_send (const ConnectionSharing sharing)
+{
+  tstart("be pack_and_send");
+  // The registration MUST be completed by now
+  // Note: this also implies connectivity and buffers manager are valid
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  // I am not sure why and if we could have this scenario, but just in case. I think MPI *may* go bananas in this case
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Check that buffers are not locked by someone else, then lock them
+  assert (!m_buffers_manager->are_buffers_busy());
+  m_buffers_manager->lock_buffers();
+
+  // If this is the first time we call this method, or if the MpiBuffersManager has performed a reallocation
+  // since the last time this method was called, AND we are calling this method manually, without relying
+  // on the exchange method to call it, then we need to rebuild all our internal buffer views
+  if (!m_buffer_views_and_requests_built) {
+    tstart("be build_buffer_views_and_requests");
+    build_buffer_views_and_requests();
+    tstop("be build_buffer_views_and_requests");
+  }
+
+  // ---- Pack ---- //
+  pack_fields(sharing);
   Kokkos::fence();
 
   // ---- Send ---- //
@@ -529,6 +601,10 @@ void BoundaryExchange::recv_and_unpack () {
   recv_and_unpack(nullptr);
 }
 
+void BoundaryExchange::recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  recv_and_unpack(&rspheremp);
+}
+
 // assume:conn-edges-snwe
 static void
 unpack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> ucon,
@@ -218,6 +218,19 @@ public:
   // Perform the pack_and_send and recv_and_unpack for boundary exchange of 2d/3d fields
   void pack_and_send ();
   void recv_and_unpack ();
+  void recv_and_unpack (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
+  // Same as pack_and_send, but first start receiving, as exchange does. Use it
+  // when other work is done before recv_and_unpack: otherwise the receives are
+  // only posted in recv_and_unpack, and large messages do not move until then.
+  void start_recv_and_pack_and_send ();
+
+  // Split pack_and_send, to overlap the computation of the fields with the
+  // exchange: first pack the shared connections and start the sends, then pack
+  // the local connections, then call recv_and_unpack. Only the elements with
+  // shared connections need to be up to date when pack_and_send_shared is called.
+  void pack_and_send_shared ();
+  void pack_local ();
 
   // Perform the pack_and_send and recv_and_unpack for min/max boundary exchange of 1d fields
   void pack_and_send_min_max ();
@@ -236,6 +249,9 @@ public:
 
 private:
 
+  // Start the receives (used before packing, so that neighbors can send right away)
+  void start_recv ();
+
   short int m_exchange_type;
 
   // Make MpiBuffersManager a friend, so it can call the method underneath
@@ -311,6 +327,8 @@ private:
     std::vector<int>& h_slot_idx_to_elem_conn_pair,
     std::vector<int>& pids, std::vector<int>& pids_os);
   void free_requests();
+  void pack_fields(const ConnectionSharing sharing);
+  void pack_and_send(const ConnectionSharing sharing);
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
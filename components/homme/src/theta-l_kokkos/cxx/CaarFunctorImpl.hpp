@@ -340,15 +340,19 @@ struct CaarFunctorImpl {
   {
 
     auto& limiter  = Context::singleton().get<LimiterFunctor>();
+    auto& tuner    = Context::singleton().create_if_not_there<PolicyTuner>();
 
     set_rk_stage_data(data);
 
     profiling_resume();
 
     GPTLstart("caar compute");
+    const auto policy_pre = tuner.tuned_policy("caar_pre_exchange",m_policy_pre);
     int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+    tuner.start("caar_pre_exchange");
+    Kokkos::parallel_reduce("caar loop pre-boundary exchange", policy_pre, *this, nerr);
     Kokkos::fence();
+    tuner.stop("caar_pre_exchange");
     GPTLstop("caar compute");
     if (nerr > 0)
       check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
@@ -266,13 +266,18 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
   });
   Kokkos::fence();
 
+  // The tuner may move to its next candidate at any stop(), so the policy is
+  // fetched right before each launch, and not once for all subcycles.
+  auto& tuner = Context::singleton().create_if_not_there<PolicyTuner>();
   for (int icycle = 0; icycle < m_data.hypervis_subcycle; ++icycle) {
     GPTLstart("hvf-bhwk");
     biharmonic_wk_theta ();
     GPTLstop("hvf-bhwk");
 
-    Kokkos::parallel_for(m_policy_pre_exchange, *this);
+    tuner.start("hv_pre_exchange");
+    Kokkos::parallel_for(tuner.tuned_policy("hv_pre_exchange",m_policy_pre_exchange), *this);
     Kokkos::fence();
+    tuner.stop("hv_pre_exchange");
 
     // Exchange
     assert (m_be->is_registration_completed());
@@ -281,8 +286,10 @@ void HyperviscosityFunctorImpl::run (const int np1, const Real dt, const Real et
     GPTLstop("hvf-bexch");
 
     // Update states
-    Kokkos::parallel_for(m_policy_update_states, *this);
+    tuner.start("hv_update_states");
+    Kokkos::parallel_for(tuner.tuned_policy("hv_update_states",m_policy_update_states), *this);
     Kokkos::fence();
+    tuner.stop("hv_update_states");
   } //subcycle
 
   // Convert theta back to vtheta, and adjust w at surface
@@ -355,8 +362,11 @@ void HyperviscosityFunctorImpl::biharmonic_wk_theta() const
   // For the first laplacian we use a differnt kernel, which uses directly the states
   // at timelevel np1 as inputs, and subtracts the reference states.
   // This way we avoid copying the states to *tens buffers.
-  Kokkos::parallel_for(m_policy_first_laplace, *this);
+  auto& tuner = Context::singleton().create_if_not_there<PolicyTuner>();
+  tuner.start("hv_first_laplace");
+  Kokkos::parallel_for(tuner.tuned_policy("hv_first_laplace",m_policy_first_laplace), *this);
   Kokkos::fence();
+  tuner.stop("hv_first_laplace");
 
   // Exchange
   assert (m_be->is_registration_completed());
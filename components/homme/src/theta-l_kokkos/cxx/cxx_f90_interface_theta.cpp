@@ -47,7 +47,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
                                const bool& use_cpstar, const int& transport_alg, const bool& theta_hydrostatic_mode, const char** test_case,
                                const int& dt_remap_factor, const int& dt_tracer_factor,
                                const double& scale_factor, const double& laplacian_rigid_factor, const int& nsplit, const bool& pgrad_correction,
-                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level)
+                               const double& dp3d_thresh, const double& vtheta_thresh, const int& internal_diagnostics_level,
+                               const int& euler_tracer_block_size, const bool& compose_overlap_trajectory_dss,
+                               const bool& gfr_batch_tracers)
 {
   // Check that the simulation options are supported. This helps us in the future, since we
   // are currently 'assuming' some option have/not have certain values. As we support for more
@@ -69,6 +71,7 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   Errors::check_option("init_simulation_params_c","vtheta_thresh",vtheta_thresh,0.0,Errors::ComparisonOp::GT);
   Errors::check_option("init_simulation_params_c","nu_div",nu_div,0.0,Errors::ComparisonOp::GT);
   Errors::check_option("init_simulation_params_c","theta_advection_form",theta_adv_form,{0,1});
+  Errors::check_option("init_simulation_params_c","euler_tracer_block_size",euler_tracer_block_size,0,Errors::ComparisonOp::GE);
 #ifndef SCREAM
   Errors::check_option("init_simulation_params_c","nsplit",nsplit,1,Errors::ComparisonOp::GE);
 #else
@@ -124,6 +127,9 @@ void init_simulation_params_c (const int& remap_alg, const int& limiter_option,
   params.dp3d_thresh                   = dp3d_thresh;
   params.vtheta_thresh                 = vtheta_thresh;
   params.internal_diagnostics_level    = internal_diagnostics_level;
+  params.euler_tracer_block_size       = euler_tracer_block_size;
+  params.compose_overlap_trajectory_dss = compose_overlap_trajectory_dss;
+  params.gfr_batch_tracers             = gfr_batch_tracers;
 
   if (time_step_type==5) {
     //5 stage, 3rd order, explicit
@@ -400,6 +406,21 @@ void init_functors_c (const bool& allocate_buffer)
     c.create_if_not_there<DirkFunctor>(elems.num_elems());
   }
 
+  // Set up the (opt-in) tuning of team/vector sizes. DIRK is not tuned, since
+  // its workspace layout is derived from the team policy at construction.
+  auto& tuner = c.create_if_not_there<PolicyTuner>();
+  {
+    const auto& comm = c.get<Comm>();
+    int nelem = elems.num_elems();
+    MPI_Allreduce(MPI_IN_PLACE, &nelem, 1, MPI_INT, MPI_SUM, comm.mpi_comm());
+    const auto mpi_comm = comm.mpi_comm();
+    tuner.set_problem(nelem, NUM_PHYSICAL_LEV, params.qsize, ExecSpace().concurrency(), comm.root(),
+                      [mpi_comm](std::vector<double>& times) {
+                        MPI_Allreduce(MPI_IN_PLACE, times.data(), times.size(),
+                                      MPI_DOUBLE, MPI_MAX, mpi_comm);
+                      });
+  }
+
   // If memory in the buffer manager was previously allocated, skip allocation here
   if (allocate_buffer) {
     // Make the functor request their buffer to the buffers manager
@@ -302,6 +302,69 @@ TEST_CASE ("Boundary Exchange", "Testing the boundary exchange framework")
     }}}}}}
   }
 
+  // The split exchange (pack_and_send_shared, pack_local, recv_and_unpack),
+  // used to overlap computation with communication, must be BFB with exchange.
+  // With more than one rank, this exercises the shared connections too.
+  {
+    if (connectivity->get_comm().size()>1) {
+      REQUIRE (connectivity->get_num_shared_connections<HostMemSpace>()>0);
+    }
+
+    ExecViewManaged<Real*[NUM_TIME_LEVELS][NP][NP]> f2d_split("", num_elements), f2d_ref("", num_elements);
+    ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV]> f3d_split("", num_elements), f3d_ref("", num_elements);
+    ExecViewManaged<Scalar*[NUM_TIME_LEVELS][NP][NP][NUM_LEV_P]> f3d_int_split("", num_elements), f3d_int_ref("", num_elements);
+
+    genRandArray(f2d_ref,engine,dreal);
+    genRandArray(f3d_ref,engine,dreal);
+    genRandArray(f3d_int_ref,engine,dreal);
+    Kokkos::deep_copy(f2d_split,f2d_ref);
+    Kokkos::deep_copy(f3d_split,f3d_ref);
+    Kokkos::deep_copy(f3d_int_split,f3d_int_ref);
+
+    auto be_split = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    auto be_ref   = std::make_shared<BoundaryExchange>(connectivity,buffers_manager);
+    be_split->set_num_fields(0,num_scalar_fields_2d,num_scalar_fields_3d,num_scalar_interface_fields_3d);
+    be_split->register_field(f2d_split,1,field_2d_idim);
+    be_split->register_field(f3d_split,1,field_3d_idim);
+    be_split->register_field(f3d_int_split,1,field_3d_idim);
+    be_split->registration_completed();
+    be_ref->set_num_fields(0,num_scalar_fields_2d,num_scalar_fields_3d,num_scalar_interface_fields_3d);
+    be_ref->register_field(f2d_ref,1,field_2d_idim);
+    be_ref->register_field(f3d_ref,1,field_3d_idim);
+    be_ref->register_field(f3d_int_ref,1,field_3d_idim);
+    be_ref->registration_completed();
+
+    be_ref->exchange();
+    be_split->pack_and_send_shared();
+    be_split->pack_local();
+    be_split->recv_and_unpack();
+
+    auto f2d_split_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f2d_split);
+    auto f2d_ref_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f2d_ref);
+    auto f3d_split_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f3d_split);
+    auto f3d_ref_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f3d_ref);
+    auto f3d_int_split_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f3d_int_split);
+    auto f3d_int_ref_h   = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),f3d_int_ref);
+
+    for (int ie=0; ie<num_elements; ++ie) {
+      for (int itl=0; itl<NUM_TIME_LEVELS; ++itl) {
+        for (int igp=0; igp<NP; ++igp) {
+          for (int jgp=0; jgp<NP; ++jgp) {
+            REQUIRE(f2d_split_h(ie,itl,igp,jgp)==f2d_ref_h(ie,itl,igp,jgp));
+            for (int ilev=0; ilev<NUM_LEV; ++ilev) {
+              for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+                REQUIRE(f3d_split_h(ie,itl,igp,jgp,ilev)[ivec]==f3d_ref_h(ie,itl,igp,jgp,ilev)[ivec]);
+            }}
+            for (int ilev=0; ilev<NUM_LEV_P; ++ilev) {
+              for (int ivec=0; ivec<VECTOR_SIZE; ++ivec) {
+                REQUIRE(f3d_int_split_h(ie,itl,igp,jgp,ilev)[ivec]==f3d_int_ref_h(ie,itl,igp,jgp,ilev)[ivec]);
+            }}
+    }}}}
+
+    be_split->clean_up();
+    be_ref->clean_up();
+  }
+
   // Cleanup
   cleanup_f90();  // Deallocate stuff in the F90 module
   be1->clean_up();
@@ -1,5 +1,7 @@
 #include <catch2/catch.hpp>
 
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <limits>
 
@@ -134,6 +136,72 @@ TEST_CASE("ExecSpaceDefs",
   }
 }
 
+static void run_tuner_kernel (const Kokkos::TeamPolicy<ExecSpace>& policy) {
+  ExecViewManaged<Real*> v("",policy.league_size());
+  Kokkos::parallel_for(policy, KOKKOS_LAMBDA(const TeamMember& team) {
+    Kokkos::single(Kokkos::PerTeam(team),[&](){ v(team.league_rank()) = 1; });
+  });
+}
+
+TEST_CASE("PolicyTuner",
+          "Test the run-time tuning of team policies and the tuning file.") {
+  const std::string file_name = "policy_tuner_ut.dat";
+  std::remove(file_name.c_str());
+  const auto policy = get_default_team_policy<ExecSpace>(10);
+
+  // Without HOMMEXX_AUTOTUNE_STEPS, the input policy is returned
+  unsetenv("HOMMEXX_AUTOTUNE_STEPS");
+  setenv("HOMMEXX_AUTOTUNE_FILE",file_name.c_str(),1);
+  {
+    PolicyTuner tuner;
+    tuner.set_problem(10,NUM_PHYSICAL_LEV,4,ExecSpace().concurrency(),true);
+    REQUIRE (!tuner.enabled());
+    const auto p = tuner.tuned_policy("kernel",policy);
+    REQUIRE (p.team_size()==policy.team_size());
+    REQUIRE (p.impl_vector_length()==policy.impl_vector_length());
+  }
+
+  // Tune, then check that a new tuner picks the same configuration from file
+  setenv("HOMMEXX_AUTOTUNE_STEPS","1",1);
+  int team_size, vector_length;
+  {
+    PolicyTuner tuner;
+    tuner.set_problem(10,NUM_PHYSICAL_LEV,4,ExecSpace().concurrency(),true);
+    REQUIRE (tuner.enabled());
+    for (int i=0; i<100; ++i) {
+      const auto p = tuner.tuned_policy("kernel",policy);
+      REQUIRE (p.league_size()==policy.league_size());
+      tuner.start("kernel");
+      run_tuner_kernel(p);
+      tuner.stop("kernel");
+    }
+    const auto p = tuner.tuned_policy("kernel",policy);
+    team_size = p.team_size();
+    vector_length = p.impl_vector_length();
+    if (!OnGpu<ExecSpace>::value) {
+      REQUIRE (team_size==policy.team_size());
+      REQUIRE (vector_length==policy.impl_vector_length());
+    }
+  }
+  unsetenv("HOMMEXX_AUTOTUNE_STEPS");
+  {
+    PolicyTuner tuner;
+    tuner.set_problem(10,NUM_PHYSICAL_LEV,4,ExecSpace().concurrency(),false);
+    REQUIRE (tuner.enabled());
+    const auto p = tuner.tuned_policy("kernel",policy);
+    REQUIRE (p.team_size()==team_size);
+    REQUIRE (p.impl_vector_length()==vector_length);
+
+    // A different problem has no entry in the file
+    tuner.set_problem(20,NUM_PHYSICAL_LEV,4,ExecSpace().concurrency(),false);
+    const auto p2 = tuner.tuned_policy("kernel",policy);
+    REQUIRE (p2.team_size()==policy.team_size());
+    REQUIRE (p2.impl_vector_length()==policy.impl_vector_length());
+  }
+  unsetenv("HOMMEXX_AUTOTUNE_FILE");
+  std::remove(file_name.c_str());
+}
+
 template <typename Dispatcher, int num_points, int scan_length>
 void test_parallel_scan(
     Kokkos::TeamPolicy<ExecSpace,void> policy,
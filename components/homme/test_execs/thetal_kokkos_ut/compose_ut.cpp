@@ -358,24 +358,27 @@ TEST_CASE ("compose_transport_testing") {
     CA4d dpreconf("dpreconf", s.nelemd, s.nlev, s.np, s.np);
     run_trajectory_f90(t0, t1, independent_time_steps, depf.data(),
                        dpreconf.data());
-    const auto depc = ct.test_trajectory(t0, t1, independent_time_steps);
-    REQUIRE(depc.extent_int(0) == s.nelemd);
-    REQUIRE(depc.extent_int(2) == s.np);
-    REQUIRE(depc.extent_int(4) == 3);
-    if (independent_time_steps) {
-      const auto dpreconc = cmvdc(RNlev(pack2real(s.e->m_derived.m_divdp), s.nelemd));
+    // The overlapped velocity DSS must give the same answer.
+    for (const bool overlap_dss : {false, true}) {
+      const auto depc = ct.test_trajectory(t0, t1, independent_time_steps, overlap_dss);
+      REQUIRE(depc.extent_int(0) == s.nelemd);
+      REQUIRE(depc.extent_int(2) == s.np);
+      REQUIRE(depc.extent_int(4) == 3);
+      if (independent_time_steps) {
+        const auto dpreconc = cmvdc(RNlev(pack2real(s.e->m_derived.m_divdp), s.nelemd));
+        for (int ie = 0; ie < s.nelemd; ++ie)
+          for (int lev = 0; lev < s.nlev; ++lev)
+            for (int i = 0; i < s.np; ++i)
+              for (int j = 0; j < s.np; ++j)
+                REQUIRE(equal(dpreconf(ie,lev,i,j), dpreconc(ie,i,j,lev), 10*tol));
+      }
       for (int ie = 0; ie < s.nelemd; ++ie)
         for (int lev = 0; lev < s.nlev; ++lev)
           for (int i = 0; i < s.np; ++i)
             for (int j = 0; j < s.np; ++j)
-              REQUIRE(equal(dpreconf(ie,lev,i,j), dpreconc(ie,i,j,lev), 10*tol));
+              for (int d = 0; d < 3; ++d)
+                REQUIRE(equal(depf(ie,lev,i,j,d), depc(ie,lev,i,j,d), 10*tol));
     }
-    for (int ie = 0; ie < s.nelemd; ++ie)
-      for (int lev = 0; lev < s.nlev; ++lev)
-        for (int i = 0; i < s.np; ++i)
-          for (int j = 0; j < s.np; ++j)
-            for (int d = 0; d < 3; ++d)
-              REQUIRE(equal(depf(ie,lev,i,j,d), depc(ie,lev,i,j,d), 10*tol));
   }
 
   { // q vertical remap
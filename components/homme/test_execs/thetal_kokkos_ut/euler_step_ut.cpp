@@ -0,0 +1,252 @@
+#include "EulerStepFunctorImpl.hpp"
+
+#include "Types.hpp"
+#include "Context.hpp"
+#include "mpi/Comm.hpp"
+#include "mpi/Connectivity.hpp"
+#include "mpi/MpiBuffersManager.hpp"
+#include "FunctorsBuffersManager.hpp"
+#include "SimulationParams.hpp"
+#include "Elements.hpp"
+#include "Tracers.hpp"
+#include "TimeLevel.hpp"
+#include "HybridVCoord.hpp"
+#include "SphereOperators.hpp"
+#include "ReferenceElement.hpp"
+#include "PhysicalConstants.hpp"
+
+#include <catch2/catch.hpp>
+#include <random>
+
+using namespace Homme;
+
+extern "C" {
+  void init_gllfvremap_f90(int ne, const Real* hyai, const Real* hybi, const Real* hyam,
+                           const Real* hybm, Real ps0, Real* dvv, Real* mp, int qsize,
+                           bool is_sphere);
+  void init_geometry_f90();
+} // extern "C"
+
+template <typename V>
+decltype(Kokkos::create_mirror_view(V())) cmvdc (const V& v) {
+  const auto h = Kokkos::create_mirror_view(v);
+  deep_copy(h, v);
+  return h;
+}
+
+template <typename View> static
+Real* pack2real (const View& v) { return &(*v.data())[0]; }
+
+class Random {
+  using rngalg = std::mt19937_64;
+  using rpdf = std::uniform_real_distribution<Real>;
+  std::random_device rd;
+  unsigned int seed;
+  rngalg engine;
+public:
+  Random (unsigned int seed_ = Catch::rngSeed()) : seed(seed_ == 0 ? rd() : seed_), engine(seed) {}
+  unsigned int gen_seed () { return seed; }
+  Real urrng (const Real lo = 0, const Real hi = 1) { return rpdf(lo, hi)(engine); }
+};
+
+// Fill all the entries of a view of Scalar, padding included.
+template <typename V>
+void fill (Random& r, const V& a, const Real lo, const Real hi) {
+  const auto am = Kokkos::create_mirror_view(a);
+  Real* const p = pack2real(am);
+  const int n = am.size()*VECTOR_SIZE;
+  for (int i = 0; i < n; ++i) p[i] = r.urrng(lo, hi);
+  deep_copy(a, am);
+}
+
+template <typename V>
+bool bfb (const V& a, const V& b) {
+  const auto am = cmvdc(a);
+  const auto bm = cmvdc(b);
+  const Real* const ap = pack2real(am);
+  const Real* const bp = pack2real(bm);
+  const int n = am.size()*VECTOR_SIZE;
+  for (int i = 0; i < n; ++i)
+    if (ap[i] != bp[i]) return false;
+  return true;
+}
+
+struct Session {
+  int ne, qsize;
+  Random r;
+  std::shared_ptr<EulerStepFunctor> esf;
+  FunctorsBuffersManager fbm;
+
+  void init () {
+    const auto seed = r.gen_seed();
+    printf("seed %u\n", seed);
+
+    ne = 2;
+    qsize = QSIZE_D;
+    assert(qsize >= 4);
+
+    auto& c = Context::singleton();
+
+    c.create<HybridVCoord>().random_init(seed);
+    const auto& h = c.get<HybridVCoord>();
+
+    auto& p = c.create<SimulationParams>();
+    p.qsize = qsize;
+    p.limiter_option = 9;
+    p.nu_p = 1e13;
+    p.nu_q = 1e13;
+    p.hypervis_scaling = 0;
+    p.transport_alg = 0;
+    p.moisture = MoistDry::MOIST;
+    p.scale_factor = PhysicalConstants::rearth0;
+    p.laplacian_rigid_factor = 1/p.scale_factor;
+    p.params_set = true;
+
+    const auto hyai = cmvdc(h.hybrid_ai);
+    const auto hybi = cmvdc(h.hybrid_bi);
+    const auto hyam = cmvdc(h.hybrid_am);
+    const auto hybm = cmvdc(h.hybrid_bm);
+    auto& ref_FE = c.create<ReferenceElement>();
+    std::vector<Real> dvv(NP*NP), mp(NP*NP);
+    init_gllfvremap_f90(ne, hyai.data(), hybi.data(), &hyam(0)[0], &hybm(0)[0], h.ps0,
+                        dvv.data(), mp.data(), qsize, true);
+    ref_FE.init_mass(mp.data());
+    ref_FE.init_deriv(dvv.data());
+
+    auto& bmm = c.create<MpiBuffersManagerMap>();
+    bmm.set_connectivity(c.get_ptr<Connectivity>());
+    c.create<TimeLevel>();
+
+    init_geometry_f90();
+    auto& geo = c.get<ElementsGeometry>();
+
+    auto& sphop = c.create<SphereOperators>();
+    sphop.setup(geo, ref_FE);
+
+    esf = std::make_shared<EulerStepFunctor>();
+    esf->reset(p);
+    fbm.request_size(esf->requested_buffer_size());
+    fbm.allocate();
+    esf->init_buffers(fbm);
+  }
+
+  void cleanup () {
+    esf = nullptr;
+    Context::singleton().finalize_singleton();
+  }
+
+  static Session& singleton () {
+    if ( ! s_session) {
+      s_session = std::make_shared<Session>();
+      s_session->init();
+    }
+    return *s_session;
+  }
+
+  // Call only in last line of last TEST_CASE.
+  static void delete_singleton () {
+    if (s_session) s_session->cleanup();
+    s_session = nullptr;
+  }
+
+private:
+  static std::shared_ptr<Session> s_session;
+};
+
+std::shared_ptr<Session> Session::s_session;
+
+// Set all the inputs of euler_step from the given seed, so that each run starts
+// from the same state.
+static void init_state (const unsigned int seed) {
+  Random r(seed);
+  const auto& c = Context::singleton();
+  const auto& d = c.get<ElementsDerivedState>();
+  const auto& t = c.get<Tracers>();
+  fill(r, d.m_dp, 1, 2);
+  fill(r, d.m_vn0, -10, 10);
+  fill(r, d.m_divdp, -1e-5, 1e-5);
+  fill(r, d.m_divdp_proj, -1e-5, 1e-5);
+  fill(r, d.m_eta_dot_dpdn, -1, 1);
+  fill(r, d.m_omega_p, -1, 1);
+  fill(r, d.m_dpdiss_ave, 1, 2);
+  fill(r, d.m_dpdiss_biharmonic, -1e-3, 1e-3);
+  fill(r, t.qdp, 0.1, 1);
+  fill(r, t.qtens_biharmonic, -1, 1);
+  fill(r, t.qlim, 0, 1);
+}
+
+struct Result {
+  ExecViewManaged<Scalar*[Q_NUM_TIME_LEVELS][QSIZE_D][NP][NP][NUM_LEV]> qdp;
+  ExecViewManaged<Scalar*[QSIZE_D][NP][NP][NUM_LEV]> qtens_biharmonic;
+  ExecViewManaged<Scalar*[QSIZE_D][2][NUM_LEV]> qlim;
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV_P]> eta_dot_dpdn;
+  ExecViewManaged<Scalar*[NP][NP][NUM_LEV]> omega_p, divdp_proj;
+
+  bool operator== (const Result& o) const {
+    return (bfb(qdp, o.qdp) && bfb(qtens_biharmonic, o.qtens_biharmonic) &&
+            bfb(qlim, o.qlim) && bfb(eta_dot_dpdn, o.eta_dot_dpdn) &&
+            bfb(omega_p, o.omega_p) && bfb(divdp_proj, o.divdp_proj));
+  }
+};
+
+template <typename V>
+V copy (const V& v) {
+  V c(v.label(), v.extent(0));
+  Kokkos::deep_copy(c, v);
+  return c;
+}
+
+// Run one euler step with the given tracer block size, and return the
+// resulting tracers and DSS'ed fields.
+static Result run (Session& s, const unsigned int seed, const int block_size,
+                   const Real rhs_multiplier, const DSSOption DSSopt) {
+  const auto& c = Context::singleton();
+  auto p = c.get<SimulationParams>();
+  p.euler_tracer_block_size = block_size;
+  s.esf->reset(p);
+  s.esf->init_boundary_exchanges();
+
+  init_state(seed);
+  const int np1_qdp = 1, n0_qdp = 0;
+  s.esf->euler_step(np1_qdp, n0_qdp, 300, rhs_multiplier, DSSopt);
+  Kokkos::fence();
+
+  const auto& d = c.get<ElementsDerivedState>();
+  const auto& t = c.get<Tracers>();
+  Result res;
+  res.qdp = copy(t.qdp);
+  res.qtens_biharmonic = copy(t.qtens_biharmonic);
+  res.qlim = copy(t.qlim);
+  res.eta_dot_dpdn = copy(d.m_eta_dot_dpdn);
+  res.omega_p = copy(d.m_omega_p);
+  res.divdp_proj = copy(d.m_divdp_proj);
+  return res;
+}
+
+// Processing the tracers in blocks, with the DSS of a block overlapped with the
+// computation of the next one, must give the same answers as the single pass
+// over all tracers.
+TEST_CASE ("euler_step_tracer_blocks") {
+  auto& s = Session::singleton(); try {
+    const unsigned int seed = s.r.gen_seed();
+    const auto& conn = Context::singleton().get<Connectivity>();
+    if (conn.get_comm().size() > 1)
+      REQUIRE(conn.get_num_shared_connections<HostMemSpace>() > 0);
+
+    for (const auto DSSopt : {DSSOption::ETA, DSSOption::OMEGA, DSSOption::DIV_VDP_AVE}) {
+      // rhs_multiplier 0: neighbor min/max; 2: biharmonic, also in blocks.
+      for (const Real rhs_multiplier : {0.0, 1.0, 2.0}) {
+        const auto ref = run(s, seed, 0, rhs_multiplier, DSSopt);
+        // Block size qsize-1 leaves a last block of size 1; qsize/2 gives equal
+        // blocks; 1 gives a block per tracer.
+        for (const int block_size : {s.qsize-1, s.qsize/2, 1}) {
+          printf("ut> euler_step dss %d rhs_multiplier %1.0f block_size %d\n",
+                 static_cast<int>(DSSopt), rhs_multiplier, block_size);
+          const auto blocked = run(s, seed, block_size, rhs_multiplier, DSSopt);
+          REQUIRE(blocked == ref);
+        }
+      }
+    }
+  } catch (...) {}
+  Session::delete_singleton();
+}
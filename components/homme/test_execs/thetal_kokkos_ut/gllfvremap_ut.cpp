@@ -921,6 +921,62 @@ test_fv_phys_to_dyn (Session& s, const int nf, const bool theta_hydrostatic_mode
   gfr_finish_f90();
 }
 
+static void set_batch_tracers (const bool batch_tracers) {
+  auto& c = Context::singleton();
+  auto& p = c.get<SimulationParams>();
+  p.gfr_batch_tracers = batch_tracers;
+  c.get<GllFvRemap>().reset(p);
+}
+
+// Time the dynamics-physics coupling routines with and without tracer
+// batching. Nothing is checked here; the answers are checked in the tests above.
+static void time_remaps (Session& s, const int nf, const int ntrial) {
+  using g = GllFvRemapImpl;
+
+  const int nf2 = nf*nf;
+
+  gfr_init_f90(nf, false);
+  gfr_init_hxx();
+  init_dyn_data(s);
+
+  const ExecView<Real**> ps("ps", s.nelemd, nf2), phis("phis", s.nelemd, nf2);
+  const ExecView<Real***> T("T", s.nelemd, nf2, g::num_lev_aligned),
+    omega("omega", s.nelemd, nf2, g::num_lev_aligned);
+  const ExecView<Real****> uv("uv", s.nelemd, nf2, 2, g::num_lev_aligned),
+    q("q", s.nelemd, nf2, s.qsize, g::num_lev_aligned);
+
+  auto& gfr = Context::singleton().get<GllFvRemap>();
+  const int nt = 0;
+  double t_g2f[2], t_f2g[2];
+  for (const bool batch_tracers : {false, true}) {
+    set_batch_tracers(batch_tracers);
+    // Warm up.
+    gfr.run_dyn_to_fv_phys(nt, ps, phis, T, omega, uv, q);
+    gfr.run_fv_phys_to_dyn(nt, T, uv, q);
+    Kokkos::fence();
+    Kokkos::Timer timer;
+    for (int trial = 0; trial < ntrial; ++trial)
+      gfr.run_dyn_to_fv_phys(nt, ps, phis, T, omega, uv, q);
+    Kokkos::fence();
+    t_g2f[batch_tracers] = timer.seconds()/ntrial;
+    timer.reset();
+    for (int trial = 0; trial < ntrial; ++trial) {
+      gfr.run_fv_phys_to_dyn(nt, T, uv, q);
+      gfr.run_fv_phys_to_dyn_dss();
+    }
+    Kokkos::fence();
+    t_f2g[batch_tracers] = timer.seconds()/ntrial;
+  }
+  set_batch_tracers(false);
+
+  if (s.get_comm().root())
+    printf("ut> timing nf %d qsize %d nelemd %d [s/call]: g2f %1.3e batched %1.3e"
+           " f2g+dss %1.3e batched %1.3e\n",
+           nf, s.qsize, s.nelemd, t_g2f[0], t_g2f[1], t_f2g[0], t_f2g[1]);
+
+  gfr_finish_f90();
+}
+
 TEST_CASE ("gllfvremap_testing") {
   auto& s = Session::singleton(); try {
     test_get_temperature(s);
@@ -953,18 +1009,27 @@ TEST_CASE ("gllfvremap_testing") {
       REQUIRE(nerr == 0);
     }
 
-    // Main remap routines.
-    for (const bool theta_hydrostatic_mode : {false, true}) {
-      for (const int nf : {2,3,4}) {
-        printf("ut> g2f nf %d thm %d\n", nf, (int) theta_hydrostatic_mode);
-        test_dyn_to_fv_phys(s, nf, theta_hydrostatic_mode);
-      }
+    // Main remap routines, with and without tracer batching.
+    for (const bool batch_tracers : {false, true}) {
+      set_batch_tracers(batch_tracers);
+      for (const bool theta_hydrostatic_mode : {false, true}) {
+        for (const int nf : {2,3,4}) {
+          printf("ut> g2f nf %d thm %d batch %d\n", nf, (int) theta_hydrostatic_mode,
+                 (int) batch_tracers);
+          test_dyn_to_fv_phys(s, nf, theta_hydrostatic_mode);
+        }
 
-      for (const int nf : {2,3,4}) {
-        printf("ut> f2g nf %d thm %d\n", nf, (int) theta_hydrostatic_mode);
-        test_fv_phys_to_dyn(s, nf, theta_hydrostatic_mode);
+        for (const int nf : {2,3,4}) {
+          printf("ut> f2g nf %d thm %d batch %d\n", nf, (int) theta_hydrostatic_mode,
+                 (int) batch_tracers);
+          test_fv_phys_to_dyn(s, nf, theta_hydrostatic_mode);
+        }
       }
     }
+    set_batch_tracers(false);
+
+    // Timing of the pg2 coupling.
+    time_remaps(s, 2, 10);
   } catch (...) {}
   Session::delete_singleton();
 }